@@ -0,0 +1,53 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bitpack.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+void bench_pack128(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b)
+{
+    for (std::size_t i = 0; i < n; i += 128)
+        out = bitpack<128>(out, in + i, b);
+}
+
+void bench_unpack128(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b)
+{
+    for (std::size_t i = 0; i < n; i += 128)
+        in = bitunpack<128>(out + i, in, b);
+}
+
+void bench_unpack256(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b)
+{
+    for (std::size_t i = 0; i < n; i += 256)
+        in = bitunpack<256>(out + i, in, b);
+}
+
+void bench_unpack_delta128(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b)
+{
+    uint32_t prev = 0;
+    for (std::size_t i = 0; i < n; i += 128) {
+        in = bitunpack_delta<128>(out + i, in, b, prev);
+        prev = out[i + 127];
+    }
+}
+
+struct BitpackKernelsRegistrar {
+    BitpackKernelsRegistrar()
+    {
+        bitpack_kernels().push_back({ SIMDPP_ARCH_NAME, this_compile_arch(),
+                                      &bench_pack128, &bench_unpack128,
+                                      &bench_unpack256, &bench_unpack_delta128 });
+    }
+};
+
+static BitpackKernelsRegistrar registrar;
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,31 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_BITPACK_BITPACK_H
+#define LIBSIMDPP_BENCH_BITPACK_BITPACK_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*  Each architecture-specific version of bitpack.cc registers its kernels so
+    that all versions that can run on the current processor can be compared.
+    The kernels process n values, n being a multiple of the block size.
+*/
+struct BitpackKernels {
+    const char* arch_name;
+    simdpp::Arch arch;
+    void (*pack128)(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b);
+    void (*unpack128)(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b);
+    void (*unpack256)(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b);
+    void (*unpack_delta128)(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b);
+};
+
+std::vector<BitpackKernels>& bitpack_kernels();
+
+#endif
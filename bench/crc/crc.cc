@@ -0,0 +1,34 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "crc.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+uint32_t bench_crc32(const void* data, std::size_t n)
+{
+    return crc32(data, n);
+}
+
+uint32_t bench_crc32c(const void* data, std::size_t n)
+{
+    return crc32c(data, n);
+}
+
+uint64_t bench_crc64(const void* data, std::size_t n)
+{
+    return crc64(data, n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((uint32_t)(bench_crc32)((const void*) data, (std::size_t) n))
+SIMDPP_MAKE_DISPATCHER((uint32_t)(bench_crc32c)((const void*) data, (std::size_t) n))
+SIMDPP_MAKE_DISPATCHER((uint64_t)(bench_crc64)((const void*) data, (std::size_t) n))
@@ -0,0 +1,19 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_CRC_CRC_H
+#define LIBSIMDPP_BENCH_CRC_CRC_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstddef>
+#include <cstdint>
+
+uint32_t bench_crc32(const void* data, std::size_t n);
+uint32_t bench_crc32c(const void* data, std::size_t n);
+uint64_t bench_crc64(const void* data, std::size_t n);
+
+#endif
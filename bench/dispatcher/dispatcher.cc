@@ -0,0 +1,40 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "dispatcher.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<int N>
+unsigned bench_dispatch_kernel(unsigned x)
+{
+    return x * 2654435761u + N;
+}
+
+unsigned bench_ptr_kernel(unsigned x)
+{
+    return x * 2654435761u;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((unsigned)(bench_ptr_kernel)((unsigned) x))
+
+SIMDPP_MAKE_DISPATCHER((template<int N>) (<N>)
+                       (unsigned) (bench_dispatch_kernel) ((unsigned) x))
+
+SIMDPP_INSTANTIATE_DISPATCHER(
+    (template unsigned bench_dispatch_kernel<0>(unsigned x)),
+    (template unsigned bench_dispatch_kernel<1>(unsigned x)),
+    (template unsigned bench_dispatch_kernel<2>(unsigned x)),
+    (template unsigned bench_dispatch_kernel<3>(unsigned x)),
+    (template unsigned bench_dispatch_kernel<4>(unsigned x)),
+    (template unsigned bench_dispatch_kernel<5>(unsigned x)),
+    (template unsigned bench_dispatch_kernel<6>(unsigned x)),
+    (template unsigned bench_dispatch_kernel<7>(unsigned x))
+)
@@ -0,0 +1,26 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_DISPATCHER_DISPATCHER_H
+#define LIBSIMDPP_BENCH_DISPATCHER_DISPATCHER_H
+
+#include <simdpp/dispatch/arch.h>
+
+// A tiny kernel, so that the cost of the call dominates. The template is
+// instantiated for N = 0..7 to get several independent dispatchers.
+template<int N>
+unsigned bench_dispatch_kernel(unsigned x);
+
+// The same kernel dispatched via a cached function pointer (the default mode)
+// and via GNU IFUNC (where supported)
+unsigned bench_ptr_kernel(unsigned x);
+unsigned bench_ifunc_kernel(unsigned x);
+
+// The same kernel dispatched with SIMDPP_DISPATCH_TELEMETRY enabled
+unsigned bench_telemetry_kernel(unsigned x);
+
+#endif
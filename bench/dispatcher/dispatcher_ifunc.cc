@@ -0,0 +1,36 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// The IFUNC resolvers run before main(), thus only the CPUID-based detection
+// can be used here.
+#define SIMDPP_DISPATCH_USE_IFUNC 1
+#define SIMDPP_USER_ARCH_INFO bench_ifunc_arch_info()
+#include "dispatcher.h"
+#include <simdpp/simd.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+
+#if SIMDPP_EMIT_DISPATCHER
+static simdpp::Arch bench_ifunc_arch_info()
+{
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    return simdpp::get_arch_raw_cpuid();
+#else
+    return simdpp::Arch::NONE_NULL;
+#endif
+}
+#endif
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+unsigned bench_ifunc_kernel(unsigned x)
+{
+    return x * 2654435761u;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((unsigned)(bench_ifunc_kernel)((unsigned) x))
@@ -0,0 +1,21 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define SIMDPP_DISPATCH_TELEMETRY 1
+#include "dispatcher.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+unsigned bench_telemetry_kernel(unsigned x)
+{
+    return x * 2654435761u;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((unsigned)(bench_telemetry_kernel)((unsigned) x))
@@ -0,0 +1,58 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "encoding.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+std::size_t bench_base64_encode(const void* src, std::size_t n, char* dst)
+{
+    return base64_encode(src, n, dst);
+}
+
+std::size_t bench_base64_decode(const char* src, std::size_t n, void* dst)
+{
+    return base64_decode(src, n, dst);
+}
+
+std::size_t bench_base64url_encode(const void* src, std::size_t n, char* dst)
+{
+    return base64url_encode(src, n, dst);
+}
+
+std::size_t bench_base64url_decode(const char* src, std::size_t n, void* dst)
+{
+    return base64url_decode(src, n, dst);
+}
+
+std::size_t bench_hex_encode(const void* src, std::size_t n, char* dst)
+{
+    return hex_encode(src, n, dst);
+}
+
+std::size_t bench_hex_decode(const char* src, std::size_t n, void* dst)
+{
+    return hex_decode(src, n, dst);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_base64_encode)
+                       ((const void*) src, (std::size_t) n, (char*) dst))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_base64_decode)
+                       ((const char*) src, (std::size_t) n, (void*) dst))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_base64url_encode)
+                       ((const void*) src, (std::size_t) n, (char*) dst))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_base64url_decode)
+                       ((const char*) src, (std::size_t) n, (void*) dst))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_hex_encode)
+                       ((const void*) src, (std::size_t) n, (char*) dst))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_hex_decode)
+                       ((const char*) src, (std::size_t) n, (void*) dst))
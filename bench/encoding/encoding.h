@@ -0,0 +1,23 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_ENCODING_ENCODING_H
+#define LIBSIMDPP_BENCH_ENCODING_ENCODING_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstddef>
+
+// Return the number of bytes or characters written or std::size_t(-1) on
+// invalid input
+std::size_t bench_base64_encode(const void* src, std::size_t n, char* dst);
+std::size_t bench_base64_decode(const char* src, std::size_t n, void* dst);
+std::size_t bench_base64url_encode(const void* src, std::size_t n, char* dst);
+std::size_t bench_base64url_decode(const char* src, std::size_t n, void* dst);
+std::size_t bench_hex_encode(const void* src, std::size_t n, char* dst);
+std::size_t bench_hex_decode(const char* src, std::size_t n, void* dst);
+
+#endif
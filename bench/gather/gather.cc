@@ -0,0 +1,71 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "gather.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+uint32_t bench_gather_sum_u32(const uint32_t* table, const uint32_t* idx,
+                              unsigned n)
+{
+    const unsigned W = SIMDPP_FAST_INT32_SIZE;
+    uint32<W> sum = make_zero();
+    for (unsigned i = 0; i < n; i += W) {
+        uint32<W> vi = load_u(idx + i);
+        sum = add(sum, gather(table, vi));
+    }
+    return reduce_add(sum);
+}
+
+void bench_gather_f32(float* out, const float* table, const uint32_t* idx,
+                      unsigned n)
+{
+    const unsigned W = SIMDPP_FAST_FLOAT32_SIZE;
+    for (unsigned i = 0; i < n; i += W) {
+        uint32<W> vi = load_u(idx + i);
+        store_u(out + i, gather(table, vi));
+    }
+}
+
+void bench_gather_f64(double* out, const double* table, const uint64_t* idx,
+                      unsigned n)
+{
+    const unsigned W = SIMDPP_FAST_FLOAT64_SIZE;
+    for (unsigned i = 0; i < n; i += W) {
+        uint64<W> vi = load_u(idx + i);
+        store_u(out + i, gather(table, vi));
+    }
+}
+
+void bench_scatter_f32(float* table, const uint32_t* idx, const float* in,
+                       unsigned n)
+{
+    const unsigned W = SIMDPP_FAST_FLOAT32_SIZE;
+    for (unsigned i = 0; i < n; i += W) {
+        uint32<W> vi = load_u(idx + i);
+        float32<W> v = load_u(in + i);
+        scatter(table, vi, v);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((uint32_t)(bench_gather_sum_u32)
+                       ((const uint32_t*) table, (const uint32_t*) idx,
+                        (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_gather_f32)
+                       ((float*) out, (const float*) table,
+                        (const uint32_t*) idx, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_gather_f64)
+                       ((double*) out, (const double*) table,
+                        (const uint64_t*) idx, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_scatter_f32)
+                       ((float*) table, (const uint32_t*) idx,
+                        (const float*) in, (unsigned) n))
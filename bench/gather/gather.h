@@ -0,0 +1,30 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_GATHER_GATHER_H
+#define LIBSIMDPP_BENCH_GATHER_GATHER_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstdint>
+
+// All kernels process n elements. n must be a multiple of 16.
+
+// Returns the sum of table[idx[i]]
+uint32_t bench_gather_sum_u32(const uint32_t* table, const uint32_t* idx,
+                              unsigned n);
+
+// out[i] = table[idx[i]]
+void bench_gather_f32(float* out, const float* table, const uint32_t* idx,
+                      unsigned n);
+void bench_gather_f64(double* out, const double* table, const uint64_t* idx,
+                      unsigned n);
+
+// table[idx[i]] = in[i]
+void bench_scatter_f32(float* table, const uint32_t* idx, const float* in,
+                       unsigned n);
+
+#endif
@@ -0,0 +1,46 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "hash.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+void bench_fmix32(uint32_t* out, const uint32_t* keys, std::size_t n)
+{
+    hash_fmix32(out, keys, n);
+}
+
+void bench_fmix64(uint64_t* out, const uint64_t* keys, std::size_t n)
+{
+    hash_fmix64(out, keys, n);
+}
+
+void bench_xxh32(uint32_t* out, const uint32_t* keys, std::size_t n, uint32_t seed)
+{
+    hash_xxh32(out, keys, n, seed);
+}
+
+void bench_xxh64(uint64_t* out, const uint64_t* keys, std::size_t n, uint64_t seed)
+{
+    hash_xxh64(out, keys, n, seed);
+}
+
+struct HashKernelsRegistrar {
+    HashKernelsRegistrar()
+    {
+        hash_kernels().push_back({ SIMDPP_ARCH_NAME, this_compile_arch(),
+                                   &bench_fmix32, &bench_fmix64,
+                                   &bench_xxh32, &bench_xxh64 });
+    }
+};
+
+static HashKernelsRegistrar registrar;
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,31 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_HASH_HASH_H
+#define LIBSIMDPP_BENCH_HASH_HASH_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*  The hash kernels are not dispatched. Instead, each architecture-specific
+    version of hash.cc registers its kernels so that all versions that can run
+    on the current processor can be compared.
+*/
+struct HashKernels {
+    const char* arch_name;
+    simdpp::Arch arch;
+    void (*fmix32)(uint32_t* out, const uint32_t* keys, std::size_t n);
+    void (*fmix64)(uint64_t* out, const uint64_t* keys, std::size_t n);
+    void (*xxh32)(uint32_t* out, const uint32_t* keys, std::size_t n, uint32_t seed);
+    void (*xxh64)(uint64_t* out, const uint64_t* keys, std::size_t n, uint64_t seed);
+};
+
+std::vector<HashKernels>& hash_kernels();
+
+#endif
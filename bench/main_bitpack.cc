@@ -0,0 +1,161 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of bit-packing of 32-bit integers. Packing and unpacking of
+    several bit widths are run for every compiled instruction set that is
+    supported by the current processor and compared against scalar loops
+    that read the same format one value at a time. The throughput is
+    reported in values per second. The data fits into the L2 cache.
+*/
+
+#include "bitpack/bitpack.h"
+#include "utils/bench_timer.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static const unsigned num_values = 1 << 14;
+static const unsigned num_repeats = 200;
+
+std::vector<BitpackKernels>& bitpack_kernels()
+{
+    static std::vector<BitpackKernels> kernels;
+    return kernels;
+}
+
+static uint32_t low_mask(unsigned b)
+{
+    return b == 32 ? 0xffffffff : (uint32_t(1) << b) - 1;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_pack(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b)
+{
+    const unsigned lanes = 4;
+    for (std::size_t block = 0; block < n; block += 128) {
+        std::fill(out, out + b * lanes, 0);
+        for (unsigned i = 0; i < 128; ++i) {
+            uint32_t v = in[block + i] & low_mask(b);
+            unsigned lane = i % lanes;
+            unsigned bit = (i / lanes) * b;
+            unsigned w = bit / 32, s = bit % 32;
+            out[w * lanes + lane] |= v << s;
+            if (s + b > 32)
+                out[(w + 1) * lanes + lane] |= v >> (32 - s);
+        }
+        out += b * lanes;
+    }
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_unpack(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b)
+{
+    const unsigned lanes = 4;
+    for (std::size_t block = 0; block < n; block += 128) {
+        for (unsigned i = 0; i < 128; ++i) {
+            unsigned lane = i % lanes;
+            unsigned bit = (i / lanes) * b;
+            unsigned w = bit / 32, s = bit % 32;
+            uint64_t v = in[w * lanes + lane] >> s;
+            if (s + b > 32)
+                v |= uint64_t(in[(w + 1) * lanes + lane]) << (32 - s);
+            out[block + i] = uint32_t(v) & low_mask(b);
+        }
+        in += b * lanes;
+    }
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_unpack_delta(uint32_t* out, const uint32_t* in, std::size_t n, unsigned b)
+{
+    scalar_unpack(out, in, n, b);
+    uint32_t prev = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        prev += out[i];
+        out[i] = prev;
+    }
+}
+
+template<class F>
+void run_bitpack(const std::string& name, const std::vector<uint32_t>& in,
+                 const std::vector<uint32_t>& ref, unsigned b, F fn)
+{
+    std::vector<uint32_t> out(ref.size());
+    double t = bench_min_time(num_repeats, [&]() {
+        fn(out.data(), in.data(), num_values, b);
+        bench_do_not_optimize(out[0]);
+    });
+    bench_report(std::cout, name + ", b=" + std::to_string(b), num_values, t, "value");
+    if (out != ref) {
+        std::cerr << "Results of " << name << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+int main()
+{
+    std::vector<BitpackKernels> kernels = bitpack_kernels();
+    std::sort(kernels.begin(), kernels.end(),
+              [](const BitpackKernels& a, const BitpackKernels& b)
+              { return std::uint32_t(a.arch) < std::uint32_t(b.arch); });
+    kernels.erase(std::remove_if(kernels.begin(), kernels.end(),
+                      [](const BitpackKernels& k)
+                      { return !simdpp::test_arch_subset(simdpp::detected_arch(), k.arch); }),
+                  kernels.end());
+
+    std::mt19937 gen(42);
+    const unsigned widths[] = { 1, 4, 8, 13, 20, 32 };
+
+    for (unsigned b : widths) {
+        std::vector<uint32_t> values(num_values);
+        for (uint32_t& v : values)
+            v = gen() & low_mask(b);
+        std::vector<uint32_t> packed(num_values / 32 * b);
+        scalar_pack(packed.data(), values.data(), num_values, b);
+
+        run_bitpack("pack, scalar", values, packed, b, scalar_pack);
+        for (const BitpackKernels& k : kernels)
+            run_bitpack(std::string("pack, ") + k.arch_name, values, packed, b, k.pack128);
+
+        run_bitpack("unpack, scalar", packed, values, b, scalar_unpack);
+        for (const BitpackKernels& k : kernels)
+            run_bitpack(std::string("unpack, ") + k.arch_name, packed, values, b, k.unpack128);
+
+        std::vector<uint32_t> sums(num_values);
+        scalar_unpack_delta(sums.data(), packed.data(), num_values, b);
+        run_bitpack("unpack delta, scalar", packed, sums, b, scalar_unpack_delta);
+        for (const BitpackKernels& k : kernels) {
+            run_bitpack(std::string("unpack delta, ") + k.arch_name, packed, sums, b,
+                        k.unpack_delta128);
+        }
+
+        // 256-value blocks use a different layout, thus pack the reference
+        // with the first kernel
+        if (!kernels.empty()) {
+            std::vector<uint32_t> packed256(packed.size());
+            for (std::size_t i = 0; i < num_values; i += 256) {
+                simdpp::bitpack<256>(packed256.data() + i / 32 * b, values.data() + i, b);
+            }
+            for (const BitpackKernels& k : kernels) {
+                run_bitpack(std::string("unpack 256, ") + k.arch_name, packed256,
+                            values, b, k.unpack256);
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
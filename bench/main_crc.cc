@@ -0,0 +1,101 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of CRC computation. Each of the dispatched kernels is compared
+    against a byte-at-a-time table-driven implementation on buffers of several
+    sizes. The throughput is reported in bytes per second.
+*/
+
+#include "crc/crc.h"
+#include "utils/bench_timer.h"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static const unsigned total_bytes = 1 << 22;
+static const unsigned num_repeats = 10;
+
+template<class T>
+struct CrcTable {
+    T t[256];
+
+    CrcTable(T rpoly)
+    {
+        for (unsigned b = 0; b < 256; ++b) {
+            T c = b;
+            for (unsigned i = 0; i < 8; ++i)
+                c = (c & 1) ? (c >> 1) ^ rpoly : c >> 1;
+            t[b] = c;
+        }
+    }
+};
+
+template<class T>
+#if __GNUC__
+__attribute__((noinline))
+#endif
+T scalar_crc(const CrcTable<T>& table, const uint8_t* p, std::size_t n)
+{
+    T crc = ~T(0);
+    for (std::size_t i = 0; i < n; ++i)
+        crc = T(crc >> 8) ^ table.t[(crc ^ p[i]) & 0xff];
+    return ~crc;
+}
+
+template<class T, class F, class G>
+void run_crc(const std::string& name, const std::vector<uint8_t>& data,
+             std::size_t block, F scalar, G simd)
+{
+    std::string desc = name + ", " + std::to_string(block) + " byte blocks";
+    T sum_ref = 0, sum_out = 0;
+    double t = bench_min_time(num_repeats, [&]() {
+        sum_ref = 0;
+        for (std::size_t i = 0; i < data.size(); i += block)
+            sum_ref ^= scalar(data.data() + i, block);
+        bench_do_not_optimize(sum_ref);
+    });
+    bench_report_bytes(std::cout, desc + ", scalar", double(data.size()), t);
+    t = bench_min_time(num_repeats, [&]() {
+        sum_out = 0;
+        for (std::size_t i = 0; i < data.size(); i += block)
+            sum_out ^= simd(data.data() + i, block);
+        bench_do_not_optimize(sum_out);
+    });
+    bench_report_bytes(std::cout, desc + ", simd", double(data.size()), t);
+    if (sum_ref != sum_out) {
+        std::cerr << "Results of " << desc << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    std::vector<uint8_t> data(total_bytes);
+    for (uint8_t& b : data)
+        b = uint8_t(gen());
+
+    CrcTable<uint32_t> t32(0xedb88320);
+    CrcTable<uint32_t> t32c(0x82f63b78);
+    CrcTable<uint64_t> t64(0xc96c5795d7870f42);
+
+    for (std::size_t block : { 64u, 512u, 4096u, total_bytes }) {
+        run_crc<uint32_t>("crc32", data, block,
+            [&](const uint8_t* p, std::size_t n) { return scalar_crc(t32, p, n); },
+            [&](const uint8_t* p, std::size_t n) { return bench_crc32(p, n); });
+        run_crc<uint32_t>("crc32c", data, block,
+            [&](const uint8_t* p, std::size_t n) { return scalar_crc(t32c, p, n); },
+            [&](const uint8_t* p, std::size_t n) { return bench_crc32c(p, n); });
+        run_crc<uint64_t>("crc64", data, block,
+            [&](const uint8_t* p, std::size_t n) { return scalar_crc(t64, p, n); },
+            [&](const uint8_t* p, std::size_t n) { return bench_crc64(p, n); });
+    }
+    return EXIT_SUCCESS;
+}
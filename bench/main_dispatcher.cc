@@ -0,0 +1,182 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Stress benchmark of the dispatcher. Measures:
+
+    - the time it takes for many threads to resolve freshly loaded dispatchers
+      when all of them call the dispatched functions at the same moment.
+
+    - the throughput of calls to an already resolved dispatcher as the number
+      of threads grows. Since no locks are taken on the hot path, the
+      throughput is expected to scale linearly with the number of cores.
+
+    - the overhead of a call to a tiny kernel through the default dispatcher,
+      through an IFUNC dispatcher, through a dispatcher with telemetry enabled
+      and through a plain function pointer.
+*/
+
+#include "dispatcher/dispatcher.h"
+#include "utils/bench_timer.h"
+#include <simdpp/simd.h>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+unsigned bench_direct_kernel(unsigned x)
+{
+    return x * 2654435761u;
+}
+
+static const unsigned num_calls = 20000000;
+
+unsigned run_cold_start_thread(const std::atomic<bool>& go)
+{
+    while (!go.load(std::memory_order_acquire)) {}
+
+    unsigned x = 1;
+    x = bench_dispatch_kernel<0>(x);
+    x = bench_dispatch_kernel<1>(x);
+    x = bench_dispatch_kernel<2>(x);
+    x = bench_dispatch_kernel<3>(x);
+    x = bench_dispatch_kernel<4>(x);
+    x = bench_dispatch_kernel<5>(x);
+    x = bench_dispatch_kernel<6>(x);
+    x = bench_dispatch_kernel<7>(x);
+    return x;
+}
+
+void bench_cold_start(unsigned num_threads)
+{
+    std::atomic<bool> go(false);
+    std::vector<unsigned> results(num_threads);
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i]() { results[i] = run_cold_start_thread(go); });
+    }
+
+    BenchTimer timer;
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads)
+        t.join();
+    double elapsed = timer.elapsed();
+
+    for (unsigned i = 1; i < num_threads; ++i) {
+        if (results[i] != results[0]) {
+            std::cerr << "Threads observed different results\n";
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    std::ostringstream name;
+    name << "cold start, 8 dispatchers, " << num_threads << " threads";
+    bench_report(std::cout, name.str(), 8 * num_threads, elapsed, "call");
+}
+
+template<class F>
+void bench_hot_calls(const char* desc, unsigned num_threads, F fun)
+{
+    std::atomic<bool> go(false);
+    std::atomic<unsigned> ready(0);
+    std::vector<double> times(num_threads);
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i]() {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {}
+            BenchTimer timer;
+            unsigned x = i;
+            for (unsigned j = 0; j < num_calls; ++j)
+                x = fun(x);
+            times[i] = timer.elapsed();
+            bench_do_not_optimize(x);
+        });
+    }
+    while (ready.load() != num_threads) {}
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads)
+        t.join();
+
+    double max_time = 0;
+    for (double t : times) {
+        if (t > max_time)
+            max_time = t;
+    }
+
+    std::ostringstream name;
+    name << desc << ", " << num_threads << " threads";
+    bench_report(std::cout, name.str(), double(num_calls) * num_threads,
+                 max_time, "call");
+}
+
+// The kernel is invoked directly by name where possible so that the compiler
+// emits exactly the call sequence that user code would get.
+template<class F>
+void bench_call_overhead_impl(const char* desc, F fun)
+{
+    unsigned x = 1;
+    double t = bench_min_time(5, [&]() {
+        for (unsigned j = 0; j < num_calls; ++j)
+            x = fun(x);
+    });
+    bench_do_not_optimize(x);
+    bench_report(std::cout, desc, num_calls, t, "call");
+}
+
+void bench_call_overhead(const char* desc, unsigned (*fun)(unsigned))
+{
+    if (fun == &bench_ptr_kernel) {
+        bench_call_overhead_impl(desc, [](unsigned x) { return bench_ptr_kernel(x); });
+    } else if (fun == &bench_telemetry_kernel) {
+        bench_call_overhead_impl(desc, [](unsigned x) { return bench_telemetry_kernel(x); });
+#if SIMDPP_DISPATCH_HAS_IFUNC
+    } else if (fun == &bench_ifunc_kernel) {
+        bench_call_overhead_impl(desc, [](unsigned x) { return bench_ifunc_kernel(x); });
+#endif
+    } else {
+        bench_call_overhead_impl(desc, fun);
+    }
+}
+
+int main()
+{
+    unsigned max_threads = std::thread::hardware_concurrency();
+    if (max_threads < 2)
+        max_threads = 2;
+
+    // must run first, while the dispatchers are still unresolved
+    bench_cold_start(max_threads);
+
+    for (unsigned n = 1; n <= max_threads; n *= 2) {
+        bench_hot_calls("dispatched call", n, [](unsigned x) {
+            return bench_dispatch_kernel<0>(x);
+        });
+    }
+
+    unsigned (* volatile direct_ptr)(unsigned) = &bench_direct_kernel;
+    unsigned (*direct)(unsigned) = direct_ptr;
+    for (unsigned n = 1; n <= max_threads; n *= 2) {
+        bench_hot_calls("plain indirect call", n, [direct](unsigned x) {
+            return direct(x);
+        });
+    }
+
+    bench_call_overhead("tiny kernel, plain indirect call", direct);
+    bench_call_overhead("tiny kernel, pointer dispatcher", &bench_ptr_kernel);
+    bench_call_overhead("tiny kernel, dispatcher with telemetry",
+                        &bench_telemetry_kernel);
+#if SIMDPP_DISPATCH_HAS_IFUNC
+    bench_call_overhead("tiny kernel, IFUNC dispatcher", &bench_ifunc_kernel);
+#endif
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,231 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of base64 and hex encoding and decoding. Each of the dispatched
+    kernels is compared against a table-driven scalar implementation on random
+    data. The throughput is reported in bytes of binary data per second.
+*/
+
+#include "encoding/encoding.h"
+#include "utils/bench_timer.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static const unsigned num_bytes = 1 << 20;
+static const unsigned num_repeats = 20;
+
+static const char base64_chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_base64_encode(const uint8_t* p, std::size_t n, char* out)
+{
+    std::size_t i = 0, o = 0;
+    for (; i + 3 <= n; i += 3, o += 4) {
+        uint32_t v = (uint32_t(p[i]) << 16) | (uint32_t(p[i+1]) << 8) | p[i+2];
+        out[o] = base64_chars[v >> 18];
+        out[o+1] = base64_chars[(v >> 12) & 0x3f];
+        out[o+2] = base64_chars[(v >> 6) & 0x3f];
+        out[o+3] = base64_chars[v & 0x3f];
+    }
+    if (i < n) {
+        uint32_t v = uint32_t(p[i]) << 16;
+        if (i + 1 < n)
+            v |= uint32_t(p[i+1]) << 8;
+        out[o++] = base64_chars[v >> 18];
+        out[o++] = base64_chars[(v >> 12) & 0x3f];
+        out[o++] = i + 1 < n ? base64_chars[(v >> 6) & 0x3f] : '=';
+        out[o++] = '=';
+    }
+    return o;
+}
+
+struct Base64Table {
+    int8_t v[256];
+
+    Base64Table()
+    {
+        std::memset(v, -1, sizeof(v));
+        for (int i = 0; i < 64; ++i)
+            v[(unsigned char) base64_chars[i]] = int8_t(i);
+    }
+};
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_base64_decode(const char* s, std::size_t n, uint8_t* out)
+{
+    static const Base64Table table;
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+    if (n % 4 != 0)
+        return std::size_t(-1);
+    std::size_t m = n;
+    if (m > 0 && p[m-1] == '=') --m;
+    if (m > 0 && p[m-1] == '=') --m;
+    std::size_t i = 0, o = 0;
+    for (; i + 4 <= m; i += 4, o += 3) {
+        int a = table.v[p[i]], b = table.v[p[i+1]],
+            c = table.v[p[i+2]], d = table.v[p[i+3]];
+        if ((a | b | c | d) < 0)
+            return std::size_t(-1);
+        uint32_t v = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | d;
+        out[o] = uint8_t(v >> 16);
+        out[o+1] = uint8_t(v >> 8);
+        out[o+2] = uint8_t(v);
+    }
+    if (i < m) {
+        int a = table.v[p[i]], b = table.v[p[i+1]];
+        int c = i + 3 == m ? table.v[p[i+2]] : 0;
+        if ((a | b | c) < 0)
+            return std::size_t(-1);
+        uint32_t v = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6);
+        out[o++] = uint8_t(v >> 16);
+        if (i + 3 == m)
+            out[o++] = uint8_t(v >> 8);
+    }
+    return o;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_hex_encode(const uint8_t* p, std::size_t n, char* out)
+{
+    static const char digits[] = "0123456789abcdef";
+    for (std::size_t i = 0; i < n; ++i) {
+        out[2*i] = digits[p[i] >> 4];
+        out[2*i+1] = digits[p[i] & 0x0f];
+    }
+    return 2 * n;
+}
+
+struct HexTable {
+    int8_t v[256];
+
+    HexTable()
+    {
+        std::memset(v, -1, sizeof(v));
+        for (int i = 0; i < 10; ++i)
+            v['0' + i] = int8_t(i);
+        for (int i = 0; i < 6; ++i) {
+            v['a' + i] = int8_t(10 + i);
+            v['A' + i] = int8_t(10 + i);
+        }
+    }
+};
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_hex_decode(const char* s, std::size_t n, uint8_t* out)
+{
+    static const HexTable table;
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+    if (n % 2 != 0)
+        return std::size_t(-1);
+    for (std::size_t i = 0; i < n; i += 2) {
+        int hi = table.v[p[i]], lo = table.v[p[i+1]];
+        if ((hi | lo) < 0)
+            return std::size_t(-1);
+        out[i / 2] = uint8_t((hi << 4) | lo);
+    }
+    return n / 2;
+}
+
+template<class F>
+void run(const std::string& desc, F fun)
+{
+    double t = bench_min_time(num_repeats, fun);
+    bench_report_bytes(std::cout, desc, double(num_bytes), t);
+}
+
+void check(const std::string& desc, bool ok)
+{
+    if (!ok) {
+        std::cerr << "Results of " << desc << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    std::vector<uint8_t> data(num_bytes);
+    for (uint8_t& b : data)
+        b = uint8_t(gen());
+
+    std::size_t n64 = (num_bytes + 2) / 3 * 4;
+    std::string ref(n64, '\0'), out(n64, '\0');
+    std::vector<uint8_t> dec(num_bytes);
+    std::size_t r = 0;
+
+    run("base64 encode, scalar", [&]() {
+        r = scalar_base64_encode(data.data(), num_bytes, &ref[0]);
+        bench_do_not_optimize(r);
+    });
+    run("base64 encode, simd", [&]() {
+        r = bench_base64_encode(data.data(), num_bytes, &out[0]);
+        bench_do_not_optimize(r);
+    });
+    check("base64 encode", r == n64 && ref == out);
+
+    run("base64 decode, scalar", [&]() {
+        r = scalar_base64_decode(ref.data(), n64, dec.data());
+        bench_do_not_optimize(r);
+    });
+    check("scalar base64 decode", r == num_bytes && dec == data);
+    dec.assign(num_bytes, 0);
+    run("base64 decode, simd", [&]() {
+        r = bench_base64_decode(ref.data(), n64, dec.data());
+        bench_do_not_optimize(r);
+    });
+    check("base64 decode", r == num_bytes && dec == data);
+
+    std::size_t n64url = (4 * num_bytes + 2) / 3;
+    run("base64url encode, simd", [&]() {
+        r = bench_base64url_encode(data.data(), num_bytes, &out[0]);
+        bench_do_not_optimize(r);
+    });
+    check("base64url encode", r == n64url);
+    dec.assign(num_bytes, 0);
+    run("base64url decode, simd", [&]() {
+        r = bench_base64url_decode(out.data(), n64url, dec.data());
+        bench_do_not_optimize(r);
+    });
+    check("base64url decode", r == num_bytes && dec == data);
+
+    std::string ref_hex(2 * num_bytes, '\0'), out_hex(2 * num_bytes, '\0');
+    run("hex encode, scalar", [&]() {
+        r = scalar_hex_encode(data.data(), num_bytes, &ref_hex[0]);
+        bench_do_not_optimize(r);
+    });
+    run("hex encode, simd", [&]() {
+        r = bench_hex_encode(data.data(), num_bytes, &out_hex[0]);
+        bench_do_not_optimize(r);
+    });
+    check("hex encode", ref_hex == out_hex);
+
+    run("hex decode, scalar", [&]() {
+        r = scalar_hex_decode(ref_hex.data(), 2 * num_bytes, dec.data());
+        bench_do_not_optimize(r);
+    });
+    dec.assign(num_bytes, 0);
+    run("hex decode, simd", [&]() {
+        r = bench_hex_decode(ref_hex.data(), 2 * num_bytes, dec.data());
+        bench_do_not_optimize(r);
+    });
+    check("hex decode", r == num_bytes && dec == data);
+    return EXIT_SUCCESS;
+}
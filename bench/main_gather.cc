@@ -0,0 +1,136 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of gather and scatter. Each of the dispatched kernels is compared
+    against the equivalent scalar loop. Two table sizes are used: one that fits
+    into the L1 cache, so that the cost of the instructions themselves
+    dominates, and one that does not fit into any cache, so that the latency
+    of memory accesses dominates.
+*/
+
+#include "gather/gather.h"
+#include "utils/bench_timer.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+static const unsigned num_items = 1 << 20;
+static const unsigned num_repeats = 10;
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+uint32_t scalar_gather_sum_u32(const uint32_t* table, const uint32_t* idx,
+                               unsigned n)
+{
+    uint32_t sum = 0;
+    for (unsigned i = 0; i < n; ++i)
+        sum += table[idx[i]];
+    return sum;
+}
+
+template<class T, class I>
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_gather(T* out, const T* table, const I* idx, unsigned n)
+{
+    for (unsigned i = 0; i < n; ++i)
+        out[i] = table[idx[i]];
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_scatter_f32(float* table, const uint32_t* idx, const float* in,
+                        unsigned n)
+{
+    for (unsigned i = 0; i < n; ++i)
+        table[idx[i]] = in[i];
+}
+
+template<class I>
+std::vector<I> make_indices(unsigned table_size)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<unsigned> dist(0, table_size - 1);
+    std::vector<I> r(num_items);
+    for (auto& i : r)
+        i = dist(gen);
+    return r;
+}
+
+template<class F>
+void run(const char* desc, unsigned table_size, F fun)
+{
+    double t = bench_min_time(num_repeats, fun);
+    std::ostringstream name;
+    name << desc << ", table " << table_size;
+    bench_report(std::cout, name.str(), num_items, t, "elem");
+}
+
+void bench_table(unsigned table_size)
+{
+    std::vector<uint32_t> idx32 = make_indices<uint32_t>(table_size);
+    std::vector<uint64_t> idx64 = make_indices<uint64_t>(table_size);
+    std::vector<uint32_t> table_u32(table_size);
+    std::vector<float> table_f32(table_size);
+    std::vector<double> table_f64(table_size);
+    for (unsigned i = 0; i < table_size; ++i) {
+        table_u32[i] = i;
+        table_f32[i] = float(i);
+        table_f64[i] = double(i);
+    }
+    std::vector<float> out_f32(num_items);
+    std::vector<double> out_f64(num_items);
+
+    uint32_t sum_scalar = 0, sum_simd = 0;
+    run("gather sum u32, scalar", table_size, [&]() {
+        sum_scalar = scalar_gather_sum_u32(table_u32.data(), idx32.data(),
+                                           num_items);
+    });
+    run("gather sum u32, simd", table_size, [&]() {
+        sum_simd = bench_gather_sum_u32(table_u32.data(), idx32.data(),
+                                        num_items);
+    });
+    if (sum_scalar != sum_simd) {
+        std::cerr << "Results of gather sum differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    run("gather f32, scalar", table_size, [&]() {
+        scalar_gather(out_f32.data(), table_f32.data(), idx32.data(), num_items);
+    });
+    run("gather f32, simd", table_size, [&]() {
+        bench_gather_f32(out_f32.data(), table_f32.data(), idx32.data(), num_items);
+    });
+    run("gather f64, scalar", table_size, [&]() {
+        scalar_gather(out_f64.data(), table_f64.data(), idx64.data(), num_items);
+    });
+    run("gather f64, simd", table_size, [&]() {
+        bench_gather_f64(out_f64.data(), table_f64.data(), idx64.data(), num_items);
+    });
+
+    run("scatter f32, scalar", table_size, [&]() {
+        scalar_scatter_f32(table_f32.data(), idx32.data(), out_f32.data(),
+                           num_items);
+    });
+    run("scatter f32, simd", table_size, [&]() {
+        bench_scatter_f32(table_f32.data(), idx32.data(), out_f32.data(),
+                          num_items);
+    });
+    bench_do_not_optimize(table_f32);
+}
+
+int main()
+{
+    bench_table(4096);
+    bench_table(1 << 24);
+    return EXIT_SUCCESS;
+}
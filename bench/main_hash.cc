@@ -0,0 +1,166 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of batch hashing of hash table keys. Each of the hash functions
+    is run for every compiled instruction set that is supported by the current
+    processor and compared against a scalar loop. The throughput is reported
+    in keys per second. The keys fit into the L2 cache.
+*/
+
+#include "hash/hash.h"
+#include "utils/bench_timer.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static const unsigned num_keys = 1 << 14;
+static const unsigned num_repeats = 200;
+
+std::vector<HashKernels>& hash_kernels()
+{
+    static std::vector<HashKernels> kernels;
+    return kernels;
+}
+
+static uint32_t rotl32(uint32_t x, unsigned c) { return (x << c) | (x >> (32 - c)); }
+static uint64_t rotl64(uint64_t x, unsigned c) { return (x << c) | (x >> (64 - c)); }
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_fmix32(uint32_t* out, const uint32_t* keys, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        uint32_t h = keys[i];
+        h ^= h >> 16; h *= 0x85ebca6b;
+        h ^= h >> 13; h *= 0xc2b2ae35;
+        h ^= h >> 16;
+        out[i] = h;
+    }
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_fmix64(uint64_t* out, const uint64_t* keys, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        uint64_t h = keys[i];
+        h ^= h >> 33; h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        out[i] = h;
+    }
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_xxh32(uint32_t* out, const uint32_t* keys, std::size_t n, uint32_t seed)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        uint32_t h = seed + 0x165667b1u + 4 + keys[i] * 0xc2b2ae3du;
+        h = rotl32(h, 17) * 0x27d4eb2fu;
+        h ^= h >> 15; h *= 0x85ebca77u;
+        h ^= h >> 13; h *= 0xc2b2ae3du;
+        h ^= h >> 16;
+        out[i] = h;
+    }
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void scalar_xxh64(uint64_t* out, const uint64_t* keys, std::size_t n, uint64_t seed)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        uint64_t k = rotl64(keys[i] * 0xc2b2ae3d27d4eb4full, 31) * 0x9e3779b185ebca87ull;
+        uint64_t h = (seed + 0x27d4eb2f165667c5ull + 8) ^ k;
+        h = rotl64(h, 27) * 0x9e3779b185ebca87ull + 0x85ebca77c2b2ae63ull;
+        h ^= h >> 33; h *= 0xc2b2ae3d27d4eb4full;
+        h ^= h >> 29; h *= 0x165667b19e3779f9ull;
+        h ^= h >> 32;
+        out[i] = h;
+    }
+}
+
+template<class T, class F>
+void run_hash(const std::string& name, const std::vector<T>& keys,
+              const std::vector<T>& ref, F fn)
+{
+    std::vector<T> out(keys.size());
+    double t = bench_min_time(num_repeats, [&]() {
+        fn(out.data(), keys.data(), keys.size());
+        bench_do_not_optimize(out[0]);
+    });
+    bench_report(std::cout, name, double(keys.size()), t, "key");
+    if (out != ref) {
+        std::cerr << "Results of " << name << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+int main()
+{
+    std::mt19937_64 gen(42);
+    std::vector<uint32_t> keys32(num_keys);
+    std::vector<uint64_t> keys64(num_keys);
+    for (unsigned i = 0; i < num_keys; ++i) {
+        keys64[i] = gen();
+        keys32[i] = uint32_t(keys64[i] >> 32);
+    }
+    const uint32_t seed32 = 0x9747b28c;
+    const uint64_t seed64 = 0x9747b28c9747b28cull;
+
+    std::vector<HashKernels> kernels = hash_kernels();
+    std::sort(kernels.begin(), kernels.end(),
+              [](const HashKernels& a, const HashKernels& b)
+              { return std::uint32_t(a.arch) < std::uint32_t(b.arch); });
+    kernels.erase(std::remove_if(kernels.begin(), kernels.end(),
+                      [](const HashKernels& k)
+                      { return !simdpp::test_arch_subset(simdpp::detected_arch(), k.arch); }),
+                  kernels.end());
+
+    std::vector<uint32_t> ref32(num_keys);
+    std::vector<uint64_t> ref64(num_keys);
+
+    scalar_fmix32(ref32.data(), keys32.data(), num_keys);
+    run_hash("fmix32, scalar", keys32, ref32, scalar_fmix32);
+    for (const HashKernels& k : kernels)
+        run_hash(std::string("fmix32, ") + k.arch_name, keys32, ref32, k.fmix32);
+
+    scalar_fmix64(ref64.data(), keys64.data(), num_keys);
+    run_hash("fmix64, scalar", keys64, ref64, scalar_fmix64);
+    for (const HashKernels& k : kernels)
+        run_hash(std::string("fmix64, ") + k.arch_name, keys64, ref64, k.fmix64);
+
+    auto xxh32_ref = [&](uint32_t* o, const uint32_t* i, std::size_t n)
+                     { scalar_xxh32(o, i, n, seed32); };
+    xxh32_ref(ref32.data(), keys32.data(), num_keys);
+    run_hash("xxh32, scalar", keys32, ref32, xxh32_ref);
+    for (const HashKernels& k : kernels) {
+        run_hash(std::string("xxh32, ") + k.arch_name, keys32, ref32,
+                 [&](uint32_t* o, const uint32_t* i, std::size_t n)
+                 { k.xxh32(o, i, n, seed32); });
+    }
+
+    auto xxh64_ref = [&](uint64_t* o, const uint64_t* i, std::size_t n)
+                     { scalar_xxh64(o, i, n, seed64); };
+    xxh64_ref(ref64.data(), keys64.data(), num_keys);
+    run_hash("xxh64, scalar", keys64, ref64, xxh64_ref);
+    for (const HashKernels& k : kernels) {
+        run_hash(std::string("xxh64, ") + k.arch_name, keys64, ref64,
+                 [&](uint64_t* o, const uint64_t* i, std::size_t n)
+                 { k.xxh64(o, i, n, seed64); });
+    }
+    return EXIT_SUCCESS;
+}
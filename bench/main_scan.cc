@@ -0,0 +1,121 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of the array prefix sums. Each of the dispatched kernels is
+    compared against the standard library. std::inclusive_scan and
+    std::exclusive_scan are used when compiling as C++17, otherwise
+    std::partial_sum, which computes the same result, is used as the
+    reference.
+*/
+
+#include "scan/scan.h"
+#include "utils/bench_timer.h"
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+static const unsigned num_items = 1 << 20;
+static const unsigned num_repeats = 10;
+
+template<class T>
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void std_inclusive_scan(T* dst, const T* src, unsigned n)
+{
+#if __cplusplus >= 201703L
+    std::inclusive_scan(src, src + n, dst);
+#else
+    std::partial_sum(src, src + n, dst);
+#endif
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+void std_exclusive_scan_u32(uint32_t* dst, const uint32_t* src, unsigned n)
+{
+#if __cplusplus >= 201703L
+    std::exclusive_scan(src, src + n, dst, uint32_t(0));
+#else
+    uint32_t sum = 0;
+    for (unsigned i = 0; i < n; ++i) {
+        uint32_t a = src[i];
+        dst[i] = sum;
+        sum += a;
+    }
+#endif
+}
+
+template<class F>
+void run(const char* desc, unsigned elem_size, F fun)
+{
+    double t = bench_min_time(num_repeats, fun);
+    bench_report_bytes(std::cout, desc, num_items * elem_size, t);
+}
+
+template<class T>
+void check(const char* desc, const std::vector<T>& a, const std::vector<T>& b)
+{
+    if (a != b) {
+        std::cerr << "Results of " << desc << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+int main()
+{
+    std::vector<uint32_t> src_u32(num_items);
+    std::vector<uint64_t> src_u64(num_items);
+    std::vector<float> src_f32(num_items);
+    for (unsigned i = 0; i < num_items; ++i) {
+        src_u32[i] = (i * 2654435761u) >> 20;
+        src_u64[i] = src_u32[i];
+        // small integers keep the float sums exact
+        src_f32[i] = float(i % 3);
+    }
+    std::vector<uint32_t> ref_u32(num_items), out_u32(num_items);
+    std::vector<uint64_t> ref_u64(num_items), out_u64(num_items);
+    std::vector<float> ref_f32(num_items / 16), out_f32(num_items / 16);
+
+    run("inclusive scan u32, std", 4, [&]() {
+        std_inclusive_scan(ref_u32.data(), src_u32.data(), num_items);
+    });
+    run("inclusive scan u32, simd", 4, [&]() {
+        bench_scan_add_u32(out_u32.data(), src_u32.data(), num_items);
+    });
+    check("inclusive scan u32", ref_u32, out_u32);
+
+    run("inclusive scan u64, std", 8, [&]() {
+        std_inclusive_scan(ref_u64.data(), src_u64.data(), num_items);
+    });
+    run("inclusive scan u64, simd", 8, [&]() {
+        bench_scan_add_u64(out_u64.data(), src_u64.data(), num_items);
+    });
+    check("inclusive scan u64", ref_u64, out_u64);
+
+    // the float sums stay exact only while they are below 2^24
+    run("inclusive scan f32, std", 4, [&]() {
+        for (unsigned i = 0; i < 16; ++i)
+            std_inclusive_scan(ref_f32.data(), src_f32.data(), num_items / 16);
+    });
+    run("inclusive scan f32, simd", 4, [&]() {
+        for (unsigned i = 0; i < 16; ++i)
+            bench_scan_add_f32(out_f32.data(), src_f32.data(), num_items / 16);
+    });
+    check("inclusive scan f32", ref_f32, out_f32);
+
+    run("exclusive scan u32, std", 4, [&]() {
+        std_exclusive_scan_u32(ref_u32.data(), src_u32.data(), num_items);
+    });
+    run("exclusive scan u32, simd", 4, [&]() {
+        bench_scan_add_exclusive_u32(out_u32.data(), src_u32.data(), num_items);
+    });
+    check("exclusive scan u32", ref_u32, out_u32);
+    return EXIT_SUCCESS;
+}
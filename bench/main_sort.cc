@@ -0,0 +1,103 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of the array sort. Each of the dispatched kernels is compared
+    against std::sort on the same uniformly distributed random input. The
+    input is copied before each run, which is included in both timings.
+*/
+
+#include "sort/sort.h"
+#include "utils/bench_timer.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+static const unsigned num_items = 1 << 20;
+static const unsigned num_repeats = 10;
+
+template<class T>
+std::vector<T> make_input()
+{
+    std::mt19937_64 gen(42);
+    std::vector<T> r(num_items);
+    for (auto& x : r) {
+        uint64_t v = gen();
+        x = std::is_floating_point<T>::value ? T(int64_t(v >> 16) - (int64_t(1) << 47))
+                                             : T(v);
+    }
+    return r;
+}
+
+template<class T, class F>
+void run(const char* type, F simd_sort)
+{
+    std::vector<T> input = make_input<T>();
+    std::vector<T> ref, out;
+
+    double t = bench_min_time(num_repeats, [&]() {
+        ref = input;
+        std::sort(ref.begin(), ref.end());
+    });
+    bench_report(std::cout, std::string("sort ") + type + ", std::sort", num_items, t, "elem");
+
+    t = bench_min_time(num_repeats, [&]() {
+        out = input;
+        simd_sort(out.data(), num_items);
+    });
+    bench_report(std::cout, std::string("sort ") + type + ", simd", num_items, t, "elem");
+
+    if (ref != out) {
+        std::cerr << "Results of sort " << type << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+void run_pairs()
+{
+    std::vector<uint32_t> keys = make_input<uint32_t>();
+    std::vector<uint32_t> values(num_items);
+    for (unsigned i = 0; i < num_items; ++i)
+        values[i] = i;
+
+    std::vector<std::pair<uint32_t, uint32_t>> ref;
+    double t = bench_min_time(num_repeats, [&]() {
+        ref.resize(num_items);
+        for (unsigned i = 0; i < num_items; ++i)
+            ref[i] = std::make_pair(keys[i], values[i]);
+        std::sort(ref.begin(), ref.end());
+    });
+    bench_report(std::cout, "sort u32 pairs, std::sort", num_items, t, "elem");
+
+    std::vector<uint32_t> out_keys, out_values;
+    t = bench_min_time(num_repeats, [&]() {
+        out_keys = keys;
+        out_values = values;
+        bench_sort_pairs_u32(out_keys.data(), out_values.data(), num_items);
+    });
+    bench_report(std::cout, "sort u32 pairs, simd", num_items, t, "elem");
+
+    for (unsigned i = 0; i < num_items; ++i) {
+        if (ref[i].first != out_keys[i] || ref[i].second != out_values[i]) {
+            std::cerr << "Results of sort u32 pairs differ\n";
+            std::exit(EXIT_FAILURE);
+        }
+    }
+}
+
+int main()
+{
+    run<int32_t>("i32", bench_sort_i32);
+    run<uint32_t>("u32", bench_sort_u32);
+    run<float>("f32", bench_sort_f32);
+    run<int64_t>("i64", bench_sort_i64);
+    run<double>("f64", bench_sort_f64);
+    run_pairs();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,260 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of UTF-8 validation and transcoding. Each of the dispatched
+    kernels is compared against a straightforward scalar implementation on
+    generated text of several scripts. The throughput is reported in bytes of
+    UTF-8 processed per second.
+*/
+
+#include "utf8/utf8.h"
+#include "utils/bench_timer.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static const unsigned num_chars = 1 << 20;
+static const unsigned num_repeats = 10;
+
+/*  Generates text of words of 3 to 8 characters from [first, first + count)
+    separated by spaces. In the latin text every 10th character is replaced
+    by an accented letter.
+*/
+std::vector<uint32_t> make_text(uint32_t first, uint32_t count, bool latin)
+{
+    std::mt19937 gen(42);
+    std::vector<uint32_t> r;
+    while (r.size() < num_chars) {
+        unsigned len = 3 + gen() % 6;
+        for (unsigned i = 0; i < len; ++i) {
+            uint32_t c = first + gen() % count;
+            if (latin && gen() % 10 == 0)
+                c = 0xe0 + gen() % 0x20;
+            r.push_back(c);
+        }
+        r.push_back(' ');
+    }
+    return r;
+}
+
+std::string encode_utf8(const std::vector<uint32_t>& cps)
+{
+    std::string r;
+    for (uint32_t cp : cps) {
+        if (cp < 0x80) {
+            r += char(cp);
+        } else if (cp < 0x800) {
+            r += char(0xc0 | (cp >> 6));
+            r += char(0x80 | (cp & 0x3f));
+        } else if (cp < 0x10000) {
+            r += char(0xe0 | (cp >> 12));
+            r += char(0x80 | ((cp >> 6) & 0x3f));
+            r += char(0x80 | (cp & 0x3f));
+        } else {
+            r += char(0xf0 | (cp >> 18));
+            r += char(0x80 | ((cp >> 12) & 0x3f));
+            r += char(0x80 | ((cp >> 6) & 0x3f));
+            r += char(0x80 | (cp & 0x3f));
+        }
+    }
+    return r;
+}
+
+// Decodes one sequence. Returns its length or zero if it's invalid
+unsigned scalar_decode(const unsigned char* p, std::size_t n, uint32_t& cp)
+{
+    unsigned b0 = p[0];
+    unsigned len;
+    uint32_t min;
+    if (b0 < 0x80) { cp = b0; return 1; }
+    else if (b0 < 0xc2) return 0;
+    else if (b0 < 0xe0) { len = 2; cp = b0 & 0x1f; min = 0x80; }
+    else if (b0 < 0xf0) { len = 3; cp = b0 & 0x0f; min = 0x800; }
+    else if (b0 < 0xf5) { len = 4; cp = b0 & 0x07; min = 0x10000; }
+    else return 0;
+    if (n < len)
+        return 0;
+    for (unsigned k = 1; k < len; ++k) {
+        if ((p[k] & 0xc0) != 0x80)
+            return 0;
+        cp = (cp << 6) | (p[k] & 0x3f);
+    }
+    if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+        return 0;
+    return len;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+bool scalar_utf8_validate(const char* s, std::size_t n)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+    std::size_t i = 0;
+    while (i < n) {
+        uint32_t cp;
+        unsigned len = scalar_decode(p + i, n - i, cp);
+        if (len == 0)
+            return false;
+        i += len;
+    }
+    return true;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_utf8_to_utf16(const char* s, std::size_t n, char16_t* out)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+    std::size_t i = 0, o = 0;
+    while (i < n) {
+        uint32_t cp;
+        unsigned len = scalar_decode(p + i, n - i, cp);
+        if (len == 0)
+            return std::size_t(-1);
+        i += len;
+        if (cp < 0x10000) {
+            out[o++] = char16_t(cp);
+        } else {
+            out[o++] = char16_t(0xd800 + ((cp - 0x10000) >> 10));
+            out[o++] = char16_t(0xdc00 + ((cp - 0x10000) & 0x3ff));
+        }
+    }
+    return o;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_utf8_to_utf32(const char* s, std::size_t n, char32_t* out)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+    std::size_t i = 0, o = 0;
+    while (i < n) {
+        uint32_t cp;
+        unsigned len = scalar_decode(p + i, n - i, cp);
+        if (len == 0)
+            return std::size_t(-1);
+        i += len;
+        out[o++] = char32_t(cp);
+    }
+    return o;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_utf16_to_utf8(const char16_t* s, std::size_t n, char* out)
+{
+    std::size_t i = 0, o = 0;
+    while (i < n) {
+        uint32_t cp = s[i++];
+        if (cp >= 0xd800 && cp <= 0xdfff) {
+            if (cp > 0xdbff || i == n || s[i] < 0xdc00 || s[i] > 0xdfff)
+                return std::size_t(-1);
+            cp = 0x10000 + ((cp - 0xd800) << 10) + (s[i++] - 0xdc00);
+        }
+        if (cp < 0x80) {
+            out[o++] = char(cp);
+        } else if (cp < 0x800) {
+            out[o++] = char(0xc0 | (cp >> 6));
+            out[o++] = char(0x80 | (cp & 0x3f));
+        } else if (cp < 0x10000) {
+            out[o++] = char(0xe0 | (cp >> 12));
+            out[o++] = char(0x80 | ((cp >> 6) & 0x3f));
+            out[o++] = char(0x80 | (cp & 0x3f));
+        } else {
+            out[o++] = char(0xf0 | (cp >> 18));
+            out[o++] = char(0x80 | ((cp >> 12) & 0x3f));
+            out[o++] = char(0x80 | ((cp >> 6) & 0x3f));
+            out[o++] = char(0x80 | (cp & 0x3f));
+        }
+    }
+    return o;
+}
+
+template<class F>
+void run(const std::string& desc, std::size_t bytes, F fun)
+{
+    double t = bench_min_time(num_repeats, fun);
+    bench_report_bytes(std::cout, desc, double(bytes), t);
+}
+
+template<class T>
+void check(const std::string& desc, std::size_t n_ref, const std::vector<T>& ref,
+           std::size_t n_out, const std::vector<T>& out)
+{
+    if (n_ref != n_out || !std::equal(ref.begin(), ref.begin() + n_ref, out.begin())) {
+        std::cerr << "Results of " << desc << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+void run_text(const char* name, const std::vector<uint32_t>& cps)
+{
+    std::string s = encode_utf8(cps);
+    std::size_t n = s.size();
+    std::string prefix = std::string(name) + ": ";
+
+    bool v_ref = false, v_out = false;
+    run(prefix + "validate, scalar", n, [&]() {
+        v_ref = scalar_utf8_validate(s.data(), n);
+        bench_do_not_optimize(v_ref);
+    });
+    run(prefix + "validate, simd", n, [&]() {
+        v_out = bench_utf8_validate(s.data(), n);
+        bench_do_not_optimize(v_out);
+    });
+    if (!v_ref || !v_out) {
+        std::cerr << "Validation of " << name << " failed\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    std::vector<char16_t> ref16(n), out16(n);
+    std::size_t n_ref = 0, n_out = 0;
+    run(prefix + "utf8 to utf16, scalar", n, [&]() {
+        n_ref = scalar_utf8_to_utf16(s.data(), n, ref16.data());
+    });
+    run(prefix + "utf8 to utf16, simd", n, [&]() {
+        n_out = bench_utf8_to_utf16(s.data(), n, out16.data());
+    });
+    check(prefix + "utf8 to utf16", n_ref, ref16, n_out, out16);
+    std::size_t n16 = n_ref;
+
+    std::vector<char32_t> ref32(n), out32(n);
+    run(prefix + "utf8 to utf32, scalar", n, [&]() {
+        n_ref = scalar_utf8_to_utf32(s.data(), n, ref32.data());
+    });
+    run(prefix + "utf8 to utf32, simd", n, [&]() {
+        n_out = bench_utf8_to_utf32(s.data(), n, out32.data());
+    });
+    check(prefix + "utf8 to utf32", n_ref, ref32, n_out, out32);
+
+    std::vector<char> ref8(n), out8(n);
+    run(prefix + "utf16 to utf8, scalar", n, [&]() {
+        n_ref = scalar_utf16_to_utf8(ref16.data(), n16, ref8.data());
+    });
+    run(prefix + "utf16 to utf8, simd", n, [&]() {
+        n_out = bench_utf16_to_utf8(ref16.data(), n16, out8.data());
+    });
+    check(prefix + "utf16 to utf8", n_ref, ref8, n_out, out8);
+}
+
+int main()
+{
+    run_text("ascii", make_text('a', 26, false));
+    run_text("latin", make_text('a', 26, true));
+    run_text("cyrillic", make_text(0x430, 32, false));
+    run_text("cjk", make_text(0x4e00, 0x5000, false));
+    run_text("emoji", make_text(0x1f600, 0x50, false));
+    return EXIT_SUCCESS;
+}
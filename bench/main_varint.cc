@@ -0,0 +1,242 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*  Benchmark of Stream VByte and varint encoding and decoding of integers.
+    The kernels are run for every compiled instruction set that is supported
+    by the current processor and compared against scalar loops that process
+    one value at a time. The values have a random number of significant bits
+    up to the given maximum. The throughput is reported in values per second.
+*/
+
+#include "varint/varint.h"
+#include "utils/bench_timer.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static const unsigned num_values = 1 << 14;
+static const unsigned num_repeats = 200;
+
+std::vector<VarintKernels>& varint_kernels()
+{
+    static std::vector<VarintKernels> kernels;
+    return kernels;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_svb_encode(uint8_t* out, const uint32_t* in, std::size_t n)
+{
+    uint8_t* ctrl = out;
+    uint8_t* data = out + (n + 3) / 4;
+    std::fill(ctrl, data, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        uint32_t x = in[i];
+        unsigned code = (x > 0xff) + (x > 0xffff) + (x > 0xffffff);
+        for (unsigned b = 0; b <= code; ++b)
+            *data++ = uint8_t(x >> (8 * b));
+        ctrl[i / 4] |= code << (2 * (i % 4));
+    }
+    return data - out;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_svb_decode(uint32_t* out, const uint8_t* in, std::size_t, std::size_t n)
+{
+    const uint8_t* data = in + (n + 3) / 4;
+    for (std::size_t i = 0; i < n; ++i) {
+        unsigned code = (in[i / 4] >> (2 * (i % 4))) & 3;
+        uint32_t x = 0;
+        for (unsigned b = 0; b <= code; ++b)
+            x |= uint32_t(*data++) << (8 * b);
+        out[i] = x;
+    }
+    return data - in;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_svb_decode_delta(uint32_t* out, const uint8_t* in, std::size_t size,
+                                    std::size_t n)
+{
+    std::size_t r = scalar_svb_decode(out, in, size, n);
+    uint32_t prev = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        prev += out[i];
+        out[i] = prev;
+    }
+    return r;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_varint_encode32(uint8_t* out, const uint32_t* in, std::size_t n)
+{
+    uint8_t* p = out;
+    for (std::size_t i = 0; i < n; ++i) {
+        uint32_t x = in[i];
+        while (x >= 0x80) {
+            *p++ = uint8_t(x | 0x80);
+            x >>= 7;
+        }
+        *p++ = uint8_t(x);
+    }
+    return p - out;
+}
+
+template<class T>
+std::size_t scalar_varint_decode(T* out, const uint8_t* in, std::size_t size)
+{
+    std::size_t o = 0;
+    for (std::size_t i = 0; i < size; ) {
+        T x = 0;
+        unsigned shift = 0;
+        uint8_t b;
+        do {
+            b = in[i++];
+            x |= T(b & 0x7f) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        out[o++] = x;
+    }
+    return o;
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_varint_decode32(uint32_t* out, const uint8_t* in, std::size_t size)
+{
+    return scalar_varint_decode(out, in, size);
+}
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+std::size_t scalar_varint_decode64(uint64_t* out, const uint8_t* in, std::size_t size)
+{
+    return scalar_varint_decode(out, in, size);
+}
+
+/*  Runs fn, which writes to the buffer of the given capacity and returns
+    fn_result, and checks that the output starts with ref.
+*/
+template<class T, class F>
+void run_varint(const std::string& name, const std::vector<T>& ref,
+                std::size_t capacity, std::size_t fn_result, F fn)
+{
+    std::vector<T> out(capacity);
+    std::size_t r = 0;
+    double t = bench_min_time(num_repeats, [&]() {
+        r = fn(out.data());
+        bench_do_not_optimize(out[0]);
+    });
+    bench_report(std::cout, name, num_values, t, "value");
+    if (r != fn_result || !std::equal(ref.begin(), ref.end(), out.begin())) {
+        std::cerr << "Results of " << name << " differ\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+int main()
+{
+    std::vector<VarintKernels> kernels = varint_kernels();
+    std::sort(kernels.begin(), kernels.end(),
+              [](const VarintKernels& a, const VarintKernels& b)
+              { return std::uint32_t(a.arch) < std::uint32_t(b.arch); });
+    kernels.erase(std::remove_if(kernels.begin(), kernels.end(),
+                      [](const VarintKernels& k)
+                      { return !simdpp::test_arch_subset(simdpp::detected_arch(), k.arch); }),
+                  kernels.end());
+
+    std::mt19937 gen(42);
+    const unsigned max_bits[] = { 7, 14, 32 };
+
+    for (unsigned bits : max_bits) {
+        std::vector<uint32_t> values(num_values);
+        for (uint32_t& v : values) {
+            unsigned b = gen() % (bits + 1);
+            v = b == 0 ? 0 : gen() >> (32 - b);
+        }
+        std::vector<uint64_t> values64(values.begin(), values.end());
+        std::string suffix = ", bits<=" + std::to_string(bits);
+
+        std::vector<uint8_t> svb(simdpp::streamvbyte_max_size(num_values));
+        svb.resize(scalar_svb_encode(svb.data(), values.data(), num_values));
+        std::vector<uint8_t> vb(5 * num_values);
+        vb.resize(scalar_varint_encode32(vb.data(), values.data(), num_values));
+        const std::size_t svb_capacity = simdpp::streamvbyte_max_size(num_values);
+
+        run_varint("svb encode, scalar" + suffix, svb, svb_capacity, svb.size(),
+                   [&](uint8_t* out)
+                   { return scalar_svb_encode(out, values.data(), num_values); });
+        for (const VarintKernels& k : kernels) {
+            run_varint(std::string("svb encode, ") + k.arch_name + suffix, svb,
+                       svb_capacity, svb.size(),
+                       [&](uint8_t* out) { return k.svb_encode(out, values.data(), num_values); });
+        }
+
+        run_varint("svb decode, scalar" + suffix, values, num_values, svb.size(),
+                   [&](uint32_t* out)
+                   { return scalar_svb_decode(out, svb.data(), svb.size(), num_values); });
+        for (const VarintKernels& k : kernels) {
+            run_varint(std::string("svb decode, ") + k.arch_name + suffix, values,
+                       num_values, svb.size(), [&](uint32_t* out)
+                       { return k.svb_decode(out, svb.data(), svb.size(), num_values); });
+        }
+
+        std::vector<uint32_t> sums(num_values);
+        scalar_svb_decode_delta(sums.data(), svb.data(), svb.size(), num_values);
+        run_varint("svb decode delta, scalar" + suffix, sums, num_values, svb.size(),
+                   [&](uint32_t* out)
+                   { return scalar_svb_decode_delta(out, svb.data(), svb.size(), num_values); });
+        for (const VarintKernels& k : kernels) {
+            run_varint(std::string("svb decode delta, ") + k.arch_name + suffix, sums,
+                       num_values, svb.size(), [&](uint32_t* out)
+                       { return k.svb_decode_delta(out, svb.data(), svb.size(), num_values); });
+        }
+
+        run_varint("varint encode 32, scalar" + suffix, vb, 5 * num_values, vb.size(),
+                   [&](uint8_t* out)
+                   { return scalar_varint_encode32(out, values.data(), num_values); });
+        for (const VarintKernels& k : kernels) {
+            run_varint(std::string("varint encode 32, ") + k.arch_name + suffix, vb,
+                       5 * num_values, vb.size(), [&](uint8_t* out)
+                       { return k.varint_encode32(out, values.data(), num_values); });
+        }
+
+        // the decoders may write up to one value per input byte
+        run_varint("varint decode 32, scalar" + suffix, values, vb.size(), num_values,
+                   [&](uint32_t* out)
+                   { return scalar_varint_decode32(out, vb.data(), vb.size()); });
+        for (const VarintKernels& k : kernels) {
+            run_varint(std::string("varint decode 32, ") + k.arch_name + suffix, values,
+                       vb.size(), num_values, [&](uint32_t* out)
+                       { return k.varint_decode32(out, vb.data(), vb.size()); });
+        }
+
+        run_varint("varint decode 64, scalar" + suffix, values64, vb.size(), num_values,
+                   [&](uint64_t* out)
+                   { return scalar_varint_decode64(out, vb.data(), vb.size()); });
+        for (const VarintKernels& k : kernels) {
+            run_varint(std::string("varint decode 64, ") + k.arch_name + suffix, values64,
+                       vb.size(), num_values, [&](uint64_t* out)
+                       { return k.varint_decode64(out, vb.data(), vb.size()); });
+        }
+    }
+    return EXIT_SUCCESS;
+}
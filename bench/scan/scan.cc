@@ -0,0 +1,45 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "scan.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+uint32_t bench_scan_add_u32(uint32_t* dst, const uint32_t* src, unsigned n)
+{
+    return scan_add(dst, src, n);
+}
+
+uint64_t bench_scan_add_u64(uint64_t* dst, const uint64_t* src, unsigned n)
+{
+    return scan_add(dst, src, n);
+}
+
+float bench_scan_add_f32(float* dst, const float* src, unsigned n)
+{
+    return scan_add(dst, src, n);
+}
+
+uint32_t bench_scan_add_exclusive_u32(uint32_t* dst, const uint32_t* src,
+                                      unsigned n)
+{
+    return scan_add_exclusive(dst, src, n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((uint32_t)(bench_scan_add_u32)
+                       ((uint32_t*) dst, (const uint32_t*) src, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((uint64_t)(bench_scan_add_u64)
+                       ((uint64_t*) dst, (const uint64_t*) src, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((float)(bench_scan_add_f32)
+                       ((float*) dst, (const float*) src, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((uint32_t)(bench_scan_add_exclusive_u32)
+                       ((uint32_t*) dst, (const uint32_t*) src, (unsigned) n))
@@ -0,0 +1,23 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_SCAN_SCAN_H
+#define LIBSIMDPP_BENCH_SCAN_SCAN_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstdint>
+
+// dst[i] = src[0] + ... + src[i]. Returns the sum of all elements
+uint32_t bench_scan_add_u32(uint32_t* dst, const uint32_t* src, unsigned n);
+uint64_t bench_scan_add_u64(uint64_t* dst, const uint64_t* src, unsigned n);
+float bench_scan_add_f32(float* dst, const float* src, unsigned n);
+
+// dst[i] = src[0] + ... + src[i-1]. Returns the sum of all elements
+uint32_t bench_scan_add_exclusive_u32(uint32_t* dst, const uint32_t* src,
+                                      unsigned n);
+
+#endif
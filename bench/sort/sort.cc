@@ -0,0 +1,51 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "sort.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void bench_sort_i32(int32_t* data, unsigned n)
+{
+    simdpp::sort(data, data + n);
+}
+
+void bench_sort_u32(uint32_t* data, unsigned n)
+{
+    simdpp::sort(data, data + n);
+}
+
+void bench_sort_f32(float* data, unsigned n)
+{
+    simdpp::sort(data, data + n);
+}
+
+void bench_sort_i64(int64_t* data, unsigned n)
+{
+    simdpp::sort(data, data + n);
+}
+
+void bench_sort_f64(double* data, unsigned n)
+{
+    simdpp::sort(data, data + n);
+}
+
+void bench_sort_pairs_u32(uint32_t* keys, uint32_t* values, unsigned n)
+{
+    simdpp::sort(keys, keys + n, values);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((void)(bench_sort_i32)((int32_t*) data, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_sort_u32)((uint32_t*) data, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_sort_f32)((float*) data, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_sort_i64)((int64_t*) data, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_sort_f64)((double*) data, (unsigned) n))
+SIMDPP_MAKE_DISPATCHER((void)(bench_sort_pairs_u32)
+                       ((uint32_t*) keys, (uint32_t*) values, (unsigned) n))
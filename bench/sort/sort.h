@@ -0,0 +1,24 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_SORT_SORT_H
+#define LIBSIMDPP_BENCH_SORT_SORT_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstdint>
+
+// Sorts the n elements at data in ascending order
+void bench_sort_i32(int32_t* data, unsigned n);
+void bench_sort_u32(uint32_t* data, unsigned n);
+void bench_sort_f32(float* data, unsigned n);
+void bench_sort_i64(int64_t* data, unsigned n);
+void bench_sort_f64(double* data, unsigned n);
+
+// Sorts the n keys and applies the same permutation to values
+void bench_sort_pairs_u32(uint32_t* keys, uint32_t* values, unsigned n);
+
+#endif
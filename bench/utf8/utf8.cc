@@ -0,0 +1,44 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "utf8.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+bool bench_utf8_validate(const char* s, std::size_t n)
+{
+    return utf8_validate(s, n);
+}
+
+std::size_t bench_utf8_to_utf16(const char* s, std::size_t n, char16_t* out)
+{
+    return utf8_to_utf16(s, n, out);
+}
+
+std::size_t bench_utf8_to_utf32(const char* s, std::size_t n, char32_t* out)
+{
+    return utf8_to_utf32(s, n, out);
+}
+
+std::size_t bench_utf16_to_utf8(const char16_t* s, std::size_t n, char* out)
+{
+    return utf16_to_utf8(s, n, out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((bool)(bench_utf8_validate)
+                       ((const char*) s, (std::size_t) n))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_utf8_to_utf16)
+                       ((const char*) s, (std::size_t) n, (char16_t*) out))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_utf8_to_utf32)
+                       ((const char*) s, (std::size_t) n, (char32_t*) out))
+SIMDPP_MAKE_DISPATCHER((std::size_t)(bench_utf16_to_utf8)
+                       ((const char16_t*) s, (std::size_t) n, (char*) out))
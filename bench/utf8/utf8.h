@@ -0,0 +1,22 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTF8_UTF8_H
+#define LIBSIMDPP_BENCH_UTF8_UTF8_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstddef>
+
+// Returns true if the n bytes at s are valid UTF-8
+bool bench_utf8_validate(const char* s, std::size_t n);
+
+// Return the number of code units written or std::size_t(-1) on invalid input
+std::size_t bench_utf8_to_utf16(const char* s, std::size_t n, char16_t* out);
+std::size_t bench_utf8_to_utf32(const char* s, std::size_t n, char32_t* out);
+std::size_t bench_utf16_to_utf8(const char16_t* s, std::size_t n, char* out);
+
+#endif
@@ -0,0 +1,89 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_TIMER_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_TIMER_H
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+/// Measures wall clock time between construction (or the last call to
+/// restart()) and the call to elapsed().
+class BenchTimer {
+public:
+    using clock = std::chrono::steady_clock;
+
+    BenchTimer() : start_(clock::now()) {}
+
+    void restart() { start_ = clock::now(); }
+
+    /// Returns the elapsed time in seconds
+    double elapsed() const
+    {
+        return std::chrono::duration<double>(clock::now() - start_).count();
+    }
+
+private:
+    clock::time_point start_;
+};
+
+/** Runs @a fun @a repeats times and returns the shortest time in seconds that
+    a single run took. The minimum is used because it is the least affected by
+    unrelated system activity.
+*/
+template<class F>
+double bench_min_time(unsigned repeats, F fun)
+{
+    double best = std::numeric_limits<double>::max();
+    for (unsigned i = 0; i < repeats; ++i) {
+        BenchTimer timer;
+        fun();
+        double t = timer.elapsed();
+        if (t < best)
+            best = t;
+    }
+    return best;
+}
+
+/// Prints a single line of benchmark results. @a items is the number of items
+/// processed in @a seconds.
+inline void bench_report(std::ostream& out, const std::string& name,
+                         double items, double seconds, const char* unit)
+{
+    out << std::left << std::setw(40) << name << std::right
+        << std::setw(12) << std::fixed << std::setprecision(3)
+        << (seconds * 1e9 / items) << " ns/" << unit
+        << std::setw(12) << std::setprecision(1)
+        << (items / seconds / 1e6) << " M" << unit << "/s\n";
+}
+
+/// Prints a single line of throughput results. @a bytes is the number of bytes
+/// processed in @a seconds.
+inline void bench_report_bytes(std::ostream& out, const std::string& name,
+                               double bytes, double seconds)
+{
+    out << std::left << std::setw(40) << name << std::right
+        << std::setw(12) << std::fixed << std::setprecision(3)
+        << (bytes / seconds / 1e9) << " GB/s\n";
+}
+
+/// Prevents the compiler from optimizing out the computation of @a value
+template<class T>
+void bench_do_not_optimize(const T& value)
+{
+#if __GNUC__
+    __asm__ __volatile__("" : : "r"(&value) : "memory");
+#else
+    const volatile char* p = reinterpret_cast<const volatile char*>(&value);
+    (void) *p;
+#endif
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "varint.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+std::size_t bench_svb_encode(uint8_t* out, const uint32_t* in, std::size_t n)
+{
+    return streamvbyte_encode(in, n, out);
+}
+
+std::size_t bench_svb_decode(uint32_t* out, const uint8_t* in, std::size_t size, std::size_t n)
+{
+    return streamvbyte_decode(in, size, out, n);
+}
+
+std::size_t bench_svb_decode_delta(uint32_t* out, const uint8_t* in, std::size_t size,
+                                   std::size_t n)
+{
+    return streamvbyte_decode_delta(in, size, out, n);
+}
+
+std::size_t bench_varint_encode32(uint8_t* out, const uint32_t* in, std::size_t n)
+{
+    return varint_encode(in, n, out);
+}
+
+std::size_t bench_varint_decode32(uint32_t* out, const uint8_t* in, std::size_t size)
+{
+    return varint_decode(in, size, out);
+}
+
+std::size_t bench_varint_decode64(uint64_t* out, const uint8_t* in, std::size_t size)
+{
+    return varint_decode(in, size, out);
+}
+
+struct VarintKernelsRegistrar {
+    VarintKernelsRegistrar()
+    {
+        varint_kernels().push_back({ SIMDPP_ARCH_NAME, this_compile_arch(),
+                                     &bench_svb_encode, &bench_svb_decode,
+                                     &bench_svb_decode_delta, &bench_varint_encode32,
+                                     &bench_varint_decode32, &bench_varint_decode64 });
+    }
+};
+
+static VarintKernelsRegistrar registrar;
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,35 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_VARINT_VARINT_H
+#define LIBSIMDPP_BENCH_VARINT_VARINT_H
+
+#include <simdpp/dispatch/arch.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*  Each architecture-specific version of varint.cc registers its kernels so
+    that all versions that can run on the current processor can be compared.
+    The kernels return the number of bytes written or read, or for varint
+    decoding the number of decoded values.
+*/
+struct VarintKernels {
+    const char* arch_name;
+    simdpp::Arch arch;
+    std::size_t (*svb_encode)(uint8_t* out, const uint32_t* in, std::size_t n);
+    std::size_t (*svb_decode)(uint32_t* out, const uint8_t* in, std::size_t size, std::size_t n);
+    std::size_t (*svb_decode_delta)(uint32_t* out, const uint8_t* in, std::size_t size,
+                                    std::size_t n);
+    std::size_t (*varint_encode32)(uint8_t* out, const uint32_t* in, std::size_t n);
+    std::size_t (*varint_decode32)(uint32_t* out, const uint8_t* in, std::size_t size);
+    std::size_t (*varint_decode64)(uint64_t* out, const uint8_t* in, std::size_t size);
+};
+
+std::vector<VarintKernels>& varint_kernels();
+
+#endif
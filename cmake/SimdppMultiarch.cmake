@@ -228,6 +228,49 @@ set(SIMDPP_X86_SSE4_1_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_SSE4_2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "-msse4.2")
+elseif(SIMDPP_MSVC)
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "/arch:SSE2")
+elseif(SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "/arch:SSE4.2")
+endif()
+set(SIMDPP_X86_SSE4_2_DEFINE "SIMDPP_ARCH_X86_SSE4_2")
+set(SIMDPP_X86_SSE4_2_SUFFIX "-x86_sse4_2")
+set(SIMDPP_X86_SSE4_2_TEST_CODE
+    "#include <nmmintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i one = _mm_load_si128((__m128i*)p);
+        one = _mm_cmpgt_epi64(one, one);
+        _mm_store_si128((__m128i*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "X86_POPCNT_INSN")
 if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
     set(SIMDPP_X86_POPCNT_INSN_CXX_FLAGS "-mssse3 -mpopcnt")
@@ -265,6 +308,47 @@ set(SIMDPP_X86_POPCNT_INSN_TEST_CODE
         p = prevent_optimization(p);
     }"
 )
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_PCLMULQDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_PCLMULQDQ_CXX_FLAGS "-msse2 -mpclmul")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_PCLMULQDQ_CXX_FLAGS "/arch:SSE2")
+endif()
+set(SIMDPP_X86_PCLMULQDQ_DEFINE "SIMDPP_ARCH_X86_PCLMULQDQ")
+set(SIMDPP_X86_PCLMULQDQ_SUFFIX "-x86_pclmul")
+set(SIMDPP_X86_PCLMULQDQ_TEST_CODE
+    "#include <wmmintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i one = _mm_load_si128((__m128i*)p);
+        one = _mm_clmulepi64_si128(one, one, 0x01);
+        _mm_store_si128((__m128i*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
 ###
 
 list(APPEND SIMDPP_ARCHS_PRI "X86_AVX")
@@ -364,6 +448,111 @@ set(SIMDPP_X86_AVX2_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI1")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_BMI1_CXX_FLAGS "-mbmi")
+endif()
+# MSVC does not need any flags to use the intrinsics
+set(SIMDPP_X86_BMI1_DEFINE "SIMDPP_ARCH_X86_BMI1")
+set(SIMDPP_X86_BMI1_SUFFIX "-x86_bmi1")
+set(SIMDPP_X86_BMI1_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    unsigned* prevent_optimization(unsigned* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        unsigned* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        unsigned data;
+        unsigned* p = &data;
+        p = prevent_optimization(p);
+
+        *p = _andn_u32(*p, _tzcnt_u32(*p));
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_BMI2_CXX_FLAGS "-mbmi2")
+endif()
+# MSVC does not need any flags to use the intrinsics
+set(SIMDPP_X86_BMI2_DEFINE "SIMDPP_ARCH_X86_BMI2")
+set(SIMDPP_X86_BMI2_SUFFIX "-x86_bmi2")
+set(SIMDPP_X86_BMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    unsigned* prevent_optimization(unsigned* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        unsigned* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        unsigned data;
+        unsigned* p = &data;
+        p = prevent_optimization(p);
+
+        *p = _pdep_u32(*p, *p);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_LZCNT")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_LZCNT_CXX_FLAGS "-mlzcnt")
+endif()
+# MSVC does not need any flags to use the intrinsics
+set(SIMDPP_X86_LZCNT_DEFINE "SIMDPP_ARCH_X86_LZCNT")
+set(SIMDPP_X86_LZCNT_SUFFIX "-x86_lzcnt")
+set(SIMDPP_X86_LZCNT_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    unsigned* prevent_optimization(unsigned* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        unsigned* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        unsigned data;
+        unsigned* p = &data;
+        p = prevent_optimization(p);
+
+        *p = _lzcnt_u32(*p);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "X86_FMA3")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_X86_FMA3_CXX_FLAGS "-mfma")
@@ -683,6 +872,326 @@ set(SIMDPP_X86_AVX512VL_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI_CXX_FLAGS "-mavx512bw -mavx512vbmi")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VBMI_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI")
+set(SIMDPP_X86_AVX512VBMI_SUFFIX "-x86_avx512vbmi")
+set(SIMDPP_X86_AVX512VBMI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_permutexvar_epi8(i, i); // only in AVX512-VBMI
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI2_CXX_FLAGS "-mavx512bw -mavx512vbmi2")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VBMI2_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI2")
+set(SIMDPP_X86_AVX512VBMI2_SUFFIX "-x86_avx512vbmi2")
+set(SIMDPP_X86_AVX512VBMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_shldi_epi16(i, i, 3); // only in AVX512-VBMI2
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VNNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VNNI_CXX_FLAGS "-mavx512f -mavx512vnni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VNNI_DEFINE "SIMDPP_ARCH_X86_AVX512VNNI")
+set(SIMDPP_X86_AVX512VNNI_SUFFIX "-x86_avx512vnni")
+set(SIMDPP_X86_AVX512VNNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_dpbusd_epi32(i, i, i); // only in AVX512-VNNI
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512BITALG")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512BITALG_CXX_FLAGS "-mavx512bw -mavx512bitalg")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512BITALG_DEFINE "SIMDPP_ARCH_X86_AVX512BITALG")
+set(SIMDPP_X86_AVX512BITALG_SUFFIX "-x86_avx512bitalg")
+set(SIMDPP_X86_AVX512BITALG_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_popcnt_epi8(i); // only in AVX512-BITALG
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VPOPCNTDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VPOPCNTDQ_CXX_FLAGS "-mavx512f -mavx512vpopcntdq")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VPOPCNTDQ_DEFINE "SIMDPP_ARCH_X86_AVX512VPOPCNTDQ")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_SUFFIX "-x86_avx512vpopcntdq")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_popcnt_epi32(i); // only in AVX512-VPOPCNTDQ
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512IFMA")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512IFMA_CXX_FLAGS "-mavx512f -mavx512ifma")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512IFMA_DEFINE "SIMDPP_ARCH_X86_AVX512IFMA")
+set(SIMDPP_X86_AVX512IFMA_SUFFIX "-x86_avx512ifma")
+set(SIMDPP_X86_AVX512IFMA_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_madd52lo_epu64(i, i, i); // only in AVX512-IFMA
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_GFNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_GFNI_CXX_FLAGS "-msse2 -mgfni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_GFNI_DEFINE "SIMDPP_ARCH_X86_GFNI")
+set(SIMDPP_X86_GFNI_SUFFIX "-x86_gfni")
+set(SIMDPP_X86_GFNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i i = _mm_load_si128((__m128i*)p);
+        i = _mm_gf2p8mul_epi8(i, i); // only in GFNI
+        _mm_store_si128((__m128i*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_VAES")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_VAES_CXX_FLAGS "-mavx -mvaes")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_VAES_DEFINE "SIMDPP_ARCH_X86_VAES")
+set(SIMDPP_X86_VAES_SUFFIX "-x86_vaes")
+set(SIMDPP_X86_VAES_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m256i i = _mm256_load_si256((__m256i*)p);
+        i = _mm256_aesenc_epi128(i, i); // only in VAES
+        _mm256_store_si256((__m256i*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon")
@@ -1032,9 +1541,12 @@ endfunction()
 #   identifiers is supplied.
 #
 #   The following identifiers are currently supported:
-#   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1,
-#   X86_AVX, X86_AVX2, X86_FMA3, X86_FMA4,
+#   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1, X86_SSE4_2, X86_POPCNT_INSN,
+#   X86_PCLMULQDQ, X86_AVX, X86_AVX2, X86_BMI1, X86_BMI2, X86_LZCNT,
+#   X86_FMA3, X86_FMA4,
 #   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_XOP,
+#   X86_AVX512VBMI, X86_AVX512VBMI2, X86_AVX512VNNI, X86_AVX512BITALG,
+#   X86_AVX512VPOPCNTDQ, X86_AVX512IFMA, X86_GFNI, X86_VAES,
 #   ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON,
 #   MIPS_MSA, POWER_ALTIVEC, POWER_VSX_206, POWER_VSX_207
 #
@@ -1058,6 +1570,16 @@ function(simdpp_multiarch FILE_LIST_VAR SRC_FILE)
 
         set(CXX_FLAGS "-I\"${CMAKE_CURRENT_SOURCE_DIR}/${SRC_PATH}\" ${CXX_FLAGS}")
         if(NOT "${SUFFIX}" STREQUAL "")
+            # The suffix of a combination of many instruction sets may exceed
+            # the file name length limit of the file system. Replace it with
+            # a hash in such case.
+            string(LENGTH "${SUFFIX}" SUFFIX_LENGTH)
+            if(SUFFIX_LENGTH GREATER 100)
+                string(MD5 SUFFIX_HASH "${SUFFIX}")
+                string(SUBSTRING "${SUFFIX_HASH}" 0 16 SUFFIX_HASH)
+                set(SUFFIX "-combo_${SUFFIX_HASH}")
+            endif()
+
             # Copy the source file and add the required flags
             set(DST_ABS_FILE "${CMAKE_CURRENT_BINARY_DIR}/${SRC_PATH}/${SRC_NAME}_simdpp_${SUFFIX}${SRC_EXT}")
             set(SRC_ABS_FILE "${CMAKE_CURRENT_SOURCE_DIR}/${SRC_FILE}")
@@ -1143,6 +1665,12 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
         # don't support AVX. There's no full overlap of the instruction set
         # support in these architectures, thus these two separate configs were
         # omitted from the default instruction set matrix.
+
+        if(DEFINED ARCH_SUPPORTED_X86_SSE4_2)
+            # Since Nehalem. All Intel processors that support SSE4.2 also
+            # support popcnt
+            list(APPEND ALL_ARCHS "X86_SSE4_2,X86_POPCNT_INSN")
+        endif()
     endif()
     if(DEFINED ARCH_SUPPORTED_X86_AVX)
         # Since Sandy Bridge, Bulldozer, Jaguar
@@ -1164,6 +1692,15 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
         # thus separate X86_AVX2 config is not needed.
         if(DEFINED ARCH_SUPPORTED_X86_FMA3)
             list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_POPCNT_INSN")
+
+            if(DEFINED ARCH_SUPPORTED_X86_PCLMULQDQ AND
+               DEFINED ARCH_SUPPORTED_X86_BMI1 AND
+               DEFINED ARCH_SUPPORTED_X86_BMI2 AND
+               DEFINED ARCH_SUPPORTED_X86_LZCNT)
+                # All Intel processors since Haswell and AMD processors since
+                # Excavator that support AVX2 also support these extensions
+                list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_PCLMULQDQ,X86_BMI1,X86_BMI2,X86_LZCNT")
+            endif()
         endif()
     endif()
     if(DEFINED ARCH_SUPPORTED_X86_FMA3)
@@ -1188,6 +1725,23 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
                     # All Intel processors that support AVX512BW also support
                     # AVX512DQ and AVX512VL
                     list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL")
+
+                    if(DEFINED ARCH_SUPPORTED_X86_AVX512VBMI AND
+                       DEFINED ARCH_SUPPORTED_X86_AVX512VBMI2 AND
+                       DEFINED ARCH_SUPPORTED_X86_AVX512VNNI AND
+                       DEFINED ARCH_SUPPORTED_X86_AVX512BITALG AND
+                       DEFINED ARCH_SUPPORTED_X86_AVX512VPOPCNTDQ AND
+                       DEFINED ARCH_SUPPORTED_X86_AVX512IFMA AND
+                       DEFINED ARCH_SUPPORTED_X86_GFNI AND
+                       DEFINED ARCH_SUPPORTED_X86_VAES AND
+                       DEFINED ARCH_SUPPORTED_X86_PCLMULQDQ AND
+                       DEFINED ARCH_SUPPORTED_X86_BMI1 AND
+                       DEFINED ARCH_SUPPORTED_X86_BMI2 AND
+                       DEFINED ARCH_SUPPORTED_X86_LZCNT)
+                        # Since Ice Lake and Zen 4. All of these processors
+                        # support the complete set of the above extensions
+                        list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_AVX512VBMI,X86_AVX512VBMI2,X86_AVX512VNNI,X86_AVX512BITALG,X86_AVX512VPOPCNTDQ,X86_AVX512IFMA,X86_GFNI,X86_VAES,X86_PCLMULQDQ,X86_BMI1,X86_BMI2,X86_LZCNT")
+                    endif()
                 endif()
             endif()
         endif()
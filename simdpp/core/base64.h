@@ -0,0 +1,95 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_BASE64_H
+#define LIBSIMDPP_SIMDPP_CORE_BASE64_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/base64.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// The value returned by the base64 decoding functions if the input is invalid
+static const std::size_t base64_invalid = detail::insn::base64_invalid_result;
+
+/** Encodes the @a n bytes at @a src to base64 as defined in RFC 4648 with
+    padding. Returns the number of characters written to @a dst, which is
+    <tt>4 * ((n + 2) / 3)</tt>.
+
+    The input is encoded in lanes of 16 bytes, 12 of which are used: the bytes
+    are rearranged using permute_bytes16() so that the 6-bit indices can be
+    extracted using shifts of 32-bit elements and are translated to characters
+    using a 16-entry offset table.
+
+    On SSE2 and big-endian targets the input is encoded one group at a time.
+*/
+SIMDPP_INL std::size_t base64_encode(const void* src, std::size_t n, char* dst)
+{
+    return detail::insn::i_base64_encode<detail::insn::base64_std>(
+                reinterpret_cast<const uint8_t*>(src), n, dst);
+}
+
+/** Encodes the @a n bytes at @a src to the URL and filename safe variant of
+    base64 as defined in RFC 4648 without padding. Returns the number of
+    characters written to @a dst, which is <tt>(4 * n + 2) / 3</tt>.
+
+    The encoding is done the same way as in base64_encode().
+*/
+SIMDPP_INL std::size_t base64url_encode(const void* src, std::size_t n, char* dst)
+{
+    return detail::insn::i_base64_encode<detail::insn::base64_url>(
+                reinterpret_cast<const uint8_t*>(src), n, dst);
+}
+
+/** Decodes the @a n characters of base64 at @a src. Returns the number of
+    bytes written to @a dst or @c base64_invalid if the input is not valid.
+    At most <tt>3 * n / 4</tt> bytes are written. Output may have been written
+    even if the input is invalid.
+
+    The input must be padded to a multiple of 4 characters. Whitespace is not
+    accepted. The unused bits of the last character must be zero.
+
+    The input is decoded in lanes of 16 characters. Each character is
+    validated and translated to its value using three 16-entry tables indexed
+    by its nibbles. The 6-bit values are merged using shifts of 16-bit and
+    32-bit elements and reordered using permute_bytes16().
+
+    On SSE2 and big-endian targets the input is decoded one group at a time.
+*/
+SIMDPP_INL std::size_t base64_decode(const char* src, std::size_t n, void* dst)
+{
+    return detail::insn::i_base64_decode<detail::insn::base64_std>(
+                src, n, reinterpret_cast<uint8_t*>(dst));
+}
+
+/** Decodes the @a n characters of the URL and filename safe variant of base64
+    at @a src. Returns the number of bytes written to @a dst or
+    @c base64_invalid if the input is not valid. At most <tt>3 * n / 4</tt>
+    bytes are written. Output may have been written even if the input is
+    invalid.
+
+    Padding is optional, but if present, the input must be padded to a
+    multiple of 4 characters. The decoding is otherwise done the same way as
+    in base64_decode().
+*/
+SIMDPP_INL std::size_t base64url_decode(const char* src, std::size_t n, void* dst)
+{
+    return detail::insn::i_base64_decode<detail::insn::base64_url>(
+                src, n, reinterpret_cast<uint8_t*>(dst));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,185 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_BITPACK_H
+#define LIBSIMDPP_SIMDPP_CORE_BITPACK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/bitpack.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The bitpack functions pack blocks of @c Block 32-bit values, each of which
+    fits into @c B bits, into <tt>B * Block / 32</tt> 32-bit words and unpack
+    them. @c Block is either 128 or 256. The values are interleaved across 4
+    lanes for 128-value blocks and 8 lanes for 256-value blocks, each lane
+    packing its 32 values consecutively. The format does not depend on the
+    instruction set.
+
+    Each bit width has its own fully unrolled kernel. The overloads taking
+    the number of bits as a function argument select the kernel through a
+    table of function pointers.
+*/
+
+/** Packs @c Block values at @a in, each of which fits into @a B bits, into
+    <tt>B * Block / 32</tt> words at @a out. The bits of the values above
+    @a B are ignored. Returns the pointer past the last written word.
+
+    @code
+    for each i in [0, Block):
+        lane = i % L,  bit = (i / L) * B
+        out[(bit / 32) * L + lane] |= in[i] << (bit % 32)     // and the carry
+    @endcode
+    where @c L is <tt>Block / 32</tt>.
+*/
+template<unsigned B, unsigned Block = 128> SIMDPP_INL
+uint32_t* bitpack(uint32_t* out, const uint32_t* in)
+{
+    static_assert(B <= 32, "The number of bits must be at most 32");
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using K = detail::insn::i_bitpack_kernel<B, Block, detail::insn::bitpack_mode_plain>;
+    return K::pack(out, in, 0);
+}
+
+/** Unpacks @c Block values of @a B bits that were packed by bitpack() from
+    @a in to @a out. Returns the pointer past the last read word.
+*/
+template<unsigned B, unsigned Block = 128> SIMDPP_INL
+const uint32_t* bitunpack(uint32_t* out, const uint32_t* in)
+{
+    static_assert(B <= 32, "The number of bits must be at most 32");
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using K = detail::insn::i_bitpack_kernel<B, Block, detail::insn::bitpack_mode_plain>;
+    return K::unpack(out, in, 0);
+}
+
+/** Packs @c Block values at @a in using frame of reference coding: the
+    offsets <tt>in[i] - base</tt>, computed modulo 2^32, are packed as in
+    bitpack() and must fit into @a B bits.
+*/
+template<unsigned B, unsigned Block = 128> SIMDPP_INL
+uint32_t* bitpack_for(uint32_t* out, const uint32_t* in, uint32_t base)
+{
+    static_assert(B <= 32, "The number of bits must be at most 32");
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using K = detail::insn::i_bitpack_kernel<B, Block, detail::insn::bitpack_mode_for>;
+    return K::pack(out, in, base);
+}
+
+/** Unpacks @c Block values packed by bitpack_for() and adds @a base to each
+    of them.
+*/
+template<unsigned B, unsigned Block = 128> SIMDPP_INL
+const uint32_t* bitunpack_for(uint32_t* out, const uint32_t* in, uint32_t base)
+{
+    static_assert(B <= 32, "The number of bits must be at most 32");
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using K = detail::insn::i_bitpack_kernel<B, Block, detail::insn::bitpack_mode_for>;
+    return K::unpack(out, in, base);
+}
+
+/** Packs @c Block values at @a in using delta coding: the differences
+    <tt>in[i] - in[i-1]</tt>, computed modulo 2^32, are packed as in
+    bitpack() and must fit into @a B bits. @a init is used as the value
+    preceding the block, usually the last value of the previous block.
+*/
+template<unsigned B, unsigned Block = 128> SIMDPP_INL
+uint32_t* bitpack_delta(uint32_t* out, const uint32_t* in, uint32_t init)
+{
+    static_assert(B <= 32, "The number of bits must be at most 32");
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using K = detail::insn::i_bitpack_kernel<B, Block, detail::insn::bitpack_mode_delta>;
+    return K::pack(out, in, init);
+}
+
+/** Unpacks @c Block values packed by bitpack_delta() with the same @a init.
+    The prefix sum of the differences is computed in the registers as part
+    of unpacking.
+*/
+template<unsigned B, unsigned Block = 128> SIMDPP_INL
+const uint32_t* bitunpack_delta(uint32_t* out, const uint32_t* in, uint32_t init)
+{
+    static_assert(B <= 32, "The number of bits must be at most 32");
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using K = detail::insn::i_bitpack_kernel<B, Block, detail::insn::bitpack_mode_delta>;
+    return K::unpack(out, in, init);
+}
+
+/// @{
+/** Runtime bit width variants of the functions above. @a b must be at most
+    32.
+*/
+template<unsigned Block = 128> SIMDPP_INL
+uint32_t* bitpack(uint32_t* out, const uint32_t* in, unsigned b)
+{
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using T = detail::insn::i_bitpack_table<Block, detail::insn::bitpack_mode_plain>;
+    return T::pack[b](out, in, 0);
+}
+
+template<unsigned Block = 128> SIMDPP_INL
+const uint32_t* bitunpack(uint32_t* out, const uint32_t* in, unsigned b)
+{
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using T = detail::insn::i_bitpack_table<Block, detail::insn::bitpack_mode_plain>;
+    return T::unpack[b](out, in, 0);
+}
+
+template<unsigned Block = 128> SIMDPP_INL
+uint32_t* bitpack_for(uint32_t* out, const uint32_t* in, unsigned b, uint32_t base)
+{
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using T = detail::insn::i_bitpack_table<Block, detail::insn::bitpack_mode_for>;
+    return T::pack[b](out, in, base);
+}
+
+template<unsigned Block = 128> SIMDPP_INL
+const uint32_t* bitunpack_for(uint32_t* out, const uint32_t* in, unsigned b, uint32_t base)
+{
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using T = detail::insn::i_bitpack_table<Block, detail::insn::bitpack_mode_for>;
+    return T::unpack[b](out, in, base);
+}
+
+template<unsigned Block = 128> SIMDPP_INL
+uint32_t* bitpack_delta(uint32_t* out, const uint32_t* in, unsigned b, uint32_t init)
+{
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using T = detail::insn::i_bitpack_table<Block, detail::insn::bitpack_mode_delta>;
+    return T::pack[b](out, in, init);
+}
+
+template<unsigned Block = 128> SIMDPP_INL
+const uint32_t* bitunpack_delta(uint32_t* out, const uint32_t* in, unsigned b, uint32_t init)
+{
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    using T = detail::insn::i_bitpack_table<Block, detail::insn::bitpack_mode_delta>;
+    return T::unpack[b](out, in, init);
+}
+/// @}
+
+/** Returns the number of bits needed to represent the largest of the
+    @c Block values at @a in, that is, the smallest @c b such that the block
+    can be packed by <tt>bitpack(out, in, b)</tt>.
+*/
+template<unsigned Block = 128> SIMDPP_INL
+unsigned bitpack_max_bits(const uint32_t* in)
+{
+    static_assert(Block == 128 || Block == 256, "Block must be 128 or 256");
+    return detail::insn::i_bitpack_max_bits<Block>(in);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
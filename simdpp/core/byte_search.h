@@ -0,0 +1,93 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_BYTE_SEARCH_H
+#define LIBSIMDPP_SIMDPP_CORE_BYTE_SEARCH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/byte_search.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Returns a pointer to the first occurrence of @a c within the first @a n
+    bytes of @a s, or @c nullptr if there is none. Equivalent to @c memchr.
+
+    The input is read in aligned blocks of the size of the native vector,
+    each of which is compared with the broadcast of @a c. Reads may access
+    bytes outside the input that are located in the same aligned block, but
+    never cross into another page, thus the function never faults if the
+    input is accessible. Blocks are checked four at a time until a match is
+    found.
+*/
+SIMDPP_INL const char* find_byte(const char* s, std::size_t n, char c)
+{
+    return detail::insn::i_find_first(s, n, detail::insn::byte_search_eq(c));
+}
+
+/** Returns a pointer to the last occurrence of @a c within the first @a n
+    bytes of @a s, or @c nullptr if there is none. Equivalent to the GNU
+    @c memrchr.
+
+    The input is processed the same way as in find_byte(), but starting from
+    its end.
+*/
+SIMDPP_INL const char* find_last_byte(const char* s, std::size_t n, char c)
+{
+    return detail::insn::i_find_last(s, n, detail::insn::byte_search_eq(c));
+}
+
+/** Returns a pointer to the first byte within the first @a n bytes of @a s
+    that is equal to any of the @a set_n bytes at @a set, or @c nullptr if
+    there is none.
+
+    The input is processed the same way as in find_byte(). Each byte of the
+    set costs one comparison per block, thus the function is intended for
+    small sets such as delimiters.
+*/
+SIMDPP_INL const char* find_first_of(const char* s, std::size_t n,
+                                     const char* set, std::size_t set_n)
+{
+    if (set_n == 0)
+        return nullptr;
+    detail::insn::byte_search_set match = { set, set_n };
+    return detail::insn::i_find_first(s, n, match);
+}
+
+/** Returns the number of bytes before the first zero byte at @a s.
+    Equivalent to @c strlen.
+
+    The input is processed the same way as in find_byte().
+*/
+SIMDPP_INL std::size_t string_length(const char* s)
+{
+    return detail::insn::i_string_length(s);
+}
+
+/** Returns @c true if the first @a n bytes at @a a and @a b are equal.
+    Equivalent to <tt>memcmp(a, b, n) == 0</tt>.
+
+    Two vectors of each input are compared per iteration using unaligned
+    loads. The last vector overlaps the previous ones instead of reading past
+    the end of the inputs and inputs shorter than a vector are loaded with
+    load_first().
+*/
+SIMDPP_INL bool bytes_equal(const void* a, const void* b, std::size_t n)
+{
+    return detail::insn::i_bytes_equal(static_cast<const char*>(a),
+                                       static_cast<const char*>(b), n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
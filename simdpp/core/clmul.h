@@ -0,0 +1,44 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_CLMUL_H
+#define LIBSIMDPP_SIMDPP_CORE_CLMUL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/clmul.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes carry-less (polynomial over GF(2)) products of 64-bit values.
+    The selector values must be in range [0; 1].
+
+    @code
+    For each 128-bit segment:
+    r0 = low 64 bits of clmul(a[sa], b[sb])
+    r1 = high 64 bits of clmul(a[sa], b[sb])
+    @endcode
+
+    Maps to PCLMULQDQ on x86 and to PMULL on ARM64 when the crypto extension
+    is enabled in the compiler flags. On other instruction sets the products
+    are computed one element at a time.
+*/
+template<unsigned sa, unsigned sb, unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N> clmul(const uint64<N,E1>& a, const uint64<N,E2>& b)
+{
+    static_assert(sa < 2 && sb < 2, "Selector out of range");
+    return detail::insn::i_clmul<sa,sb>(a.eval(), b.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,212 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Moves the elements selected by @a mask to the beginning of the vector,
+    preserving their order. The rest of the elements are set to zero.
+
+    @code
+    mask: [ 0  1  1  0  1  0  0  0 ]
+    r =   [ a1 a2 a4 0  0  0  0  0 ]
+    @endcode
+
+    On AVX512F this maps to @c vpcompressd, @c vpcompressq, @c vcompressps or
+    @c vcompresspd (128 and 256-bit vectors additionally need AVX512VL). 8 and
+    16-bit elements need AVX512VBMI2. On SSSE3, AVX2, NEON, ALTIVEC and MSA a
+    byte shuffle with a mask looked up from a table indexed by the bits of
+    @a mask is used. On other instruction sets the elements are moved one by
+    one.
+*/
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+float32<N> compress(const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    return detail::insn::i_compress(a.wrapped().eval(), mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+float64<N> compress(const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    return detail::insn::i_compress(a.wrapped().eval(), mask.wrapped().eval());
+}
+
+/** Stores the elements selected by @a mask to consecutive locations starting
+    at @a p, preserving their order. Returns the number of the stored elements.
+    Memory past the last stored element is not accessed. @a p does not need to
+    be aligned.
+
+    @code
+    mask: [ 0  1  1  0  1  0  0  0 ]
+    p:    [ a1 a2 a4 ]
+    r = 3
+    @endcode
+
+    On AVX512F this maps to the memory forms of the compress instructions
+    listed in compress(). On other instruction sets the vector is compressed
+    as in compress() and the selected elements are copied to memory.
+*/
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store_u(T* p, const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            uint8<N>(a.wrapped().eval()),
+                                            mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store_u(T* p, const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            uint16<N>(a.wrapped().eval()),
+                                            mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store_u(T* p, const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            uint32<N>(a.wrapped().eval()),
+                                            mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store_u(T* p, const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            uint64<N>(a.wrapped().eval()),
+                                            mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store_u(T* p, const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            a.wrapped().eval(),
+                                            mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store_u(T* p, const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            a.wrapped().eval(),
+                                            mask.wrapped().eval());
+}
+
+/** Performs the inverse of compress(): moves the consecutive elements from the
+    beginning of the vector to the positions selected by @a mask, preserving
+    their order. The rest of the elements are set to zero.
+
+    @code
+    mask: [ 0  1  1  0  1  0  0  0 ]
+    r =   [ 0  a0 a1 0  a2 0  0  0 ]
+    @endcode
+
+    On AVX512F this maps to @c vpexpandd, @c vpexpandq, @c vexpandps or
+    @c vexpandpd (128 and 256-bit vectors additionally need AVX512VL). 8 and
+    16-bit elements need AVX512VBMI2. The rest of the instruction sets are
+    handled as in compress().
+*/
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        expand(const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_expand(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        expand(const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_expand(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        expand(const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_expand(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        expand(const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_expand(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+float32<N> expand(const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    return detail::insn::i_expand(a.wrapped().eval(), mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+float64<N> expand(const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    return detail::insn::i_expand(a.wrapped().eval(), mask.wrapped().eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,94 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_CRC_H
+#define LIBSIMDPP_SIMDPP_CORE_CRC_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/crc.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Updates the CRC32C state @a crc with the byte @a v. The state is not
+    inverted, i.e. the function behaves as the @c crc32 instruction.
+
+    Maps to the SSE4.2 @c crc32 instruction on x86 and to the CRC extension
+    on ARM when it is enabled in the compiler flags. Table lookups are used
+    otherwise.
+*/
+SIMDPP_INL uint32_t crc32c_u8(uint32_t crc, uint8_t v)
+{
+    return detail::insn::i_crc32c_u8(crc, v);
+}
+
+/// Updates the CRC32C state @a crc with the 4 bytes of @a v in little-endian
+/// order. Otherwise same as crc32c_u8().
+SIMDPP_INL uint32_t crc32c_u32(uint32_t crc, uint32_t v)
+{
+    return detail::insn::i_crc32c_u32(crc, v);
+}
+
+/// Updates the CRC32C state @a crc with the 8 bytes of @a v in little-endian
+/// order. Otherwise same as crc32c_u8().
+SIMDPP_INL uint32_t crc32c_u64(uint32_t crc, uint64_t v)
+{
+    return detail::insn::i_crc32c_u64(crc, v);
+}
+
+/** Computes the CRC-32 (as used by zlib, Ethernet and PNG) of the @a n bytes
+    at @a data. @a crc is the CRC of the preceding data, if any, thus
+    <tt>crc32(b, nb, crc32(a, na))</tt> is the CRC of the concatenation of
+    @a a and @a b.
+
+    If clmul() maps to a single instruction, the data is folded 64 bytes at a
+    time into four 128-bit accumulators using carry-less multiplication by
+    precomputed powers of x modulo the polynomial. The accumulators are then
+    folded into one and reduced using Barrett reduction. The remaining data
+    and short inputs are processed using table lookups, or the CRC extension
+    on ARM.
+*/
+SIMDPP_INL uint32_t crc32(const void* data, std::size_t n, uint32_t crc = 0)
+{
+    using P = detail::insn::crc32_params;
+    return ~detail::insn::i_crc<P>(~crc, reinterpret_cast<const uint8_t*>(data), n);
+}
+
+/** Computes the CRC-32C (Castagnoli, as used by iSCSI, ext4 and SSE4.2) of
+    the @a n bytes at @a data. @a crc is the CRC of the preceding data, if any.
+
+    The computation is done the same way as in crc32(), except that the
+    remaining data is processed using the hardware CRC32C instructions where
+    available.
+*/
+SIMDPP_INL uint32_t crc32c(const void* data, std::size_t n, uint32_t crc = 0)
+{
+    using P = detail::insn::crc32c_params;
+    return ~detail::insn::i_crc<P>(~crc, reinterpret_cast<const uint8_t*>(data), n);
+}
+
+/** Computes the CRC-64/XZ (ECMA-182 polynomial, reflected, as used by xz) of
+    the @a n bytes at @a data. @a crc is the CRC of the preceding data, if any.
+
+    The computation is done the same way as in crc32().
+*/
+SIMDPP_INL uint64_t crc64(const void* data, std::size_t n, uint64_t crc = 0)
+{
+    using P = detail::insn::crc64_params;
+    return ~detail::insn::i_crc<P>(~crc, reinterpret_cast<const uint8_t*>(data), n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
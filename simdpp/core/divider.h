@@ -0,0 +1,268 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+#define LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_div.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Precomputed integer divisor. Division by a divider is replaced by a
+    multiplication by a magic number followed by shifts, which is much faster
+    than the division instructions that most instruction sets lack anyway.
+    Constructing the divider is relatively expensive, thus it should be reused
+    for many divisions.
+
+    @a T must be one of @c int16_t, @c uint16_t, @c int32_t, @c uint32_t,
+    @c int64_t and @c uint64_t. The divider does not depend on the vector
+    width and can be used with vectors of any length.
+
+    The divisor must not be zero.
+*/
+template<class T>
+class divider {
+public:
+    static_assert(std::is_integral<T>::value && sizeof(T) >= 2 && sizeof(T) <= 8,
+                  "Only 16, 32 and 64-bit integers are supported");
+
+    using element_type = T;
+    using uint_type = typename std::make_unsigned<T>::type;
+
+    enum : unsigned char {
+        algo_shift,         ///< q = a >> s
+        algo_mul_shift,     ///< q = mulhi(a, m) >> s
+        algo_mul_add_shift  ///< q = (mulhi(a, m) + a) >> s with the overflow handled
+    };
+
+    explicit divider(T d) : d_(d)
+    {
+        if (std::is_signed<T>::value) {
+            init_signed();
+        } else {
+            init_unsigned();
+        }
+    }
+
+    /// Returns the divisor
+    T divisor() const { return d_; }
+    /// Returns the magic number the numerator is multiplied by
+    uint_type magic() const { return magic_; }
+    /// Returns the number of bits the result is shifted by
+    unsigned shift() const { return shift_; }
+    /// Returns the division algorithm
+    unsigned algorithm() const { return algo_; }
+
+private:
+    static const unsigned bits = sizeof(T) * 8;
+
+    static unsigned floor_log2(uint_type x)
+    {
+        unsigned r = 0;
+        while (x >>= 1)
+            r++;
+        return r;
+    }
+
+    // Computes (hi * 2^bits + lo) / d and the remainder. hi must be less
+    // than d
+    static uint_type div_wide(uint_type hi, uint_type lo, uint_type d, uint_type& rem)
+    {
+        for (unsigned i = 0; i < bits; ++i) {
+            bool carry = (hi >> (bits - 1)) != 0;
+            hi = uint_type(hi << 1) | uint_type(lo >> (bits - 1));
+            lo = uint_type(lo << 1);
+            if (carry || hi >= d) {
+                hi = uint_type(hi - d);
+                lo |= 1;
+            }
+        }
+        rem = hi;
+        return lo;
+    }
+
+    void init_unsigned()
+    {
+        uint_type d = uint_type(d_);
+        unsigned p = floor_log2(d);
+        if ((d & (d - 1)) == 0) {
+            algo_ = algo_shift;
+            magic_ = 0;
+            shift_ = p;
+            return;
+        }
+
+        uint_type rem;
+        uint_type m = div_wide(uint_type(uint_type(1) << p), 0, d, rem);
+        uint_type e = uint_type(d - rem);
+        if (e < (uint_type(1) << p)) {
+            // m + 1 = ceil(2^(bits+p) / d) is accurate enough
+            algo_ = algo_mul_shift;
+            magic_ = uint_type(m + 1);
+        } else {
+            // m = floor(2^(bits+p+1) / d) + 1 - 2^bits. The 2^bits part is
+            // handled by adding the numerator to the product
+            algo_ = algo_mul_add_shift;
+            uint_type rem2 = uint_type(rem + rem);
+            m = uint_type(m + m);
+            if (rem2 >= d || rem2 < rem)
+                m++;
+            magic_ = uint_type(m + 1);
+        }
+        shift_ = p;
+    }
+
+    void init_signed()
+    {
+        uint_type ad = d_ < 0 ? uint_type(uint_type(0) - uint_type(d_)) : uint_type(d_);
+        unsigned p = floor_log2(ad);
+        if ((ad & (ad - 1)) == 0) {
+            algo_ = algo_shift;
+            magic_ = 0;
+            shift_ = p;
+            return;
+        }
+
+        uint_type rem;
+        uint_type m = div_wide(uint_type(uint_type(1) << (p - 1)), 0, ad, rem);
+        uint_type e = uint_type(ad - rem);
+        if (e < (uint_type(1) << p)) {
+            // m + 1 = ceil(2^(bits+p-1) / |d|) fits into bits-1 bits
+            algo_ = algo_mul_shift;
+            magic_ = uint_type(m + 1);
+            shift_ = p - 1;
+        } else {
+            // magic = floor(2^(bits+p) / |d|) + 1 is negative when interpreted
+            // as a signed number, which is compensated by adding the numerator
+            algo_ = algo_mul_add_shift;
+            uint_type rem2 = uint_type(rem + rem);
+            m = uint_type(m + m);
+            if (rem2 >= ad || rem2 < rem)
+                m++;
+            magic_ = uint_type(m + 1);
+            shift_ = p;
+        }
+    }
+
+    T d_;
+    uint_type magic_;
+    unsigned char shift_;
+    unsigned char algo_;
+};
+
+/** Divides each element by a precomputed divisor. The result is rounded
+    towards zero.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    Division of the minimum signed value by -1 wraps around to the minimum
+    value.
+
+    The 16-bit variants use native multiply-high instructions. The 32 and
+    64-bit variants are built from 32x32 to 64-bit multiplications, which are
+    single instructions on SSE2, AVX2, AVX-512 and NEON. The 64-bit variants
+    need four such multiplications per vector.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> div(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> div(const int16<N,E>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> div(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> div(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> div(const uint64<N,E>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> div(const int64<N,E>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+/** Computes the remainder of the division of each element by a precomputed
+    divisor. The sign of the result is the same as the sign of the numerator.
+
+    @code
+    r0 = a0 % d
+    ...
+    rN = aN % d
+    @endcode
+
+    The cost is the cost of div() plus one multiplication and subtraction.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> rem(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_rem(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> rem(const int16<N,E>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_rem(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> rem(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_rem(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> rem(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_rem(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> rem(const uint64<N,E>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_rem(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> rem(const int64<N,E>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_rem(a.eval(), d);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/detail/expr/f_add.h>
+#include <simdpp/detail/insn/f_add.h>
 #include <simdpp/core/detail/scalar_arg_impl.h>
 
 namespace simdpp {
@@ -64,6 +65,86 @@ float64<N, expr_fadd<float64<N,E1>,
 
 SIMDPP_SCALAR_ARG_IMPL_EXPR(add, expr_fadd, float64, float64)
 
+/** Adds the values of two vectors in the elements selected by @a mask. The
+    rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 + b0 : src0
+    ...
+    rN = maskN ? aN + bN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(add(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+float32<N,expr_empty> add(const float32<N,E1>& a, const float32<N,E2>& b,
+                          const mask_float32<N,E3>& mask,
+                          const float32<N,E4>& src)
+{
+    return detail::insn::i_fadd_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+/** Adds the values of two vectors in the elements selected by @a mask. The
+    rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 + b0 : 0
+    ...
+    rN = maskN ? aN + bN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(add(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+float32<N,expr_empty> add_z(const float32<N,E1>& a, const float32<N,E2>& b,
+                            const mask_float32<N,E3>& mask)
+{
+    return detail::insn::i_fadd_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Adds the values of two vectors in the elements selected by @a mask. The
+    rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 + b0 : src0
+    ...
+    rN = maskN ? aN + bN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(add(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+float64<N,expr_empty> add(const float64<N,E1>& a, const float64<N,E2>& b,
+                          const mask_float64<N,E3>& mask,
+                          const float64<N,E4>& src)
+{
+    return detail::insn::i_fadd_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+/** Adds the values of two vectors in the elements selected by @a mask. The
+    rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 + b0 : 0
+    ...
+    rN = maskN ? aN + bN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(add(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+float64<N,expr_empty> add_z(const float64<N,E1>& a, const float64<N,E2>& b,
+                            const mask_float64<N,E3>& mask)
+{
+    return detail::insn::i_fadd_maskz(a.eval(), b.eval(), mask.eval());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
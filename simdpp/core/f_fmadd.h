@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/detail/expr/f_fmadd.h>
+#include <simdpp/detail/insn/f_fmadd.h>
 
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
@@ -49,6 +50,92 @@ float64<N, expr_fmadd<float64<N,E1>,
     return { { a, b, c } };
 }
 
+/** Performs a fused multiply-add operation in the elements selected by @a
+    mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 * b0 + c0 : src0
+    ...
+    rN = maskN ? aN * bN + cN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(fmadd(a, b, c), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4, class E5> SIMDPP_INL
+float32<N,expr_empty> fmadd(const float32<N,E1>& a, const float32<N,E2>& b,
+                            const float32<N,E3>& c,
+                            const mask_float32<N,E4>& mask,
+                            const float32<N,E5>& src)
+{
+    return detail::insn::i_fmadd_mask(a.eval(), b.eval(), c.eval(),
+                                      mask.eval(), src.eval());
+}
+
+/** Performs a fused multiply-add operation in the elements selected by @a
+    mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 * b0 + c0 : 0
+    ...
+    rN = maskN ? aN * bN + cN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(fmadd(a, b, c), mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+float32<N,expr_empty> fmadd_z(const float32<N,E1>& a, const float32<N,E2>& b,
+                              const float32<N,E3>& c,
+                              const mask_float32<N,E4>& mask)
+{
+    return detail::insn::i_fmadd_maskz(a.eval(), b.eval(), c.eval(),
+                                       mask.eval());
+}
+
+/** Performs a fused multiply-add operation in the elements selected by @a
+    mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 * b0 + c0 : src0
+    ...
+    rN = maskN ? aN * bN + cN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(fmadd(a, b, c), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4, class E5> SIMDPP_INL
+float64<N,expr_empty> fmadd(const float64<N,E1>& a, const float64<N,E2>& b,
+                            const float64<N,E3>& c,
+                            const mask_float64<N,E4>& mask,
+                            const float64<N,E5>& src)
+{
+    return detail::insn::i_fmadd_mask(a.eval(), b.eval(), c.eval(),
+                                      mask.eval(), src.eval());
+}
+
+/** Performs a fused multiply-add operation in the elements selected by @a
+    mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 * b0 + c0 : 0
+    ...
+    rN = maskN ? aN * bN + cN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(fmadd(a, b, c), mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+float64<N,expr_empty> fmadd_z(const float64<N,E1>& a, const float64<N,E2>& b,
+                              const float64<N,E3>& c,
+                              const mask_float64<N,E4>& mask)
+{
+    return detail::insn::i_fmadd_maskz(a.eval(), b.eval(), c.eval(),
+                                       mask.eval());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/detail/expr/f_sub.h>
+#include <simdpp/detail/insn/f_sub.h>
 #include <simdpp/core/detail/scalar_arg_impl.h>
 #include <simdpp/core/detail/get_expr_uint.h>
 
@@ -67,6 +68,86 @@ float64<N, expr_fsub<float64<N,E1>,
 
 SIMDPP_SCALAR_ARG_IMPL_EXPR(sub, expr_fsub, float64, float64)
 
+/** Subtracts the values of two vectors in the elements selected by @a mask.
+    The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 - b0 : src0
+    ...
+    rN = maskN ? aN - bN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(sub(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+float32<N,expr_empty> sub(const float32<N,E1>& a, const float32<N,E2>& b,
+                          const mask_float32<N,E3>& mask,
+                          const float32<N,E4>& src)
+{
+    return detail::insn::i_fsub_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+/** Subtracts the values of two vectors in the elements selected by @a mask.
+    The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 - b0 : 0
+    ...
+    rN = maskN ? aN - bN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(sub(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+float32<N,expr_empty> sub_z(const float32<N,E1>& a, const float32<N,E2>& b,
+                            const mask_float32<N,E3>& mask)
+{
+    return detail::insn::i_fsub_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Subtracts the values of two vectors in the elements selected by @a mask.
+    The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 - b0 : src0
+    ...
+    rN = maskN ? aN - bN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(sub(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+float64<N,expr_empty> sub(const float64<N,E1>& a, const float64<N,E2>& b,
+                          const mask_float64<N,E3>& mask,
+                          const float64<N,E4>& src)
+{
+    return detail::insn::i_fsub_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+/** Subtracts the values of two vectors in the elements selected by @a mask.
+    The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 - b0 : 0
+    ...
+    rN = maskN ? aN - bN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(sub(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+float64<N,expr_empty> sub_z(const float64<N,E1>& a, const float64<N,E2>& b,
+                            const mask_float64<N,E3>& mask)
+{
+    return detail::insn::i_fsub_maskz(a.eval(), b.eval(), mask.eval());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -0,0 +1,138 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_GATHER_H
+#define LIBSIMDPP_SIMDPP_CORE_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/gather.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the elements at the given indices from memory.
+
+    @code
+    r0 = base[idx0]
+    ...
+    rN = base[idxN]
+    @endcode
+
+    The indices are element indices, not byte offsets, and are interpreted as
+    signed values. The width of the loaded elements is the same as the width
+    of the indices. Unsigned integer vectors are returned unless @a base points
+    to @c float or @c double, in which case floating-point vectors are
+    returned.
+
+    On AVX2 and AVX512F this maps to @c vpgatherdd, @c vpgatherqq,
+    @c vgatherdps or @c vgatherqpd. On other instruction sets the elements are
+    loaded one by one.
+*/
+template<class T, unsigned N, class V> SIMDPP_INL
+uint32<N> gather(const T* base, const any_int32<N,V>& idx)
+{
+    uint32<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base),
+                           uint32<N>(idx.wrapped().eval()));
+    return r;
+}
+
+template<class T, unsigned N, class V> SIMDPP_INL
+uint64<N> gather(const T* base, const any_int64<N,V>& idx)
+{
+    uint64<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base),
+                           uint64<N>(idx.wrapped().eval()));
+    return r;
+}
+
+template<unsigned N, class V> SIMDPP_INL
+float32<N> gather(const float* base, const any_int32<N,V>& idx)
+{
+    float32<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base),
+                           uint32<N>(idx.wrapped().eval()));
+    return r;
+}
+
+template<unsigned N, class V> SIMDPP_INL
+float64<N> gather(const double* base, const any_int64<N,V>& idx)
+{
+    float64<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base),
+                           uint64<N>(idx.wrapped().eval()));
+    return r;
+}
+
+/** Loads the elements at the given indices from memory for the elements
+    selected by @a mask. The rest of the elements are set to zero and the
+    memory they point to is not accessed.
+
+    @code
+    r0 = mask0 ? base[idx0] : 0
+    ...
+    rN = maskN ? base[idxN] : 0
+    @endcode
+
+    The type of the returned vector is determined by the type of the mask:
+    unsigned integer vectors are returned for integer masks.
+
+    On AVX2 and AVX512F this maps to a single masked gather instruction. On
+    other instruction sets the selected elements are loaded one by one.
+*/
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+uint32<N> gather_masked(const T* base, const any_int32<N,V>& idx,
+                        const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base),
+                                  uint32<N>(idx.wrapped().eval()),
+                                  mask.wrapped().eval());
+    return r;
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+uint64<N> gather_masked(const T* base, const any_int64<N,V>& idx,
+                        const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base),
+                                  uint64<N>(idx.wrapped().eval()),
+                                  mask.wrapped().eval());
+    return r;
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+float32<N> gather_masked(const T* base, const any_int32<N,V>& idx,
+                         const mask_float32<N,M>& mask)
+{
+    float32<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base),
+                                  uint32<N>(idx.wrapped().eval()),
+                                  mask.wrapped().eval());
+    return r;
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+float64<N> gather_masked(const T* base, const any_int64<N,V>& idx,
+                         const mask_float64<N,M>& mask)
+{
+    float64<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base),
+                                  uint64<N>(idx.wrapped().eval()),
+                                  mask.wrapped().eval());
+    return r;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
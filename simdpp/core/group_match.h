@@ -0,0 +1,206 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_GROUP_MATCH_H
+#define LIBSIMDPP_SIMDPP_CORE_GROUP_MATCH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/detail/insn/group_match.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The group_match functions implement the control byte scan of open
+    addressing hash tables that store one control byte per slot, such as the
+    Swiss tables. A control byte is either a 7-bit tag (usually a part of the
+    hash of the key) of a full slot or one of the following values. A group is
+    a run of 16, 32 or 64 consecutive control bytes that is probed at once.
+*/
+
+/// Control byte of an empty slot
+static const uint8_t group_ctrl_empty = detail::insn::group_ctrl_empty_value;
+/// Control byte of a slot whose element has been erased
+static const uint8_t group_ctrl_deleted = detail::insn::group_ctrl_deleted_value;
+/// Control byte that marks the end of the table
+static const uint8_t group_ctrl_sentinel = detail::insn::group_ctrl_sentinel_value;
+
+/** The set of the matching slots of a group of @a N control bytes.
+
+    The set is stored as a bit mask in which the slot @c i is represented by
+    the bit <tt>i << slot_shift</tt>. @c slot_shift is zero except on NEON
+    where 16-byte groups use 4 bits per slot, because that layout is much
+    cheaper to compute there. The remaining bits are always zero.
+
+    Iterating over the set yields the indexes of the matching slots in
+    increasing order:
+
+    @code
+    for (unsigned i : group_match(ctrl, tag)) {
+        if (slots[i] == key) ...
+    }
+    @endcode
+*/
+template<unsigned N>
+class group_mask {
+public:
+    static_assert(N == 16 || N == 32 || N == 64, "Unsupported group size");
+
+    static const unsigned slot_shift = detail::insn::group_mask_shift<N>::value;
+
+    class iterator {
+    public:
+        SIMDPP_INL explicit iterator(uint64_t bits) : bits_(bits) {}
+
+        SIMDPP_INL unsigned operator*() const
+        {
+            return detail::insn::i_group_ctz(bits_) >> slot_shift;
+        }
+
+        SIMDPP_INL iterator& operator++()
+        {
+            bits_ &= bits_ - 1;
+            return *this;
+        }
+
+        SIMDPP_INL bool operator==(const iterator& other) const { return bits_ == other.bits_; }
+        SIMDPP_INL bool operator!=(const iterator& other) const { return bits_ != other.bits_; }
+
+    private:
+        uint64_t bits_;
+    };
+
+    SIMDPP_INL explicit group_mask(uint64_t bits) : bits_(bits) {}
+
+    /// Returns the underlying bit mask
+    SIMDPP_INL uint64_t bits() const { return bits_; }
+
+    /// Returns @c true if any slot matched
+    SIMDPP_INL explicit operator bool() const { return bits_ != 0; }
+
+    /// Returns the index of the first matching slot. The set must not be empty
+    SIMDPP_INL unsigned lowest() const
+    {
+        return detail::insn::i_group_ctz(bits_) >> slot_shift;
+    }
+
+    /// Returns the index of the last matching slot. The set must not be empty
+    SIMDPP_INL unsigned highest() const
+    {
+        return detail::insn::i_group_msb(bits_) >> slot_shift;
+    }
+
+    /// Returns the number of matching slots
+    SIMDPP_INL unsigned count() const
+    {
+        return detail::insn::i_group_popcnt(bits_);
+    }
+
+    SIMDPP_INL iterator begin() const { return iterator(bits_); }
+    SIMDPP_INL iterator end() const { return iterator(0); }
+
+private:
+    uint64_t bits_;
+};
+
+/** Returns the set of slots of the group @a ctrl whose control byte is equal
+    to @a tag.
+
+    @code
+    r = { i : ctrl[i] == tag }
+    @endcode
+
+    The tag is broadcast and compared with the group, and the comparison mask
+    is converted to a bit mask. On SSE2-AVX2 this maps to @c pcmpeqb and
+    @c pmovmskb, on AVX512BW to @c vpcmpeqb with a mask register result and
+    on NEON to @c vceq and @c vshrn.
+*/
+template<unsigned N, class E> SIMDPP_INL
+group_mask<N> group_match(const uint8<N,E>& ctrl, uint8_t tag)
+{
+    return group_mask<N>(detail::insn::i_group_match(ctrl.eval(), tag));
+}
+
+/** Loads a group of @a N control bytes from @a ctrl and returns the set of
+    its slots whose control byte is equal to @a tag. @a ctrl does not need to
+    be aligned.
+*/
+template<unsigned N> SIMDPP_INL
+group_mask<N> group_match(const uint8_t* ctrl, uint8_t tag)
+{
+    uint8<N> c = load_u(ctrl);
+    return group_match(c, tag);
+}
+
+/// Returns the set of empty slots of the group @a ctrl
+template<unsigned N, class E> SIMDPP_INL
+group_mask<N> group_match_empty(const uint8<N,E>& ctrl)
+{
+    return group_mask<N>(detail::insn::i_group_match(ctrl.eval(), group_ctrl_empty));
+}
+
+template<unsigned N> SIMDPP_INL
+group_mask<N> group_match_empty(const uint8_t* ctrl)
+{
+    uint8<N> c = load_u(ctrl);
+    return group_match_empty(c);
+}
+
+/// Returns the set of deleted slots of the group @a ctrl
+template<unsigned N, class E> SIMDPP_INL
+group_mask<N> group_match_deleted(const uint8<N,E>& ctrl)
+{
+    return group_mask<N>(detail::insn::i_group_match(ctrl.eval(), group_ctrl_deleted));
+}
+
+template<unsigned N> SIMDPP_INL
+group_mask<N> group_match_deleted(const uint8_t* ctrl)
+{
+    uint8<N> c = load_u(ctrl);
+    return group_match_deleted(c);
+}
+
+/** Returns the set of empty or deleted slots of the group @a ctrl, that is,
+    the slots a new element may be inserted into. Needs a single signed
+    comparison.
+*/
+template<unsigned N, class E> SIMDPP_INL
+group_mask<N> group_match_empty_or_deleted(const uint8<N,E>& ctrl)
+{
+    return group_mask<N>(detail::insn::i_group_match_empty_or_deleted(ctrl.eval()));
+}
+
+template<unsigned N> SIMDPP_INL
+group_mask<N> group_match_empty_or_deleted(const uint8_t* ctrl)
+{
+    uint8<N> c = load_u(ctrl);
+    return group_match_empty_or_deleted(c);
+}
+
+/// Returns the set of full slots of the group @a ctrl
+template<unsigned N, class E> SIMDPP_INL
+group_mask<N> group_match_full(const uint8<N,E>& ctrl)
+{
+    return group_mask<N>(detail::insn::i_group_match_full(ctrl.eval()));
+}
+
+template<unsigned N> SIMDPP_INL
+group_mask<N> group_match_full(const uint8_t* ctrl)
+{
+    uint8<N> c = load_u(ctrl);
+    return group_match_full(c);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
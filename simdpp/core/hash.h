@@ -0,0 +1,122 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_HASH_H
+#define LIBSIMDPP_SIMDPP_CORE_HASH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/hash.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Hashes each 32-bit element using the MurmurHash3 @c fmix32 finalizer.
+    The function is a bijection, thus distinct keys never collide.
+
+    @code
+    h = a0
+    h ^= h >> 16;  h *= 0x85ebca6b
+    h ^= h >> 13;  h *= 0xc2b2ae35
+    h ^= h >> 16
+    r0 = h
+    ...
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> hash_fmix32(const uint32<N,E>& a)
+{
+    return detail::insn::hash_fmix32_op::vec(a.eval(), 0);
+}
+
+/** Hashes each 64-bit element using the MurmurHash3 @c fmix64 finalizer.
+    The function is a bijection, thus distinct keys never collide.
+
+    @code
+    h = a0
+    h ^= h >> 33;  h *= 0xff51afd7ed558ccd
+    h ^= h >> 33;  h *= 0xc4ceb9fe1a85ec53
+    h ^= h >> 33
+    r0 = h
+    ...
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> hash_fmix64(const uint64<N,E>& a)
+{
+    return detail::insn::hash_fmix64_op::vec(a.eval(), 0);
+}
+
+/** Computes the XXH32 hash of each 32-bit element. The result is the same as
+    the result of @c XXH32(&key, 4, seed) where @c key is stored in
+    little-endian byte order.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> hash_xxh32(const uint32<N,E>& keys, uint32_t seed = 0)
+{
+    return detail::insn::hash_xxh32_op::vec(keys.eval(), seed);
+}
+
+/** Computes the XXH64 hash of each 64-bit element. The result is the same as
+    the result of @c XXH64(&key, 8, seed) where @c key is stored in
+    little-endian byte order.
+
+    The 64-bit multiplications are emulated using three 32-bit multiplications
+    on instruction sets other than AVX512DQ and MSA, thus scalar code is
+    usually faster elsewhere.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> hash_xxh64(const uint64<N,E>& keys, uint64_t seed = 0)
+{
+    return detail::insn::hash_xxh64_op::vec(keys.eval(), seed);
+}
+
+/// Hashes the @a n keys at @a keys using hash_fmix32() and stores the results
+/// to @a out. @a out may be the same as @a keys.
+SIMDPP_INL void hash_fmix32(uint32_t* out, const uint32_t* keys, std::size_t n)
+{
+    using Op = detail::insn::hash_fmix32_op;
+    detail::insn::i_hash_array<uint32v, Op>(out, keys, n, uint32_t(0));
+}
+
+/// Hashes the @a n keys at @a keys using hash_fmix64() and stores the results
+/// to @a out. @a out may be the same as @a keys. The keys are hashed one by one
+/// unless 64-bit multiplication is supported natively.
+SIMDPP_INL void hash_fmix64(uint64_t* out, const uint64_t* keys, std::size_t n)
+{
+    using Op = detail::insn::hash_fmix64_op;
+    detail::insn::i_hash_array<uint64v, Op>(out, keys, n, uint64_t(0));
+}
+
+/// Hashes the @a n keys at @a keys using hash_xxh32() and stores the results
+/// to @a out. @a out may be the same as @a keys.
+SIMDPP_INL void hash_xxh32(uint32_t* out, const uint32_t* keys, std::size_t n,
+                           uint32_t seed = 0)
+{
+    using Op = detail::insn::hash_xxh32_op;
+    detail::insn::i_hash_array<uint32v, Op>(out, keys, n, seed);
+}
+
+/// Hashes the @a n keys at @a keys using hash_xxh64() and stores the results
+/// to @a out. @a out may be the same as @a keys. The keys are hashed one by one
+/// unless 64-bit multiplication is supported natively.
+SIMDPP_INL void hash_xxh64(uint64_t* out, const uint64_t* keys, std::size_t n,
+                           uint64_t seed = 0)
+{
+    using Op = detail::insn::hash_xxh64_op;
+    detail::insn::i_hash_array<uint64v, Op>(out, keys, n, seed);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,64 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_HEX_H
+#define LIBSIMDPP_SIMDPP_CORE_HEX_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/hex.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// The value returned by hex_decode() if the input is invalid
+static const std::size_t hex_invalid = detail::insn::hex_invalid_result;
+
+/** Encodes the @a n bytes at @a src to lowercase hexadecimal digits, the high
+    nibble of each byte first. Returns the number of characters written to
+    @a dst, which is <tt>2 * n</tt>.
+
+    The nibbles of each vector are converted to digits with a comparison and
+    interleaved using zip16_lo() and zip16_hi().
+*/
+SIMDPP_INL std::size_t hex_encode(const void* src, std::size_t n, char* dst)
+{
+    return detail::insn::i_hex_encode<false>(reinterpret_cast<const uint8_t*>(src),
+                                             n, dst);
+}
+
+/** Encodes the @a n bytes at @a src to uppercase hexadecimal digits. Otherwise
+    same as hex_encode().
+*/
+SIMDPP_INL std::size_t hex_encode_upper(const void* src, std::size_t n, char* dst)
+{
+    return detail::insn::i_hex_encode<true>(reinterpret_cast<const uint8_t*>(src),
+                                            n, dst);
+}
+
+/** Decodes the @a n hexadecimal digits of either case at @a src. Returns the
+    number of bytes written to @a dst, which is <tt>n / 2</tt>, or
+    @c hex_invalid if @a n is odd or the input contains other characters.
+    Output may have been written even if the input is invalid.
+
+    The digits are converted to their values with two range comparisons and
+    the pairs are merged using shifts of 16-bit elements.
+*/
+SIMDPP_INL std::size_t hex_decode(const char* src, std::size_t n, void* dst)
+{
+    return detail::insn::i_hex_decode(src, n, reinterpret_cast<uint8_t*>(dst));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/detail/expr/i_add.h>
+#include <simdpp/detail/insn/i_add.h>
 #include <simdpp/core/detail/get_expr_uint.h>
 #include <simdpp/core/detail/scalar_arg_impl.h>
 #include <simdpp/core/detail/get_expr_uint.h>
@@ -110,6 +111,238 @@ typename detail::get_expr_uint<expr_iadd, V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(add, expr_iadd, any_int64, int64)
 
+/** Adds 8-bit integer values in the elements selected by @a mask. The rest of
+    the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 + b0 : src0
+    ...
+    rN = maskN ? aN + bN : srcN
+    @endcode
+
+    On AVX-512BW this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(add(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint8<N,expr_empty> add(const uint8<N,E1>& a, const uint8<N,E2>& b,
+                        const mask_int8<N,E3>& mask, const uint8<N,E4>& src)
+{
+    return detail::insn::i_iadd_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int8<N,expr_empty> add(const int8<N,E1>& a, const int8<N,E2>& b,
+                       const mask_int8<N,E3>& mask, const int8<N,E4>& src)
+{
+    return (int8<N>) detail::insn::i_iadd_mask(uint8<N>(a.eval()),
+                                               uint8<N>(b.eval()),
+                                               mask.eval(),
+                                               uint8<N>(src.eval()));
+}
+
+/** Adds 8-bit integer values in the elements selected by @a mask. The rest of
+    the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 + b0 : 0
+    ...
+    rN = maskN ? aN + bN : 0
+    @endcode
+
+    On AVX-512BW this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(add(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint8<N,expr_empty> add_z(const uint8<N,E1>& a, const uint8<N,E2>& b,
+                          const mask_int8<N,E3>& mask)
+{
+    return detail::insn::i_iadd_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int8<N,expr_empty> add_z(const int8<N,E1>& a, const int8<N,E2>& b,
+                         const mask_int8<N,E3>& mask)
+{
+    return (int8<N>) detail::insn::i_iadd_maskz(uint8<N>(a.eval()),
+                                                uint8<N>(b.eval()),
+                                                mask.eval());
+}
+
+/** Adds 16-bit integer values in the elements selected by @a mask. The rest of
+    the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 + b0 : src0
+    ...
+    rN = maskN ? aN + bN : srcN
+    @endcode
+
+    On AVX-512BW this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(add(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint16<N,expr_empty> add(const uint16<N,E1>& a, const uint16<N,E2>& b,
+                         const mask_int16<N,E3>& mask, const uint16<N,E4>& src)
+{
+    return detail::insn::i_iadd_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int16<N,expr_empty> add(const int16<N,E1>& a, const int16<N,E2>& b,
+                        const mask_int16<N,E3>& mask, const int16<N,E4>& src)
+{
+    return (int16<N>) detail::insn::i_iadd_mask(uint16<N>(a.eval()),
+                                                uint16<N>(b.eval()),
+                                                mask.eval(),
+                                                uint16<N>(src.eval()));
+}
+
+/** Adds 16-bit integer values in the elements selected by @a mask. The rest of
+    the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 + b0 : 0
+    ...
+    rN = maskN ? aN + bN : 0
+    @endcode
+
+    On AVX-512BW this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(add(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint16<N,expr_empty> add_z(const uint16<N,E1>& a, const uint16<N,E2>& b,
+                           const mask_int16<N,E3>& mask)
+{
+    return detail::insn::i_iadd_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int16<N,expr_empty> add_z(const int16<N,E1>& a, const int16<N,E2>& b,
+                          const mask_int16<N,E3>& mask)
+{
+    return (int16<N>) detail::insn::i_iadd_maskz(uint16<N>(a.eval()),
+                                                 uint16<N>(b.eval()),
+                                                 mask.eval());
+}
+
+/** Adds 32-bit integer values in the elements selected by @a mask. The rest of
+    the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 + b0 : src0
+    ...
+    rN = maskN ? aN + bN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(add(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint32<N,expr_empty> add(const uint32<N,E1>& a, const uint32<N,E2>& b,
+                         const mask_int32<N,E3>& mask, const uint32<N,E4>& src)
+{
+    return detail::insn::i_iadd_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int32<N,expr_empty> add(const int32<N,E1>& a, const int32<N,E2>& b,
+                        const mask_int32<N,E3>& mask, const int32<N,E4>& src)
+{
+    return (int32<N>) detail::insn::i_iadd_mask(uint32<N>(a.eval()),
+                                                uint32<N>(b.eval()),
+                                                mask.eval(),
+                                                uint32<N>(src.eval()));
+}
+
+/** Adds 32-bit integer values in the elements selected by @a mask. The rest of
+    the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 + b0 : 0
+    ...
+    rN = maskN ? aN + bN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(add(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint32<N,expr_empty> add_z(const uint32<N,E1>& a, const uint32<N,E2>& b,
+                           const mask_int32<N,E3>& mask)
+{
+    return detail::insn::i_iadd_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N,expr_empty> add_z(const int32<N,E1>& a, const int32<N,E2>& b,
+                          const mask_int32<N,E3>& mask)
+{
+    return (int32<N>) detail::insn::i_iadd_maskz(uint32<N>(a.eval()),
+                                                 uint32<N>(b.eval()),
+                                                 mask.eval());
+}
+
+/** Adds 64-bit integer values in the elements selected by @a mask. The rest of
+    the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 + b0 : src0
+    ...
+    rN = maskN ? aN + bN : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(add(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint64<N,expr_empty> add(const uint64<N,E1>& a, const uint64<N,E2>& b,
+                         const mask_int64<N,E3>& mask, const uint64<N,E4>& src)
+{
+    return detail::insn::i_iadd_mask(a.eval(), b.eval(), mask.eval(),
+                                     src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int64<N,expr_empty> add(const int64<N,E1>& a, const int64<N,E2>& b,
+                        const mask_int64<N,E3>& mask, const int64<N,E4>& src)
+{
+    return (int64<N>) detail::insn::i_iadd_mask(uint64<N>(a.eval()),
+                                                uint64<N>(b.eval()),
+                                                mask.eval(),
+                                                uint64<N>(src.eval()));
+}
+
+/** Adds 64-bit integer values in the elements selected by @a mask. The rest of
+    the elements are set to zero.
+
+    @code
+    r0 = mask0 ? a0 + b0 : 0
+    ...
+    rN = maskN ? aN + bN : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(add(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint64<N,expr_empty> add_z(const uint64<N,E1>& a, const uint64<N,E2>& b,
+                           const mask_int64<N,E3>& mask)
+{
+    return detail::insn::i_iadd_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int64<N,expr_empty> add_z(const int64<N,E1>& a, const int64<N,E2>& b,
+                          const mask_int64<N,E3>& mask)
+{
+    return (int64<N>) detail::insn::i_iadd_maskz(uint64<N>(a.eval()),
+                                                 uint64<N>(b.eval()),
+                                                 mask.eval());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
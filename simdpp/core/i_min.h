@@ -187,6 +187,318 @@ uint64<N,expr_empty> min(const uint64<N,E1>& a, const uint64<N,E2>& b)
 
 SIMDPP_SCALAR_ARG_IMPL_VEC(min, uint64, uint64)
 
+/** Computes minimum of the signed 8-bit values in the elements selected by @a
+    mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512BW this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int8<N,expr_empty> min(const int8<N,E1>& a, const int8<N,E2>& b,
+                       const mask_int8<N,E3>& mask, const int8<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the signed 8-bit values in the elements selected by @a
+    mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512BW this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int8<N,expr_empty> min_z(const int8<N,E1>& a, const int8<N,E2>& b,
+                         const mask_int8<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Computes minimum of the unsigned 8-bit values in the elements selected by
+    @a mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512BW this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint8<N,expr_empty> min(const uint8<N,E1>& a, const uint8<N,E2>& b,
+                        const mask_int8<N,E3>& mask, const uint8<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the unsigned 8-bit values in the elements selected by
+    @a mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512BW this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint8<N,expr_empty> min_z(const uint8<N,E1>& a, const uint8<N,E2>& b,
+                          const mask_int8<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Computes minimum of the signed 16-bit values in the elements selected by @a
+    mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512BW this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int16<N,expr_empty> min(const int16<N,E1>& a, const int16<N,E2>& b,
+                        const mask_int16<N,E3>& mask, const int16<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the signed 16-bit values in the elements selected by @a
+    mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512BW this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int16<N,expr_empty> min_z(const int16<N,E1>& a, const int16<N,E2>& b,
+                          const mask_int16<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Computes minimum of the unsigned 16-bit values in the elements selected by
+    @a mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512BW this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint16<N,expr_empty> min(const uint16<N,E1>& a, const uint16<N,E2>& b,
+                         const mask_int16<N,E3>& mask, const uint16<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the unsigned 16-bit values in the elements selected by
+    @a mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512BW this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint16<N,expr_empty> min_z(const uint16<N,E1>& a, const uint16<N,E2>& b,
+                           const mask_int16<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Computes minimum of the signed 32-bit values in the elements selected by @a
+    mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int32<N,expr_empty> min(const int32<N,E1>& a, const int32<N,E2>& b,
+                        const mask_int32<N,E3>& mask, const int32<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the signed 32-bit values in the elements selected by @a
+    mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N,expr_empty> min_z(const int32<N,E1>& a, const int32<N,E2>& b,
+                          const mask_int32<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Computes minimum of the unsigned 32-bit values in the elements selected by
+    @a mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint32<N,expr_empty> min(const uint32<N,E1>& a, const uint32<N,E2>& b,
+                         const mask_int32<N,E3>& mask, const uint32<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the unsigned 32-bit values in the elements selected by
+    @a mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint32<N,expr_empty> min_z(const uint32<N,E1>& a, const uint32<N,E2>& b,
+                           const mask_int32<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Computes minimum of the signed 64-bit values in the elements selected by @a
+    mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int64<N,expr_empty> min(const int64<N,E1>& a, const int64<N,E2>& b,
+                        const mask_int64<N,E3>& mask, const int64<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the signed 64-bit values in the elements selected by @a
+    mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int64<N,expr_empty> min_z(const int64<N,E1>& a, const int64<N,E2>& b,
+                          const mask_int64<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+/** Computes minimum of the unsigned 64-bit values in the elements selected by
+    @a mask. The rest of the elements are copied from @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(min(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint64<N,expr_empty> min(const uint64<N,E1>& a, const uint64<N,E2>& b,
+                         const mask_int64<N,E3>& mask, const uint64<N,E4>& src)
+{
+    return detail::insn::i_min_mask(a.eval(), b.eval(), mask.eval(),
+                                    src.eval());
+}
+
+/** Computes minimum of the unsigned 64-bit values in the elements selected by
+    @a mask. The rest of the elements are set to zero.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(min(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint64<N,expr_empty> min_z(const uint64<N,E1>& a, const uint64<N,E2>& b,
+                           const mask_int64<N,E3>& mask)
+{
+    return detail::insn::i_min_maskz(a.eval(), b.eval(), mask.eval());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/detail/expr/i_mul.h>
+#include <simdpp/detail/insn/i_mul_lo.h>
 #include <simdpp/core/detail/get_expr_uint.h>
 #include <simdpp/core/detail/scalar_arg_impl.h>
 #include <simdpp/core/detail/get_expr_uint.h>
@@ -121,6 +122,156 @@ typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int32, int32)
 
+/** Multiplies 64-bit values and returns the lower part of the multiplication
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, 7}
+    @icost{NEON, 5}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 14}
+    @icost{AVX2, 7}
+    @icost{NEON, 10}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        mul_lo(const any_int64<N,V1>& a,
+               const any_int64<N,V2>& b)
+{
+    return { { a.wrapped(), b.wrapped() } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int64, int64)
+
+/** Multiplies 16-bit values and returns the lower part of the multiplication
+    in the elements selected by @a mask. The rest of the elements are copied
+    from @a src.
+
+    @code
+    r0 = mask0 ? low(a0 * b0) : src0
+    ...
+    rN = maskN ? low(aN * bN) : srcN
+    @endcode
+
+    On AVX-512BW this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(mul_lo(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint16<N,expr_empty> mul_lo(const uint16<N,E1>& a, const uint16<N,E2>& b,
+                            const mask_int16<N,E3>& mask,
+                            const uint16<N,E4>& src)
+{
+    return detail::insn::i_mul_lo_mask(a.eval(), b.eval(), mask.eval(),
+                                       src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int16<N,expr_empty> mul_lo(const int16<N,E1>& a, const int16<N,E2>& b,
+                           const mask_int16<N,E3>& mask,
+                           const int16<N,E4>& src)
+{
+    return (int16<N>) detail::insn::i_mul_lo_mask(uint16<N>(a.eval()),
+                                                  uint16<N>(b.eval()),
+                                                  mask.eval(),
+                                                  uint16<N>(src.eval()));
+}
+
+/** Multiplies 16-bit values and returns the lower part of the multiplication
+    in the elements selected by @a mask. The rest of the elements are set to
+    zero.
+
+    @code
+    r0 = mask0 ? low(a0 * b0) : 0
+    ...
+    rN = maskN ? low(aN * bN) : 0
+    @endcode
+
+    On AVX-512BW this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(mul_lo(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint16<N,expr_empty> mul_lo_z(const uint16<N,E1>& a, const uint16<N,E2>& b,
+                              const mask_int16<N,E3>& mask)
+{
+    return detail::insn::i_mul_lo_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int16<N,expr_empty> mul_lo_z(const int16<N,E1>& a, const int16<N,E2>& b,
+                             const mask_int16<N,E3>& mask)
+{
+    return (int16<N>) detail::insn::i_mul_lo_maskz(uint16<N>(a.eval()),
+                                                   uint16<N>(b.eval()),
+                                                   mask.eval());
+}
+
+/** Multiplies 32-bit values and returns the lower part of the multiplication
+    in the elements selected by @a mask. The rest of the elements are copied
+    from @a src.
+
+    @code
+    r0 = mask0 ? low(a0 * b0) : src0
+    ...
+    rN = maskN ? low(aN * bN) : srcN
+    @endcode
+
+    On AVX-512 this maps to a single merge-masked instruction. Elsewhere
+    the result is computed as @c blend(mul_lo(a, b), src, mask).
+*/
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+uint32<N,expr_empty> mul_lo(const uint32<N,E1>& a, const uint32<N,E2>& b,
+                            const mask_int32<N,E3>& mask,
+                            const uint32<N,E4>& src)
+{
+    return detail::insn::i_mul_lo_mask(a.eval(), b.eval(), mask.eval(),
+                                       src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3, class E4> SIMDPP_INL
+int32<N,expr_empty> mul_lo(const int32<N,E1>& a, const int32<N,E2>& b,
+                           const mask_int32<N,E3>& mask,
+                           const int32<N,E4>& src)
+{
+    return (int32<N>) detail::insn::i_mul_lo_mask(uint32<N>(a.eval()),
+                                                  uint32<N>(b.eval()),
+                                                  mask.eval(),
+                                                  uint32<N>(src.eval()));
+}
+
+/** Multiplies 32-bit values and returns the lower part of the multiplication
+    in the elements selected by @a mask. The rest of the elements are set to
+    zero.
+
+    @code
+    r0 = mask0 ? low(a0 * b0) : 0
+    ...
+    rN = maskN ? low(aN * bN) : 0
+    @endcode
+
+    On AVX-512 this maps to a single zero-masked instruction. Elsewhere
+    the result is computed as @c bit_and(mul_lo(a, b), mask).
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint32<N,expr_empty> mul_lo_z(const uint32<N,E1>& a, const uint32<N,E2>& b,
+                              const mask_int32<N,E3>& mask)
+{
+    return detail::insn::i_mul_lo_maskz(a.eval(), b.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N,expr_empty> mul_lo_z(const int32<N,E1>& a, const int32<N,E2>& b,
+                             const mask_int32<N,E3>& mask)
+{
+    return (int32<N>) detail::insn::i_mul_lo_maskz(uint32<N>(a.eval()),
+                                                   uint32<N>(b.eval()),
+                                                   mask.eval());
+}
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
@@ -0,0 +1,120 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_ROTATE_H
+#define LIBSIMDPP_SIMDPP_CORE_I_ROTATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_rotate.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Rotates 32-bit values left by @a count bits. The bits shifted out of the
+    top of each element are shifted in at the bottom.
+
+    @code
+    r0 = (a0 << count) | (a0 >> (32 - count))
+    ...
+    rN = (aN << count) | (aN >> (32 - count))
+    @endcode
+
+    Maps to a single instruction on AVX512F (AVX512VL for 128 and 256-bit
+    vectors), XOP and ALTIVEC and to two instructions on NEON.
+*/
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> rotate_l(const uint32<N,E>& a)
+{
+    static_assert(count < 32, "Rotation count out of range");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> rotate_l(const int32<N,E>& a)
+{
+    return int32<N>(rotate_l<count>(uint32<N>(a.eval())));
+}
+
+/** Rotates 64-bit values left by @a count bits. The bits shifted out of the
+    top of each element are shifted in at the bottom.
+
+    @code
+    r0 = (a0 << count) | (a0 >> (64 - count))
+    ...
+    rN = (aN << count) | (aN >> (64 - count))
+    @endcode
+
+    Maps to a single instruction on AVX512F (AVX512VL for 128 and 256-bit
+    vectors), XOP and POWER8 and to two instructions on NEON.
+*/
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> rotate_l(const uint64<N,E>& a)
+{
+    static_assert(count < 64, "Rotation count out of range");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> rotate_l(const int64<N,E>& a)
+{
+    return int64<N>(rotate_l<count>(uint64<N>(a.eval())));
+}
+
+/** Rotates 32-bit values right by @a count bits. The bits shifted out of the
+    bottom of each element are shifted in at the top.
+
+    @code
+    r0 = (a0 >> count) | (a0 << (32 - count))
+    ...
+    rN = (aN >> count) | (aN << (32 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> rotate_r(const uint32<N,E>& a)
+{
+    static_assert(count < 32, "Rotation count out of range");
+    return rotate_l<(32 - count) % 32>(a);
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> rotate_r(const int32<N,E>& a)
+{
+    static_assert(count < 32, "Rotation count out of range");
+    return rotate_l<(32 - count) % 32>(a);
+}
+
+/** Rotates 64-bit values right by @a count bits. The bits shifted out of the
+    bottom of each element are shifted in at the top.
+
+    @code
+    r0 = (a0 >> count) | (a0 << (64 - count))
+    ...
+    rN = (aN >> count) | (aN << (64 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> rotate_r(const uint64<N,E>& a)
+{
+    static_assert(count < 64, "Rotation count out of range");
+    return rotate_l<(64 - count) % 64>(a);
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> rotate_r(const int64<N,E>& a)
+{
+    static_assert(count < 64, "Rotation count out of range");
+    return rotate_l<(64 - count) % 64>(a);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,60 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_FIRST_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_FIRST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_first.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the first @a n elements of a vector from an unaligned memory
+    location. The rest of the elements are set to zero. If @a n is larger than
+    the number of elements in the vector, the whole vector is loaded.
+
+    Memory past the first @a n elements is never accessed in a way that may
+    fault, thus the function can be used to load the tail of an array without a
+    scalar epilogue.
+
+    @code
+    r0 = *(p)
+    ...
+    r{n-1} = *(p+n-1)
+    r{n} = 0
+    ...
+    r{N-1} = 0
+    @endcode
+
+    @a p must be aligned to the element size. This is load_masked_u() with a
+    mask selecting the first @a n elements: masked loads are used on AVX and
+    AVX-512, whereas on other instruction sets the whole vector is loaded if
+    it does not cross a page boundary.
+*/
+template<class T> SIMDPP_INL
+expr_vec_load_first load_first(const T* p, unsigned n)
+{
+    return expr_vec_load_first(reinterpret_cast<const char*>(p), n);
+}
+
+template<class V, class T> SIMDPP_INL
+V load_first(const T* p, unsigned n)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    return detail::insn::i_load_first_any<V>(reinterpret_cast<const char*>(p), n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,57 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_LAST_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_LAST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_last.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the last @a n elements of a vector from an unaligned memory location.
+    The rest of the elements are set to zero. If @a n is larger than the number
+    of elements in the vector, the whole vector is loaded.
+
+    Memory before the last @a n elements is never accessed in a way that may
+    fault.
+
+    @code
+    r0 = 0
+    ...
+    r{N-n-1} = 0
+    r{N-n} = *(p+N-n)
+    ...
+    r{N-1} = *(p+N-1)
+    @endcode
+
+    @a p must be aligned to the element size. The same instructions as in
+    load_first() are used.
+*/
+template<class T> SIMDPP_INL
+expr_vec_load_last load_last(const T* p, unsigned n)
+{
+    return expr_vec_load_last(reinterpret_cast<const char*>(p), n);
+}
+
+template<class V, class T> SIMDPP_INL
+V load_last(const T* p, unsigned n)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    return detail::insn::i_load_last_any<V>(reinterpret_cast<const char*>(p), n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,147 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_masked.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the elements selected by @a mask from memory. The rest of the
+    elements of the result are set to zero. Memory corresponding to the
+    elements that are not selected is never accessed in a way that may fault,
+    thus the function can be used to process the tail of an array without a
+    scalar epilogue.
+
+    The type of the returned vector is determined by the type of the mask:
+    unsigned integer vectors are returned for integer masks.
+
+    @code
+    r0 = mask0 ? *(p) : 0
+    ...
+    rN = maskN ? *(p+N) : 0
+    @endcode
+
+    The pointer must be aligned to the native vector size.
+
+    On AVX512VL (and AVX512BW for 8 and 16-bit elements) a single masked load
+    is used. 32 and 64-bit elements are loaded via @c vmaskmov on AVX and AVX2.
+    On other instruction sets the whole vector is loaded if any of the elements
+    is selected, which can not fault as the vector is aligned.
+*/
+template<class T, unsigned N, class M> SIMDPP_INL
+uint8<N> load_masked(const T* p, const mask_int8<N,M>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint16<N> load_masked(const T* p, const mask_int16<N,M>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint32<N> load_masked(const T* p, const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint64<N> load_masked(const T* p, const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+float32<N> load_masked(const T* p, const mask_float32<N,M>& mask)
+{
+    float32<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+float64<N> load_masked(const T* p, const mask_float64<N,M>& mask)
+{
+    float64<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+
+/** Loads the elements selected by @a mask from an unaligned memory location.
+    The rest of the elements of the result are set to zero. Memory
+    corresponding to the elements that are not selected is never accessed in a
+    way that may fault.
+
+    @code
+    r0 = mask0 ? *(p) : 0
+    ...
+    rN = maskN ? *(p+N) : 0
+    @endcode
+
+    @a p must be aligned to the element size. On instruction sets without
+    native masked loads the whole vector is loaded if it does not cross a page
+    boundary, otherwise the elements are loaded one by one.
+*/
+template<class T, unsigned N, class M> SIMDPP_INL
+uint8<N> load_masked_u(const T* p, const mask_int8<N,M>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_load_masked_u(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint16<N> load_masked_u(const T* p, const mask_int16<N,M>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_load_masked_u(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint32<N> load_masked_u(const T* p, const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_load_masked_u(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint64<N> load_masked_u(const T* p, const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_load_masked_u(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+float32<N> load_masked_u(const T* p, const mask_float32<N,M>& mask)
+{
+    float32<N> r;
+    detail::insn::i_load_masked_u(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+float64<N> load_masked_u(const T* p, const mask_float64<N,M>& mask)
+{
+    float64<N> r;
+    detail::insn::i_load_masked_u(r, reinterpret_cast<const char*>(p), mask.wrapped().eval());
+    return r;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,382 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SCAN_H
+#define LIBSIMDPP_SIMDPP_CORE_SCAN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/scan.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the inclusive prefix sum of the elements of a vector.
+
+    @code
+    r0 = a0
+    r1 = a0 + a1
+    ...
+    rN = a0 + a1 + ... + aN
+    @endcode
+
+    The sum is computed in log2(N) steps, each of which shifts the partial sums
+    by a power of two elements and adds them. Vectors wider than 128 bits are
+    scanned in 128-bit parts and the last element of each part is broadcast
+    and added to the following parts. For floating-point vectors the order of
+    additions differs from sequential summation, thus the results may differ
+    in the last bits.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> scan_add(const int8<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> scan_add(const uint8<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> scan_add(const int16<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> scan_add(const uint16<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> scan_add(const int32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> scan_add(const uint32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> scan_add(const int64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> scan_add(const uint64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> scan_add(const float32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> scan_add(const float64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_add>(a.eval());
+}
+
+/** Computes the inclusive prefix maximum of the elements of a vector.
+
+    @code
+    r0 = a0
+    r1 = max(a0, a1)
+    ...
+    rN = max(a0, a1, ..., aN)
+    @endcode
+
+    The implementation is the same as of scan_add(). The 64-bit integer
+    variants are available only where 64-bit max() and min() are.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> scan_max(const int8<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> scan_max(const uint8<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> scan_max(const int16<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> scan_max(const uint16<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> scan_max(const int32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> scan_max(const uint32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> scan_max(const int64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> scan_max(const uint64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> scan_max(const float32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> scan_max(const float64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_max>(a.eval());
+}
+
+/** Computes the inclusive prefix minimum of the elements of a vector.
+
+    @code
+    r0 = a0
+    r1 = min(a0, a1)
+    ...
+    rN = min(a0, a1, ..., aN)
+    @endcode
+
+    The implementation is the same as of scan_add(). The 64-bit integer
+    variants are available only where 64-bit max() and min() are.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> scan_min(const int8<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> scan_min(const uint8<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> scan_min(const int16<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> scan_min(const uint16<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> scan_min(const int32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> scan_min(const uint32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> scan_min(const int64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> scan_min(const uint64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> scan_min(const float32<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> scan_min(const float64<N,E>& a)
+{
+    return detail::insn::i_scan<detail::insn::scan_op_min>(a.eval());
+}
+
+/** Computes the inclusive prefix sum of an array and returns the sum of all
+    elements. @a init is added to all results, which allows to scan an array
+    in chunks by passing the result of the previous call.
+
+    @code
+    dst[0] = init + src[0]
+    dst[1] = init + src[0] + src[1]
+    ...
+    dst[n-1] = init + src[0] + ... + src[n-1]
+    @endcode
+
+    @a dst and @a src may be the same pointer, but must not otherwise overlap.
+    Neither pointer needs to be aligned. Each vector of input elements is
+    scanned with scan_add() and the broadcast of the last element of the
+    previous result is added to it.
+*/
+SIMDPP_INL int8_t scan_add(int8_t* dst, const int8_t* src,
+                           std::size_t n, int8_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int8v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL uint8_t scan_add(uint8_t* dst, const uint8_t* src,
+                            std::size_t n, uint8_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint8v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL int16_t scan_add(int16_t* dst, const int16_t* src,
+                            std::size_t n, int16_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int16v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL uint16_t scan_add(uint16_t* dst, const uint16_t* src,
+                             std::size_t n, uint16_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint16v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL int32_t scan_add(int32_t* dst, const int32_t* src,
+                            std::size_t n, int32_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int32v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL uint32_t scan_add(uint32_t* dst, const uint32_t* src,
+                             std::size_t n, uint32_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint32v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL int64_t scan_add(int64_t* dst, const int64_t* src,
+                            std::size_t n, int64_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int64v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL uint64_t scan_add(uint64_t* dst, const uint64_t* src,
+                             std::size_t n, uint64_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint64v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL float scan_add(float* dst, const float* src,
+                          std::size_t n, float init = 0)
+{
+    return detail::insn::i_scan_add_array<float32v, false>(dst, src, n, init);
+}
+
+SIMDPP_INL double scan_add(double* dst, const double* src,
+                           std::size_t n, double init = 0)
+{
+    return detail::insn::i_scan_add_array<float64v, false>(dst, src, n, init);
+}
+
+/** Computes the exclusive prefix sum of an array and returns the sum of all
+    elements. Only integer arrays are supported.
+
+    @code
+    dst[0] = init
+    dst[1] = init + src[0]
+    ...
+    dst[n-1] = init + src[0] + ... + src[n-2]
+    @endcode
+
+    The requirements are the same as of the array variant of scan_add().
+*/
+SIMDPP_INL int8_t scan_add_exclusive(int8_t* dst, const int8_t* src,
+                                     std::size_t n, int8_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int8v, true>(dst, src, n, init);
+}
+
+SIMDPP_INL uint8_t scan_add_exclusive(uint8_t* dst, const uint8_t* src,
+                                      std::size_t n, uint8_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint8v, true>(dst, src, n, init);
+}
+
+SIMDPP_INL int16_t scan_add_exclusive(int16_t* dst, const int16_t* src,
+                                      std::size_t n, int16_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int16v, true>(dst, src, n, init);
+}
+
+SIMDPP_INL uint16_t scan_add_exclusive(uint16_t* dst, const uint16_t* src,
+                                       std::size_t n, uint16_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint16v, true>(dst, src, n, init);
+}
+
+SIMDPP_INL int32_t scan_add_exclusive(int32_t* dst, const int32_t* src,
+                                      std::size_t n, int32_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int32v, true>(dst, src, n, init);
+}
+
+SIMDPP_INL uint32_t scan_add_exclusive(uint32_t* dst, const uint32_t* src,
+                                       std::size_t n, uint32_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint32v, true>(dst, src, n, init);
+}
+
+SIMDPP_INL int64_t scan_add_exclusive(int64_t* dst, const int64_t* src,
+                                      std::size_t n, int64_t init = 0)
+{
+    return detail::insn::i_scan_add_array<int64v, true>(dst, src, n, init);
+}
+
+SIMDPP_INL uint64_t scan_add_exclusive(uint64_t* dst, const uint64_t* src,
+                                       std::size_t n, uint64_t init = 0)
+{
+    return detail::insn::i_scan_add_array<uint64v, true>(dst, src, n, init);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
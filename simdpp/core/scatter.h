@@ -0,0 +1,124 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/scatter.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores the elements of a vector to memory at the given indices.
+
+    @code
+    base[idx0] = a0
+    ...
+    base[idxN] = aN
+    @endcode
+
+    The indices are element indices, not byte offsets, and are interpreted as
+    signed values. The elements are stored in order, thus if several indices
+    are equal, the element with the highest index in the vector is the one
+    that ends up in memory.
+
+    On AVX512F this maps to @c vpscatterdd, @c vpscatterqq, @c vscatterdps or
+    @c vscatterqpd (128 and 256-bit vectors additionally need AVX512VL). On
+    other instruction sets the elements are stored one by one.
+*/
+template<class T, unsigned N, class V1, class V2> SIMDPP_INL
+void scatter(T* base, const any_int32<N,V1>& idx, const any_int32<N,V2>& a)
+{
+    detail::insn::i_scatter(reinterpret_cast<char*>(base),
+                            uint32<N>(idx.wrapped().eval()),
+                            uint32<N>(a.wrapped().eval()));
+}
+
+template<class T, unsigned N, class V1, class V2> SIMDPP_INL
+void scatter(T* base, const any_int64<N,V1>& idx, const any_int64<N,V2>& a)
+{
+    detail::insn::i_scatter(reinterpret_cast<char*>(base),
+                            uint64<N>(idx.wrapped().eval()),
+                            uint64<N>(a.wrapped().eval()));
+}
+
+template<class T, unsigned N, class V1, class V2> SIMDPP_INL
+void scatter(T* base, const any_int32<N,V1>& idx, const any_float32<N,V2>& a)
+{
+    detail::insn::i_scatter(reinterpret_cast<char*>(base),
+                            uint32<N>(idx.wrapped().eval()),
+                            a.wrapped().eval());
+}
+
+template<class T, unsigned N, class V1, class V2> SIMDPP_INL
+void scatter(T* base, const any_int64<N,V1>& idx, const any_float64<N,V2>& a)
+{
+    detail::insn::i_scatter(reinterpret_cast<char*>(base),
+                            uint64<N>(idx.wrapped().eval()),
+                            a.wrapped().eval());
+}
+
+/** Stores the elements selected by @a mask to memory at the given indices.
+    The memory that the rest of the elements point to is not accessed.
+
+    @code
+    if (mask0) base[idx0] = a0
+    ...
+    if (maskN) base[idxN] = aN
+    @endcode
+
+    On AVX512F this maps to a single masked scatter instruction (128 and
+    256-bit vectors additionally need AVX512VL). On other instruction sets the
+    selected elements are stored one by one.
+*/
+template<class T, unsigned N, class V1, class V2, class M> SIMDPP_INL
+void scatter_masked(T* base, const any_int32<N,V1>& idx,
+                    const any_int32<N,V2>& a, const mask_int32<N,M>& mask)
+{
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base),
+                                   uint32<N>(idx.wrapped().eval()),
+                                   uint32<N>(a.wrapped().eval()),
+                                   mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V1, class V2, class M> SIMDPP_INL
+void scatter_masked(T* base, const any_int64<N,V1>& idx,
+                    const any_int64<N,V2>& a, const mask_int64<N,M>& mask)
+{
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base),
+                                   uint64<N>(idx.wrapped().eval()),
+                                   uint64<N>(a.wrapped().eval()),
+                                   mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V1, class V2, class M> SIMDPP_INL
+void scatter_masked(T* base, const any_int32<N,V1>& idx,
+                    const any_float32<N,V2>& a, const mask_float32<N,M>& mask)
+{
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base),
+                                   uint32<N>(idx.wrapped().eval()),
+                                   a.wrapped().eval(), mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V1, class V2, class M> SIMDPP_INL
+void scatter_masked(T* base, const any_int64<N,V1>& idx,
+                    const any_float64<N,V2>& a, const mask_float64<N,M>& mask)
+{
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base),
+                                   uint64<N>(idx.wrapped().eval()),
+                                   a.wrapped().eval(), mask.wrapped().eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
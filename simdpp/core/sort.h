@@ -0,0 +1,244 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SORT_H
+#define LIBSIMDPP_SIMDPP_CORE_SORT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/sort.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Sorts the elements of a vector in ascending order using a bitonic sorting
+    network.
+
+    @code
+    r = [ a0 ... aN ] sorted
+    @endcode
+
+    Vectors of 128 bits are sorted with permutations and min/max operations.
+    Wider vectors are sorted in 128-bit parts which are then merged using
+    merge_bitonic(). Floating-point elements are compared using min() and
+    max(), thus the results are unspecified if the vector contains NaNs and
+    -0.0 and 0.0 may be swapped. The 64-bit integer variants are available
+    only where 64-bit max() and min() are.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> sort_bitonic(const int32<N,E>& a)
+{
+    return detail::insn::i_sort_vector(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> sort_bitonic(const uint32<N,E>& a)
+{
+    return detail::insn::i_sort_vector(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> sort_bitonic(const float32<N,E>& a)
+{
+    return detail::insn::i_sort_vector(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> sort_bitonic(const int64<N,E>& a)
+{
+    return detail::insn::i_sort_vector(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> sort_bitonic(const uint64<N,E>& a)
+{
+    return detail::insn::i_sort_vector(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> sort_bitonic(const float64<N,E>& a)
+{
+    return detail::insn::i_sort_vector(a.eval());
+}
+
+/** Merges two vectors whose elements are sorted in ascending order. On return
+    @a a contains the smaller half of the elements and @a b the larger half,
+    both sorted.
+
+    @code
+    [ a, b ] = [ a0 ... aN, b0 ... bN ] sorted
+    @endcode
+
+    The second vector is reversed which makes the concatenation of the inputs
+    a bitonic sequence. A single min/max step separates the smaller and the
+    larger halves, each of which is then sorted by log2(N) compare-exchange
+    steps. The same restrictions as for sort_bitonic() apply.
+*/
+template<unsigned N> SIMDPP_INL
+void merge_bitonic(int32<N>& a, int32<N>& b)
+{
+    detail::insn::i_sort_merge(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+void merge_bitonic(uint32<N>& a, uint32<N>& b)
+{
+    detail::insn::i_sort_merge(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+void merge_bitonic(float32<N>& a, float32<N>& b)
+{
+    detail::insn::i_sort_merge(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+void merge_bitonic(int64<N>& a, int64<N>& b)
+{
+    detail::insn::i_sort_merge(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+void merge_bitonic(uint64<N>& a, uint64<N>& b)
+{
+    detail::insn::i_sort_merge(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+void merge_bitonic(float64<N>& a, float64<N>& b)
+{
+    detail::insn::i_sort_merge(a, b);
+}
+
+/** Sorts the elements at each position of four vectors using an odd-even
+    merge sorting network of five compare-exchange steps. After the call
+    the elements of each column are sorted in ascending order.
+
+    @code
+    [ a0_0, a1_0, a2_0, a3_0 ] = [ a0_0, a1_0, a2_0, a3_0 ] sorted
+    ...
+    [ a0_N, a1_N, a2_N, a3_N ] = [ a0_N, a1_N, a2_N, a3_N ] sorted
+    @endcode
+
+    Combined with transpose4() this sorts 4x4 blocks. The same restrictions
+    as for sort_bitonic() apply.
+*/
+template<unsigned N> SIMDPP_INL
+void sort_columns(int32<N>& a0, int32<N>& a1, int32<N>& a2, int32<N>& a3)
+{
+    detail::insn::i_sort_columns(a0, a1, a2, a3);
+}
+
+template<unsigned N> SIMDPP_INL
+void sort_columns(uint32<N>& a0, uint32<N>& a1, uint32<N>& a2, uint32<N>& a3)
+{
+    detail::insn::i_sort_columns(a0, a1, a2, a3);
+}
+
+template<unsigned N> SIMDPP_INL
+void sort_columns(float32<N>& a0, float32<N>& a1, float32<N>& a2, float32<N>& a3)
+{
+    detail::insn::i_sort_columns(a0, a1, a2, a3);
+}
+
+template<unsigned N> SIMDPP_INL
+void sort_columns(int64<N>& a0, int64<N>& a1, int64<N>& a2, int64<N>& a3)
+{
+    detail::insn::i_sort_columns(a0, a1, a2, a3);
+}
+
+template<unsigned N> SIMDPP_INL
+void sort_columns(uint64<N>& a0, uint64<N>& a1, uint64<N>& a2, uint64<N>& a3)
+{
+    detail::insn::i_sort_columns(a0, a1, a2, a3);
+}
+
+template<unsigned N> SIMDPP_INL
+void sort_columns(float64<N>& a0, float64<N>& a1, float64<N>& a2, float64<N>& a3)
+{
+    detail::insn::i_sort_columns(a0, a1, a2, a3);
+}
+
+/** Sorts the elements in the range [first, last) in ascending order. The
+    sort is not stable.
+
+    Floating-point values are ordered by their bit patterns mapped to integers,
+    which agrees with the usual order and additionally orders -0.0 before 0.0,
+    negative NaNs before all other values and positive NaNs after them.
+
+    The elements are copied to a temporary buffer in which runs of two vectors
+    are sorted with sort_bitonic() and merge_bitonic() and then merged pairwise
+    with merge_bitonic() until a single run remains. The temporary buffers take
+    twice the memory of the input. The 64-bit variants use sorting networks
+    only where 64-bit max() and min() are available and std::sort otherwise.
+    The null architecture always uses std::sort.
+*/
+SIMDPP_INL void sort(int32_t* first, int32_t* last)
+{
+    detail::insn::i_sort(first, last);
+}
+
+SIMDPP_INL void sort(uint32_t* first, uint32_t* last)
+{
+    detail::insn::i_sort(first, last);
+}
+
+SIMDPP_INL void sort(float* first, float* last)
+{
+    detail::insn::i_sort(first, last);
+}
+
+SIMDPP_INL void sort(int64_t* first, int64_t* last)
+{
+    detail::insn::i_sort(first, last);
+}
+
+SIMDPP_INL void sort(uint64_t* first, uint64_t* last)
+{
+    detail::insn::i_sort(first, last);
+}
+
+SIMDPP_INL void sort(double* first, double* last)
+{
+    detail::insn::i_sort(first, last);
+}
+
+/** Sorts the elements in the range [first, last) in ascending order and
+    applies the same permutation to the range starting at @a values. The
+    sort is not stable: pairs with equal keys are ordered by the bit patterns
+    of their values.
+
+    @a P must be a trivially copyable 32-bit type. Each key and value pair is
+    packed into a 64-bit integer, which is sorted the same way as by the
+    64-bit variants of sort(first, last).
+*/
+template<class P> SIMDPP_INL
+void sort(int32_t* first, int32_t* last, P* values)
+{
+    detail::insn::i_sort_pairs(first, last, values);
+}
+
+template<class P> SIMDPP_INL
+void sort(uint32_t* first, uint32_t* last, P* values)
+{
+    detail::insn::i_sort_pairs(first, last, values);
+}
+
+template<class P> SIMDPP_INL
+void sort(float* first, float* last, P* values)
+{
+    detail::insn::i_sort_pairs(first, last, values);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
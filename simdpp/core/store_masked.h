@@ -18,14 +18,26 @@
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
 
-/** Stores the first @a n elements of an 128-bit or 256-bit integer, 32-bit or
-    64-bit floating point vector to memory. @a n must be in range [0..N-1]
-    where @a N is the number of elements in the vector. If @a n is zero, no
-    store is made.
+/** Stores the elements of an integer or floating-point vector selected by
+    @a mask to memory.
 
     The pointer must be aligned to the native vector size.
 */
 template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked(T* p, const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    uint8<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked(T* p, const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    uint16<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+template<class T, unsigned N, class V, class M> SIMDPP_INL
 void store_masked(T* p, const any_int32<N,V>& a, const mask_int32<N,M>& mask)
 {
     uint32<N> ra;
@@ -54,6 +66,66 @@ void store_masked(T* p, const any_float64<N,V>& a, const mask_float64<N,M>& mask
     detail::insn::i_store_masked(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
 }
 
+
+/** Stores the elements of an integer or floating-point vector selected by
+    @a mask to an unaligned memory location. Memory corresponding to the
+    elements that are not selected is not accessed.
+
+    @code
+    if (mask0) *(p) = a0
+    ...
+    if (maskN) *(p+N) = aN
+    @endcode
+
+    @a p must be aligned to the element size.
+
+    On AVX512VL (and AVX512BW for 8 and 16-bit elements) a single masked store
+    is used. 32 and 64-bit elements are stored via @c vmaskmov on AVX and AVX2.
+    On other instruction sets the selected elements are stored one by one.
+*/
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked_u(T* p, const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    uint8<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked_u(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked_u(T* p, const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    uint16<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked_u(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked_u(T* p, const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    uint32<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked_u(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked_u(T* p, const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    uint64<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked_u(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked_u(T* p, const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    float32<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked_u(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+void store_masked_u(T* p, const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    float64<N> ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_masked_u(reinterpret_cast<char*>(p), ra, mask.wrapped().eval());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
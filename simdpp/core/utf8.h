@@ -0,0 +1,100 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_UTF8_H
+#define LIBSIMDPP_SIMDPP_CORE_UTF8_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/utf8.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// The value returned by the transcoding functions if the input is invalid
+static const std::size_t utf_invalid = detail::insn::utf_invalid_result;
+
+/** Returns @c true if the @a n bytes at @a s are valid UTF-8. Overlong
+    sequences, surrogates, code points above U+10FFFF and sequences truncated
+    at the end of the input are rejected.
+
+    The input is checked in blocks of the size of the native vector using the
+    lookup table algorithm by Keiser and Lemire: the nibbles of each byte and
+    the preceding byte index three tables of 16 bytes using permute_bytes16().
+    Blocks that are ASCII are skipped with a single test.
+
+    On SSE2 permute_bytes16() is not available, so only the ASCII blocks are
+    checked using vector instructions.
+*/
+SIMDPP_INL bool utf8_validate(const char* s, std::size_t n)
+{
+    return detail::insn::i_utf8_validate(s, n);
+}
+
+/** Converts the @a n bytes of UTF-8 at @a s to UTF-16. Returns the number of
+    the code units written to @a out or @c utf_invalid if the input is not
+    valid UTF-8. At most @a n code units are written.
+
+    The input is validated using utf8_validate() first. Then it's converted
+    in chunks of 16 bytes: ASCII chunks are widened, the rest are decoded by
+    computing the code point starting at each byte from it and the following
+    bytes and dropping those that start at continuation bytes. Chunks
+    containing 4-byte sequences are converted one sequence at a time.
+*/
+SIMDPP_INL std::size_t utf8_to_utf16(const char* s, std::size_t n, char16_t* out)
+{
+    return detail::insn::i_utf8_to_utf16(s, n, out);
+}
+
+/** Converts the @a n bytes of UTF-8 at @a s to UTF-32. Returns the number of
+    the code units written to @a out or @c utf_invalid if the input is not
+    valid UTF-8. At most @a n code units are written.
+
+    The conversion is done the same way as in utf8_to_utf16(), except that
+    chunks containing 4-byte sequences are decoded using vector instructions
+    too.
+*/
+SIMDPP_INL std::size_t utf8_to_utf32(const char* s, std::size_t n, char32_t* out)
+{
+    return detail::insn::i_utf8_to_utf32(s, n, out);
+}
+
+/** Converts the @a n code units of UTF-16 at @a s to UTF-8. Returns the number
+    of the bytes written to @a out or @c utf_invalid if the input contains
+    unpaired surrogates. At most <tt>3 * n</tt> bytes are written. Output may
+    have been written even if the input is invalid.
+
+    The input is converted in chunks of 16 code units: ASCII chunks are
+    narrowed and chunks of code points below U+0800 are encoded by computing
+    both bytes of each sequence, interleaving them and dropping the unused
+    bytes. Other chunks are encoded one code point at a time.
+*/
+SIMDPP_INL std::size_t utf16_to_utf8(const char16_t* s, std::size_t n, char* out)
+{
+    return detail::insn::i_utf_to_utf8<uint16<16>>(s, n, out);
+}
+
+/** Converts the @a n code units of UTF-32 at @a s to UTF-8. Returns the number
+    of the bytes written to @a out or @c utf_invalid if the input contains
+    surrogates or values above U+10FFFF. At most <tt>4 * n</tt> bytes are
+    written. Output may have been written even if the input is invalid.
+
+    The conversion is done the same way as in utf16_to_utf8().
+*/
+SIMDPP_INL std::size_t utf32_to_utf8(const char32_t* s, std::size_t n, char* out)
+{
+    return detail::insn::i_utf_to_utf8<uint32<16>>(s, n, out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
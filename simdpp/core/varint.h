@@ -0,0 +1,226 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_VARINT_H
+#define LIBSIMDPP_SIMDPP_CORE_VARINT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/varint.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Two variable length encodings of integers are supported:
+
+     - Stream VByte stores each 32-bit value as 1 to 4 little-endian bytes. The
+       lengths of each group of four values are stored as 2-bit codes in a
+       control byte. All control bytes precede all data bytes. The format is
+       compatible with the reference Stream VByte implementation.
+
+     - Varint stores each value as a LEB128 varint as in Protocol Buffers: 7
+       bits per byte starting from the least significant bits, the most
+       significant bit of each byte being set if more bytes follow.
+
+    The @c _zigzag variants map signed values to unsigned ones so that values
+    of small magnitude are encoded in few bytes: 0, -1, 1, -2 become 0, 1, 2,
+    3 and so on. The @c _delta variants encode the differences between
+    consecutive values, computed modulo 2^32 or 2^64, which suits sorted
+    sequences. The value preceding the first one is given by @a prev.
+*/
+
+/// The value returned by the decoding functions if the input is invalid
+static const std::size_t varint_invalid = detail::insn::varint_invalid_result;
+
+/// Returns the maximum number of bytes Stream VByte encoding of @a n values
+/// may take
+SIMDPP_INL std::size_t streamvbyte_max_size(std::size_t n)
+{
+    return (n + 3) / 4 + 4 * n;
+}
+
+/** Encodes the @a n values at @a src using Stream VByte. Returns the number of
+    bytes written to @a dst. @a dst must have space for
+    streamvbyte_max_size(n) bytes, all of which may be overwritten.
+
+    Each group of four values is encoded by computing the control byte from
+    comparisons of the values with 0xff, 0xffff and 0xffffff and packing the
+    significant bytes using permute_zbytes16() with a mask looked up using the
+    control byte.
+
+    On SSE2 and big-endian targets the values are encoded one at a time.
+*/
+SIMDPP_INL std::size_t streamvbyte_encode(const uint32_t* src, std::size_t n, uint8_t* dst)
+{
+    return detail::insn::i_streamvbyte_encode(src, n, dst,
+                detail::insn::i_varint_plain<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t streamvbyte_encode_zigzag(const int32_t* src, std::size_t n, uint8_t* dst)
+{
+    return detail::insn::i_streamvbyte_encode(reinterpret_cast<const uint32_t*>(src), n, dst,
+                detail::insn::i_varint_zigzag<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t streamvbyte_encode_delta(const uint32_t* src, std::size_t n, uint8_t* dst,
+                                                uint32_t prev = 0)
+{
+    return detail::insn::i_streamvbyte_encode(src, n, dst,
+                detail::insn::i_varint_delta<uint32_t>(prev));
+}
+
+/** Decodes @a n values encoded using Stream VByte from the @a size bytes at
+    @a src. Returns the number of consumed bytes or @c varint_invalid if the
+    input is too short. Output may have been written even if the input is
+    invalid.
+
+    The data bytes of each group of four values are moved to the 32-bit
+    elements using permute_zbytes16() with a mask looked up using the control
+    byte. On AVX2 and AVX-512 several groups are decoded at once. The prefix
+    sum of the differences of the @c _delta variant is computed in the
+    registers.
+
+    On SSE2 and big-endian targets the values are decoded one at a time.
+*/
+SIMDPP_INL std::size_t streamvbyte_decode(const uint8_t* src, std::size_t size,
+                                          uint32_t* dst, std::size_t n)
+{
+    return detail::insn::i_streamvbyte_decode(src, size, dst, n,
+                detail::insn::i_varint_plain<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t streamvbyte_decode_zigzag(const uint8_t* src, std::size_t size,
+                                                 int32_t* dst, std::size_t n)
+{
+    return detail::insn::i_streamvbyte_decode(src, size, reinterpret_cast<uint32_t*>(dst), n,
+                detail::insn::i_varint_zigzag<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t streamvbyte_decode_delta(const uint8_t* src, std::size_t size,
+                                                uint32_t* dst, std::size_t n,
+                                                uint32_t prev = 0)
+{
+    return detail::insn::i_streamvbyte_decode(src, size, dst, n,
+                detail::insn::i_varint_delta<uint32_t>(prev));
+}
+
+/** Encodes the @a n values at @a src as varints. Returns the number of bytes
+    written to @a dst. @a dst must have space for <tt>5 * n</tt> bytes for
+    32-bit values or <tt>10 * n</tt> bytes for 64-bit values, all of which
+    may be overwritten.
+
+    Groups of four values of at most 28 bits are encoded at once: the groups
+    of 7 bits are moved to separate bytes using shifts and the used bytes are
+    packed using permute_zbytes16() as in streamvbyte_encode(). Groups
+    containing larger values are encoded one value at a time.
+
+    On SSE2 and big-endian targets the values are encoded one at a time.
+*/
+SIMDPP_INL std::size_t varint_encode(const uint32_t* src, std::size_t n, uint8_t* dst)
+{
+    return detail::insn::i_varint_encode(src, n, dst,
+                detail::insn::i_varint_plain<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_encode(const uint64_t* src, std::size_t n, uint8_t* dst)
+{
+    return detail::insn::i_varint_encode(src, n, dst,
+                detail::insn::i_varint_plain<uint64_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_encode_zigzag(const int32_t* src, std::size_t n, uint8_t* dst)
+{
+    return detail::insn::i_varint_encode(reinterpret_cast<const uint32_t*>(src), n, dst,
+                detail::insn::i_varint_zigzag<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_encode_zigzag(const int64_t* src, std::size_t n, uint8_t* dst)
+{
+    return detail::insn::i_varint_encode(reinterpret_cast<const uint64_t*>(src), n, dst,
+                detail::insn::i_varint_zigzag<uint64_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_encode_delta(const uint32_t* src, std::size_t n, uint8_t* dst,
+                                           uint32_t prev = 0)
+{
+    return detail::insn::i_varint_encode(src, n, dst,
+                detail::insn::i_varint_delta<uint32_t>(prev));
+}
+
+SIMDPP_INL std::size_t varint_encode_delta(const uint64_t* src, std::size_t n, uint8_t* dst,
+                                           uint64_t prev = 0)
+{
+    return detail::insn::i_varint_encode(src, n, dst,
+                detail::insn::i_varint_delta<uint64_t>(prev));
+}
+
+/** Decodes the varints in the @a size bytes at @a src. Returns the number of
+    values written to @a dst or @c varint_invalid if the input is not valid.
+    @a dst must have space for @a size values, all of which may be
+    overwritten. Output may have been written even if the input is invalid.
+
+    The input is invalid if the last varint is not complete or if a varint is
+    longer than 5 bytes for 32-bit values or 10 bytes for 64-bit values or
+    its value does not fit into the output type.
+
+    This is a variant of the masked VByte algorithm: the continuation bits of
+    16 bytes of input are extracted using extract_bits(). If none is set,
+    the 16 bytes are widened to 16 values. Otherwise the continuation bits of
+    the first 8 bytes index a table of permute_zbytes16() masks that move the
+    bytes of up to 8 varints of at most 2 bytes or up to 4 varints of at most
+    4 bytes to separate elements, after which the groups of 7 bits are merged
+    using shifts. Longer varints are decoded one at a time.
+
+    On SSE2 and big-endian targets the values are decoded one at a time.
+*/
+SIMDPP_INL std::size_t varint_decode(const uint8_t* src, std::size_t size, uint32_t* dst)
+{
+    return detail::insn::i_varint_decode(src, size, dst,
+                detail::insn::i_varint_plain<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_decode(const uint8_t* src, std::size_t size, uint64_t* dst)
+{
+    return detail::insn::i_varint_decode(src, size, dst,
+                detail::insn::i_varint_plain<uint64_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_decode_zigzag(const uint8_t* src, std::size_t size, int32_t* dst)
+{
+    return detail::insn::i_varint_decode(src, size, reinterpret_cast<uint32_t*>(dst),
+                detail::insn::i_varint_zigzag<uint32_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_decode_zigzag(const uint8_t* src, std::size_t size, int64_t* dst)
+{
+    return detail::insn::i_varint_decode(src, size, reinterpret_cast<uint64_t*>(dst),
+                detail::insn::i_varint_zigzag<uint64_t>(0));
+}
+
+SIMDPP_INL std::size_t varint_decode_delta(const uint8_t* src, std::size_t size, uint32_t* dst,
+                                           uint32_t prev = 0)
+{
+    return detail::insn::i_varint_decode(src, size, dst,
+                detail::insn::i_varint_delta<uint32_t>(prev));
+}
+
+SIMDPP_INL std::size_t varint_decode_delta(const uint8_t* src, std::size_t size, uint64_t* dst,
+                                           uint64_t prev = 0)
+{
+    return detail::insn::i_varint_decode(src, size, dst,
+                detail::insn::i_varint_delta<uint64_t>(prev));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
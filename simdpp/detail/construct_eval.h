@@ -34,6 +34,12 @@ void construct_eval(V& v, const expr_vec_load& e);
 template<class V> SIMDPP_INL
 void construct_eval(V& v, const expr_vec_load_u& e);
 
+template<class V> SIMDPP_INL
+void construct_eval(V& v, const expr_vec_load_first& e);
+
+template<class V> SIMDPP_INL
+void construct_eval(V& v, const expr_vec_load_last& e);
+
 template<class V, class VE, unsigned N> SIMDPP_INL
 void construct_eval(V& v, const expr_vec_make_const<VE, N>& e);
 
@@ -0,0 +1,338 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_BASE64_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_BASE64_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+
+// The vector implementation needs permute_bytes16, which is not available on
+// SSE2, and assumes little-endian layout of the elements within the vectors
+#if (SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || \
+     SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA) && !SIMDPP_BIG_ENDIAN
+#define SIMDPP_DETAIL_BASE64_USE_VECTOR 1
+#else
+#define SIMDPP_DETAIL_BASE64_USE_VECTOR 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+static const std::size_t base64_invalid_result = ~std::size_t(0);
+
+/*  The alphabets differ only in the last two characters. The decoding tables
+    are described in i_base64_decode_vec.
+*/
+struct base64_std {
+    static const bool pad = true;
+    static const char c62 = '+';
+    static const char c63 = '/';
+
+    template<class V> static V encode_offsets()
+    {
+        return make_uint(71, 252, 252, 252, 252, 252, 252, 252,
+                         252, 252, 252, 237, 240, 65, 0, 0);
+    }
+    template<class V> static V decode_lut_lo()
+    {
+        return make_uint(0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+                         0x03, 0x03, 0x07, 0x15, 0x17, 0x17, 0x17, 0x15);
+    }
+    template<class V> static V decode_lut_hi()
+    {
+        return make_uint(0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x10,
+                         0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01);
+    }
+    template<class V> static V decode_offsets()
+    {
+        return make_uint(0, 0, 19, 4, 191, 191, 185, 185,
+                         0, 0, 16, 0, 0, 0, 0, 0);
+    }
+};
+
+struct base64_url {
+    static const bool pad = false;
+    static const char c62 = '-';
+    static const char c63 = '_';
+
+    template<class V> static V encode_offsets()
+    {
+        return make_uint(71, 252, 252, 252, 252, 252, 252, 252,
+                         252, 252, 252, 239, 32, 65, 0, 0);
+    }
+    template<class V> static V decode_lut_lo()
+    {
+        return make_uint(0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+                         0x03, 0x03, 0x07, 0x37, 0x37, 0x35, 0x37, 0x27);
+    }
+    template<class V> static V decode_lut_hi()
+    {
+        return make_uint(0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x20,
+                         0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01);
+    }
+    template<class V> static V decode_offsets()
+    {
+        return make_uint(0, 0, 17, 4, 191, 191, 185, 185,
+                         0, 0, 0, 0, 0, 224, 0, 0);
+    }
+};
+
+template<class A> SIMDPP_INL
+char i_base64_char(unsigned v)
+{
+    if (v < 26) return char('A' + v);
+    if (v < 52) return char('a' + v - 26);
+    if (v < 62) return char('0' + v - 52);
+    return v == 62 ? A::c62 : A::c63;
+}
+
+// Returns the value of a character or -1 if it's not in the alphabet
+template<class A> SIMDPP_INL
+int i_base64_value(unsigned char c)
+{
+    if (unsigned(c - 'A') < 26) return c - 'A';
+    if (unsigned(c - 'a') < 26) return c - 'a' + 26;
+    if (unsigned(c - '0') < 10) return c - '0' + 52;
+    if (c == (unsigned char) A::c62) return 62;
+    if (c == (unsigned char) A::c63) return 63;
+    return -1;
+}
+
+#if SIMDPP_DETAIL_BASE64_USE_VECTOR
+/*  The vector implementations work on 16-byte lanes, each of which holds
+    12 bytes of binary data or 16 characters. Wider vectors are loaded and
+    stored lane by lane with the given stride between the lanes. When storing,
+    each lane overwrites the unused bytes of the previous one.
+*/
+static SIMDPP_INL
+void i_base64_load_lanes(uint8<16>& a, const uint8_t* p, unsigned)
+{
+    a = load_u(p);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_base64_load_lanes(uint8<N>& a, const uint8_t* p, unsigned stride)
+{
+    uint8<N/2> lo, hi;
+    i_base64_load_lanes(lo, p, stride);
+    i_base64_load_lanes(hi, p + N / 32 * stride, stride);
+    a = combine(lo, hi);
+}
+
+static SIMDPP_INL
+void i_base64_store_lanes(uint8_t* p, const uint8<16>& a, unsigned)
+{
+    store_u(p, a);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_base64_store_lanes(uint8_t* p, const uint8<N>& a, unsigned stride)
+{
+    uint8<N/2> lo, hi;
+    split(a, lo, hi);
+    i_base64_store_lanes(p, lo, stride);
+    i_base64_store_lanes(p + N / 32 * stride, hi, stride);
+}
+
+/*  Encodes the first 12 bytes of each lane. The bytes of each group of three
+    are rearranged so that each 6-bit index can be extracted to its own byte
+    by a shift and a mask of the 32-bit element. The indices are translated
+    to characters by adding an offset looked up from a table which is indexed
+    by the range that the index belongs to.
+*/
+template<class A, unsigned N> SIMDPP_INL
+uint8<N> i_base64_encode_vec(const uint8<N>& in)
+{
+    using V = uint8<N>;
+    using U32 = uint32<N/4>;
+    V shuffle_mask = make_uint(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    U32 w = U32(permute_bytes16(in, shuffle_mask));
+    U32 i0 = bit_and(shift_r<10>(w), 0x0000003f);
+    U32 i1 = bit_and(shift_l<4>(w), 0x00003f00);
+    U32 i2 = bit_and(shift_r<6>(w), 0x003f0000);
+    U32 i3 = bit_and(shift_l<8>(w), 0x3f000000);
+    V idx = V(bit_or(bit_or(i0, i1), bit_or(i2, i3)));
+
+    // 0..25 -> 13, 26..51 -> 0, 52..63 -> 1..12
+    V range = sub_sat(idx, 51);
+    V upper = splat(13);
+    range = blend(upper, range, cmp_lt(int8<N>(idx), 26));
+    V offsets = A::template encode_offsets<V>();
+    return add(idx, permute_bytes16(offsets, range));
+}
+
+/*  Decodes the 16 characters of each lane to the first 12 bytes of the lane.
+
+    A character is valid if the bitwise AND of the two table entries indexed
+    by its low and high nibbles is zero. Each bit of the high nibble table
+    represents a set of high nibbles that the same low nibbles are valid
+    with, the low nibble table contains the bits of the sets that the low
+    nibble is not valid with. The value of a character is computed by adding
+    an offset indexed by its high nibble. The 63rd character shares its high
+    nibble with characters of other values and is given a separate offset.
+    The 6-bit values are then merged into 12-bit and 24-bit fields of the
+    16-bit and 32-bit elements whose bytes are finally reordered.
+*/
+template<class A, unsigned N> SIMDPP_INL
+uint8<N> i_base64_decode_vec(const uint8<N>& in, uint8<N>& err)
+{
+    using V = uint8<N>;
+    using U16 = uint16<N/2>;
+    using U32 = uint32<N/4>;
+    V hi = shift_r<4>(in);
+    V lo = bit_and(in, 0x0f);
+    V lut_lo = A::template decode_lut_lo<V>();
+    V lut_hi = A::template decode_lut_hi<V>();
+    V invalid = bit_and(permute_bytes16(lut_lo, lo), permute_bytes16(lut_hi, hi));
+    err = bit_or(err, invalid);
+
+    V c63 = splat(uint8_t(A::c63));
+    V is_c63 = V(cmp_eq(in, c63));
+    V sel = bit_or(hi, bit_and(is_c63, 0x08));
+    V offsets = A::template decode_offsets<V>();
+    V values = add(in, permute_bytes16(offsets, sel));
+
+    U16 w = U16(values);
+    U16 m = bit_or(shift_l<6>(bit_and(w, 0x3f)), shift_r<8>(w));
+    U32 x = U32(m);
+    U32 y = bit_or(shift_l<12>(bit_and(x, 0xfff)), shift_r<16>(x));
+    V order = make_uint(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 15, 15, 15, 15);
+    return permute_bytes16(V(y), order);
+}
+#endif
+
+template<class A> SIMDPP_INL
+std::size_t i_base64_encode(const uint8_t* p, std::size_t n, char* out)
+{
+    std::size_t i = 0, o = 0;
+#if SIMDPP_DETAIL_BASE64_USE_VECTOR
+    using V = uint8v;
+    const unsigned L = V::length / 16;
+    uint8_t* uout = reinterpret_cast<uint8_t*>(out);
+    // each lane reads 16 bytes of which 12 are used
+    for (; i + 12 * L + 4 <= n; i += 12 * L, o += 16 * L) {
+        V in;
+        i_base64_load_lanes(in, p + i, 12);
+        store_u(uout + o, i_base64_encode_vec<A>(in));
+    }
+#endif
+    for (; i + 3 <= n; i += 3, o += 4) {
+        uint32_t v = (uint32_t(p[i]) << 16) | (uint32_t(p[i+1]) << 8) | p[i+2];
+        out[o] = i_base64_char<A>(v >> 18);
+        out[o+1] = i_base64_char<A>((v >> 12) & 0x3f);
+        out[o+2] = i_base64_char<A>((v >> 6) & 0x3f);
+        out[o+3] = i_base64_char<A>(v & 0x3f);
+    }
+    if (i == n)
+        return o;
+
+    uint32_t v = uint32_t(p[i]) << 16;
+    if (i + 2 == n)
+        v |= uint32_t(p[i+1]) << 8;
+    out[o++] = i_base64_char<A>(v >> 18);
+    out[o++] = i_base64_char<A>((v >> 12) & 0x3f);
+    if (i + 2 == n)
+        out[o++] = i_base64_char<A>((v >> 6) & 0x3f);
+    if (A::pad) {
+        while (o % 4 != 0)
+            out[o++] = '=';
+    }
+    return o;
+}
+
+/*  Padding is accepted only at the end of input whose length is a multiple of
+    4 and required if the alphabet pads. The bits of the last character that
+    are not part of the decoded data must be zero.
+*/
+template<class A> SIMDPP_INL
+std::size_t i_base64_decode(const char* s, std::size_t n, uint8_t* out)
+{
+    std::size_t m = n;
+    if (n % 4 == 0 && n > 0 && s[n-1] == '=') {
+        m = s[n-2] == '=' ? n - 2 : n - 1;
+    } else if (A::pad && n % 4 != 0) {
+        return base64_invalid_result;
+    }
+    if (m % 4 == 1)
+        return base64_invalid_result;
+
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+    std::size_t i = 0, o = 0;
+#if SIMDPP_DETAIL_BASE64_USE_VECTOR
+    using V = uint8v;
+    const unsigned L = V::length / 16;
+    V err = make_zero();
+    // each lane writes 16 bytes of which 12 are used. At least 8 characters
+    // after the vector, i.e. at least 4 bytes of output are left
+    for (; i + 16 * L + 8 <= m; i += 16 * L, o += 12 * L) {
+        V in = load_u(p + i);
+        i_base64_store_lanes(out + o, i_base64_decode_vec<A>(in, err), 12);
+    }
+    if (test_bits_any(err))
+        return base64_invalid_result;
+#endif
+    for (; i + 4 <= m; i += 4, o += 3) {
+        int a = i_base64_value<A>(p[i]), b = i_base64_value<A>(p[i+1]),
+            c = i_base64_value<A>(p[i+2]), d = i_base64_value<A>(p[i+3]);
+        if ((a | b | c | d) < 0)
+            return base64_invalid_result;
+        uint32_t v = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | d;
+        out[o] = uint8_t(v >> 16);
+        out[o+1] = uint8_t(v >> 8);
+        out[o+2] = uint8_t(v);
+    }
+    if (i == m)
+        return o;
+
+    int a = i_base64_value<A>(p[i]), b = i_base64_value<A>(p[i+1]);
+    int c = i + 3 == m ? i_base64_value<A>(p[i+2]) : 0;
+    if ((a | b | c) < 0)
+        return base64_invalid_result;
+    uint32_t v = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6);
+    if (i + 2 == m) {
+        if (v & 0xffff)
+            return base64_invalid_result;
+        out[o++] = uint8_t(v >> 16);
+    } else {
+        if (v & 0xff)
+            return base64_invalid_result;
+        out[o++] = uint8_t(v >> 16);
+        out[o++] = uint8_t(v >> 8);
+    }
+    return o;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
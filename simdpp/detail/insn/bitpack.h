@@ -0,0 +1,313 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_BITPACK_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_BITPACK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_reduce_or.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/insn/scan.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  A block of 32 * L values is packed in the vertical layout: the values are
+    loaded L at a time into the lanes of a uint32<L> vector and each lane
+    packs its 32 values into B consecutive 32-bit words, starting from the
+    least significant bits. Word w of lane l is stored at index w * L + l.
+    The layout depends only on L, thus data packed on one instruction set can
+    be unpacked on any other. Wider native vectors process several lanes of a
+    128-value block at once, 256-value blocks use uint32<8> which is split into
+    two halves on 128-bit instruction sets.
+
+    The kernels loop over the 32 values of each lane. The loops are unrolled,
+    thus all shift counts and word offsets become compile-time constants.
+*/
+
+enum {
+    bitpack_mode_plain,
+    bitpack_mode_for,
+    bitpack_mode_delta
+};
+
+template<unsigned B>
+struct i_bitpack_mask {
+    static const uint32_t value = B == 32 ? 0xffffffff : (uint32_t(1) << (B % 32)) - 1;
+};
+
+/*  The transforms convert the values before packing and after unpacking.
+    encode() returns the i-th input vector of the block to be packed.
+    decode() is called on the unpacked vectors in order.
+*/
+template<class V, unsigned Mode>
+struct i_bitpack_transform;
+
+template<class V>
+struct i_bitpack_transform<V, bitpack_mode_plain> {
+    SIMDPP_INL i_bitpack_transform(const uint32_t*, uint32_t) {}
+
+    SIMDPP_INL V encode(const uint32_t* in, unsigned i) const
+    {
+        return load_u(in + i * V::length);
+    }
+
+    SIMDPP_INL V decode(const V& a) { return a; }
+};
+
+// Frame of reference: the values are stored as offsets from a base
+template<class V>
+struct i_bitpack_transform<V, bitpack_mode_for> {
+    V base;
+
+    SIMDPP_INL i_bitpack_transform(const uint32_t*, uint32_t b) : base(splat(b)) {}
+
+    SIMDPP_INL V encode(const uint32_t* in, unsigned i) const
+    {
+        return sub(V(load_u(in + i * V::length)), base);
+    }
+
+    SIMDPP_INL V decode(const V& a) { return add(a, base); }
+};
+
+/*  Delta coding: the values are stored as differences from the preceding
+    value, the value preceding the block being passed as an argument. The
+    differences are computed with a second load offset by one element and
+    summed with an in-register prefix sum plus the broadcast of the last
+    value of the previous vector.
+*/
+template<class V>
+struct i_bitpack_transform<V, bitpack_mode_delta> {
+    V prev;
+
+    SIMDPP_INL i_bitpack_transform(const uint32_t* in, uint32_t init)
+    {
+        prev = splat(init);
+        if (in) {
+            mem_block<V> p;
+            p[0] = init;
+            for (unsigned i = 1; i < V::length; ++i)
+                p[i] = in[i - 1];
+            prev = p;
+        }
+    }
+
+    SIMDPP_INL V encode(const uint32_t* in, unsigned i) const
+    {
+        V a = load_u(in + i * V::length);
+        V p = i == 0 ? prev : V(load_u(in + i * V::length - 1));
+        return sub(a, p);
+    }
+
+    SIMDPP_INL V decode(const V& a)
+    {
+        V r = add(i_scan<scan_op_add>(a), prev);
+        prev = i_scan_splat_last(r);
+        return r;
+    }
+};
+
+#if defined(__clang__) || defined(__INTEL_COMPILER)
+#define SIMDPP_DETAIL_BITPACK_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+#define SIMDPP_DETAIL_BITPACK_UNROLL _Pragma("GCC unroll 32")
+#else
+#define SIMDPP_DETAIL_BITPACK_UNROLL
+#endif
+
+template<unsigned B, class V, class Tr> SIMDPP_INL
+void i_bitpack_lanes(uint32_t* out, const uint32_t* in, const Tr& tr)
+{
+    const unsigned L = V::length;
+    V mask = splat(i_bitpack_mask<B>::value);
+    V acc = make_zero();
+    SIMDPP_DETAIL_BITPACK_UNROLL
+    for (unsigned i = 0; i < 32; ++i) {
+        const unsigned word = i * B / 32;
+        const unsigned shift = i * B % 32;
+        V a = tr.encode(in, i);
+        if (B < 32)
+            a = bit_and(a, mask);
+        acc = bit_or(acc, shift_l(a, shift));
+        if (shift + B >= 32) {
+            store_u(out + word * L, acc);
+            if (shift + B > 32)
+                acc = shift_r(a, 32 - shift);
+            else
+                acc = make_zero();
+        }
+    }
+}
+
+template<unsigned B, class V, class Tr> SIMDPP_INL
+void i_bitunpack_lanes(uint32_t* out, const uint32_t* in, Tr& tr)
+{
+    const unsigned L = V::length;
+    V mask = splat(i_bitpack_mask<B>::value);
+    V cur = load_u(in);
+    SIMDPP_DETAIL_BITPACK_UNROLL
+    for (unsigned i = 0; i < 32; ++i) {
+        const unsigned word = i * B / 32;
+        const unsigned shift = i * B % 32;
+        V r = shift_r(cur, shift);
+        if (shift + B >= 32 && i != 31)
+            cur = load_u(in + (word + 1) * L);
+        if (shift + B > 32)
+            r = bit_or(r, shift_l(cur, 32 - shift));
+        if (shift + B != 32)
+            r = bit_and(r, mask);
+        store_u(out + i * L, tr.decode(r));
+    }
+}
+
+template<unsigned B, unsigned Block, unsigned Mode> SIMDPP_INL
+uint32_t* i_bitpack_block(uint32_t* out, const uint32_t* in, uint32_t param)
+{
+    using V = uint32<Block / 32>;
+    i_bitpack_transform<V, Mode> tr(in, param);
+    i_bitpack_lanes<B, V>(out, in, tr);
+    return out + B * Block / 32;
+}
+
+template<unsigned Block, unsigned Mode> SIMDPP_INL
+uint32_t* i_bitpack_block_zero(uint32_t* out, const uint32_t*, uint32_t)
+{
+    return out;
+}
+
+template<unsigned B, unsigned Block, unsigned Mode> SIMDPP_INL
+const uint32_t* i_bitunpack_block(uint32_t* out, const uint32_t* in, uint32_t param)
+{
+    using V = uint32<Block / 32>;
+    i_bitpack_transform<V, Mode> tr(nullptr, param);
+    i_bitunpack_lanes<B, V>(out, in, tr);
+    return in + B * Block / 32;
+}
+
+// All values are zero, thus nothing is read
+template<unsigned Block, unsigned Mode> SIMDPP_INL
+const uint32_t* i_bitunpack_block_zero(uint32_t* out, const uint32_t* in, uint32_t param)
+{
+    using V = uint32<Block / 32>;
+    i_bitpack_transform<V, Mode> tr(nullptr, param);
+    V z = make_zero();
+    for (unsigned i = 0; i < 32; ++i)
+        store_u(out + i * V::length, tr.decode(z));
+    return in;
+}
+
+template<unsigned B, unsigned Block, unsigned Mode>
+struct i_bitpack_kernel {
+    static SIMDPP_INL uint32_t* pack(uint32_t* out, const uint32_t* in, uint32_t param)
+    {
+        return i_bitpack_block<B, Block, Mode>(out, in, param);
+    }
+
+    static SIMDPP_INL const uint32_t* unpack(uint32_t* out, const uint32_t* in, uint32_t param)
+    {
+        return i_bitunpack_block<B, Block, Mode>(out, in, param);
+    }
+};
+
+template<unsigned Block, unsigned Mode>
+struct i_bitpack_kernel<0, Block, Mode> {
+    static SIMDPP_INL uint32_t* pack(uint32_t* out, const uint32_t* in, uint32_t param)
+    {
+        return i_bitpack_block_zero<Block, Mode>(out, in, param);
+    }
+
+    static SIMDPP_INL const uint32_t* unpack(uint32_t* out, const uint32_t* in, uint32_t param)
+    {
+        return i_bitunpack_block_zero<Block, Mode>(out, in, param);
+    }
+};
+
+/*  Tables of the kernels for each bit width, indexed by the number of bits.
+    Each version of the library compiled for a different instruction set has
+    its own tables, thus runtime selection of the width composes with the
+    dispatcher.
+*/
+template<unsigned Block, unsigned Mode>
+struct i_bitpack_table {
+    using pack_fn = uint32_t* (*)(uint32_t*, const uint32_t*, uint32_t);
+    using unpack_fn = const uint32_t* (*)(uint32_t*, const uint32_t*, uint32_t);
+
+    static const pack_fn pack[33];
+    static const unpack_fn unpack[33];
+};
+
+#define SIMDPP_DETAIL_BITPACK_TABLE(F)                                          \
+    {                                                                           \
+        &i_bitpack_kernel<0, Block, Mode>::F,  &i_bitpack_kernel<1, Block, Mode>::F,  \
+        &i_bitpack_kernel<2, Block, Mode>::F,  &i_bitpack_kernel<3, Block, Mode>::F,  \
+        &i_bitpack_kernel<4, Block, Mode>::F,  &i_bitpack_kernel<5, Block, Mode>::F,  \
+        &i_bitpack_kernel<6, Block, Mode>::F,  &i_bitpack_kernel<7, Block, Mode>::F,  \
+        &i_bitpack_kernel<8, Block, Mode>::F,  &i_bitpack_kernel<9, Block, Mode>::F,  \
+        &i_bitpack_kernel<10, Block, Mode>::F, &i_bitpack_kernel<11, Block, Mode>::F, \
+        &i_bitpack_kernel<12, Block, Mode>::F, &i_bitpack_kernel<13, Block, Mode>::F, \
+        &i_bitpack_kernel<14, Block, Mode>::F, &i_bitpack_kernel<15, Block, Mode>::F, \
+        &i_bitpack_kernel<16, Block, Mode>::F, &i_bitpack_kernel<17, Block, Mode>::F, \
+        &i_bitpack_kernel<18, Block, Mode>::F, &i_bitpack_kernel<19, Block, Mode>::F, \
+        &i_bitpack_kernel<20, Block, Mode>::F, &i_bitpack_kernel<21, Block, Mode>::F, \
+        &i_bitpack_kernel<22, Block, Mode>::F, &i_bitpack_kernel<23, Block, Mode>::F, \
+        &i_bitpack_kernel<24, Block, Mode>::F, &i_bitpack_kernel<25, Block, Mode>::F, \
+        &i_bitpack_kernel<26, Block, Mode>::F, &i_bitpack_kernel<27, Block, Mode>::F, \
+        &i_bitpack_kernel<28, Block, Mode>::F, &i_bitpack_kernel<29, Block, Mode>::F, \
+        &i_bitpack_kernel<30, Block, Mode>::F, &i_bitpack_kernel<31, Block, Mode>::F, \
+        &i_bitpack_kernel<32, Block, Mode>::F                                   \
+    }
+
+template<unsigned Block, unsigned Mode>
+const typename i_bitpack_table<Block, Mode>::pack_fn
+    i_bitpack_table<Block, Mode>::pack[33] = SIMDPP_DETAIL_BITPACK_TABLE(pack);
+
+template<unsigned Block, unsigned Mode>
+const typename i_bitpack_table<Block, Mode>::unpack_fn
+    i_bitpack_table<Block, Mode>::unpack[33] = SIMDPP_DETAIL_BITPACK_TABLE(unpack);
+
+#undef SIMDPP_DETAIL_BITPACK_TABLE
+#undef SIMDPP_DETAIL_BITPACK_UNROLL
+
+template<unsigned Block> SIMDPP_INL
+unsigned i_bitpack_max_bits(const uint32_t* in)
+{
+    using V = uint32<Block / 32>;
+    V acc = make_zero();
+    for (unsigned i = 0; i < 32; ++i)
+        acc = bit_or(acc, V(load_u(in + i * V::length)));
+    uint32_t x = reduce_or(acc);
+    unsigned r = 0;
+    while (x != 0) {
+        x >>= 1;
+        r++;
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
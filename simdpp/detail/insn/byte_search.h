@@ -0,0 +1,285 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_BYTE_SEARCH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_BYTE_SEARCH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_first.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/test_bits.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The search functions read the input in aligned blocks of the vector size.
+    An aligned block never crosses a page boundary, thus it can be read as a
+    whole if any of its bytes belongs to the input. The matches outside the
+    input are then discarded.
+*/
+using byte_search_vector = uint8v;
+static const unsigned byte_search_width = byte_search_vector::length;
+
+// Returns a bit mask with bit i set if the byte i of the block matched
+static SIMDPP_INL
+uint64_t i_byte_search_bits(const mask_int8<16>& m)
+{
+    return extract_bits_any(uint8<16>(m));
+}
+
+static SIMDPP_INL
+uint64_t i_byte_search_bits(const mask_int8<32>& m)
+{
+    return extract_bits_any(uint8<32>(m));
+}
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint64_t i_byte_search_bits(const mask_int8<64>& m)
+{
+    return m.native();
+}
+#else
+static SIMDPP_INL
+uint64_t i_byte_search_bits(const mask_int8<64>& m)
+{
+    uint8<32> lo, hi;
+    split(uint8<64>(m), lo, hi);
+    return uint64_t(extract_bits_any(lo)) | (uint64_t(extract_bits_any(hi)) << 32);
+}
+#endif
+
+// Returns the index of the lowest set bit. x must not be zero
+static SIMDPP_INL
+unsigned i_byte_search_ctz(uint64_t x)
+{
+#if __GNUC__
+    return __builtin_ctzll(x);
+#else
+    unsigned r = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        r++;
+    }
+    return r;
+#endif
+}
+
+// Returns the index of the highest set bit. x must not be zero
+static SIMDPP_INL
+unsigned i_byte_search_msb(uint64_t x)
+{
+#if __GNUC__
+    return 63 - __builtin_clzll(x);
+#else
+    unsigned r = 0;
+    while (x >>= 1)
+        r++;
+    return r;
+#endif
+}
+
+// Returns a mask of the bits at or above position n, n < 64
+static SIMDPP_INL
+uint64_t i_byte_search_bits_from(unsigned n)
+{
+    return ~uint64_t(0) << n;
+}
+
+// Returns a mask of the bits below position n, n <= 64
+static SIMDPP_INL
+uint64_t i_byte_search_bits_below(std::size_t n)
+{
+    return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+}
+
+static SIMDPP_INL
+const char* i_byte_search_align(const char* p)
+{
+    // The pointer is adjusted instead of being converted back from an integer
+    // so that the compiler still knows which object it points to
+    std::uintptr_t a = reinterpret_cast<std::uintptr_t>(p);
+    return p - (a & (byte_search_width - 1));
+}
+
+// Matches a single byte
+struct byte_search_eq {
+    byte_search_vector c;
+
+    byte_search_eq(char ch) : c(splat(uint8_t(ch))) {}
+
+    SIMDPP_INL mask_int8<byte_search_width> operator()(const byte_search_vector& a) const
+    {
+        return cmp_eq(a, c);
+    }
+};
+
+// Matches any of a set of bytes. Each byte of the set costs one comparison
+struct byte_search_set {
+    const char* set;
+    std::size_t set_n;
+
+    SIMDPP_INL mask_int8<byte_search_width> operator()(const byte_search_vector& a) const
+    {
+        mask_int8<byte_search_width> m = cmp_eq(a, byte_search_vector(splat(uint8_t(set[0]))));
+        for (std::size_t i = 1; i < set_n; ++i) {
+            m = bit_or(m, cmp_eq(a, byte_search_vector(splat(uint8_t(set[i])))));
+        }
+        return m;
+    }
+};
+
+/*  Returns a pointer to the first byte in [s, s+n) matched by @a match or
+    nullptr. The first and the last aligned blocks are masked, the blocks in
+    between are checked four at a time.
+*/
+template<class M> SIMDPP_INL
+const char* i_find_first(const char* s, std::size_t n, const M& match)
+{
+    const unsigned W = byte_search_width;
+    if (n == 0)
+        return nullptr;
+    const char* end = s + n;
+    const char* p = i_byte_search_align(s);
+
+    uint64_t bits = i_byte_search_bits(match(load(p)));
+    bits &= i_byte_search_bits_from(unsigned(s - p));
+    for (;;) {
+        if (std::size_t(end - p) <= W) {
+            bits &= i_byte_search_bits_below(std::size_t(end - p));
+            return bits ? p + i_byte_search_ctz(bits) : nullptr;
+        }
+        if (bits)
+            return p + i_byte_search_ctz(bits);
+        p += W;
+
+        while (std::size_t(end - p) > 4 * W) {
+            byte_search_vector m0, m1, m2, m3;
+            m0 = match(load(p));
+            m1 = match(load(p + W));
+            m2 = match(load(p + 2*W));
+            m3 = match(load(p + 3*W));
+            byte_search_vector m = bit_or(bit_or(m0, m1), bit_or(m2, m3));
+            if (test_bits_any(m))
+                break;
+            p += 4 * W;
+        }
+        bits = i_byte_search_bits(match(load(p)));
+    }
+}
+
+/*  Returns a pointer to the last byte in [s, s+n) matched by @a match or
+    nullptr. The input is processed backwards starting from the aligned block
+    containing the last byte.
+*/
+template<class M> SIMDPP_INL
+const char* i_find_last(const char* s, std::size_t n, const M& match)
+{
+    const unsigned W = byte_search_width;
+    if (n == 0)
+        return nullptr;
+    const char* end = s + n;
+    const char* p = i_byte_search_align(end - 1);
+
+    uint64_t bits = i_byte_search_bits(match(load(p)));
+    bits &= i_byte_search_bits_below(std::size_t(end - p));
+    for (;;) {
+        if (p <= s) {
+            bits &= i_byte_search_bits_from(unsigned(s - p));
+            return bits ? p + i_byte_search_msb(bits) : nullptr;
+        }
+        if (bits)
+            return p + i_byte_search_msb(bits);
+        p -= W;
+
+        while (p - s > std::ptrdiff_t(4 * W)) {
+            byte_search_vector m0, m1, m2, m3;
+            m0 = match(load(p));
+            m1 = match(load(p - W));
+            m2 = match(load(p - 2*W));
+            m3 = match(load(p - 3*W));
+            byte_search_vector m = bit_or(bit_or(m0, m1), bit_or(m2, m3));
+            if (test_bits_any(m))
+                break;
+            p -= 4 * W;
+        }
+        bits = i_byte_search_bits(match(load(p)));
+    }
+}
+
+static SIMDPP_INL
+std::size_t i_string_length(const char* s)
+{
+    const unsigned W = byte_search_width;
+    byte_search_eq match('\0');
+    const char* p = i_byte_search_align(s);
+
+    uint64_t bits = i_byte_search_bits(match(load(p)));
+    bits &= i_byte_search_bits_from(unsigned(s - p));
+    while (!bits) {
+        p += W;
+        bits = i_byte_search_bits(match(load(p)));
+    }
+    return std::size_t(p + i_byte_search_ctz(bits) - s);
+}
+
+/*  The inputs can't be aligned simultaneously, thus unaligned loads are used.
+    They never go past the end of the inputs: the last vector overlaps the
+    previous one and inputs shorter than a vector are loaded with load_first().
+*/
+static SIMDPP_INL
+bool i_bytes_equal(const char* a, const char* b, std::size_t n)
+{
+    using V = byte_search_vector;
+    const unsigned W = byte_search_width;
+    if (n < W) {
+        V va = load_first<V>(a, unsigned(n));
+        V vb = load_first<V>(b, unsigned(n));
+        V d = bit_xor(va, vb);
+        return !test_bits_any(d);
+    }
+
+    std::size_t i = 0;
+    for (; i + 2*W <= n; i += 2*W) {
+        V a0 = load_u(a + i), a1 = load_u(a + i + W);
+        V b0 = load_u(b + i), b1 = load_u(b + i + W);
+        V d = bit_or(bit_xor(a0, b0), bit_xor(a1, b1));
+        if (test_bits_any(d))
+            return false;
+    }
+    if (i + W <= n) {
+        V a0 = load_u(a + i), b0 = load_u(b + i);
+        V d = bit_xor(a0, b0);
+        if (test_bits_any(d))
+            return false;
+    }
+    V a0 = load_u(a + n - W), b0 = load_u(b + n - W);
+    V d = bit_xor(a0, b0);
+    return !test_bits_any(d);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,116 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CLMUL_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CLMUL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+// The polynomial multiply instructions are part of the ARMv8 crypto extension
+// which has no instruction set identifier, thus only the compiler flags are
+// checked
+#if SIMDPP_USE_NEON64 && (__ARM_FEATURE_CRYPTO || __ARM_FEATURE_AES)
+#define SIMDPP_DETAIL_USE_NEON_PMULL 1
+#else
+#define SIMDPP_DETAIL_USE_NEON_PMULL 0
+#endif
+
+// Whether carry-less multiplication is done by a single instruction
+#define SIMDPP_DETAIL_CLMUL_NATIVE (SIMDPP_USE_PCLMULQDQ || SIMDPP_DETAIL_USE_NEON_PMULL)
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Computes the 128-bit carry-less product of a and b
+static SIMDPP_INL
+uint64_t i_clmul_el(uint64_t a, uint64_t b, uint64_t& hi)
+{
+    // 4 bits of b are processed at a time using the multiples of a. The 3 bits
+    // of the multiples that don't fit into 64 bits are tracked separately.
+    uint64_t tlo[16], thi[16];
+    tlo[0] = 0; thi[0] = 0;
+    for (unsigned i = 1; i < 16; ++i) {
+        unsigned j = i >> 1;
+        tlo[i] = (i & 1) ? tlo[i-1] ^ a : tlo[j] << 1;
+        thi[i] = (i & 1) ? thi[i-1] : (thi[j] << 1) | (tlo[j] >> 63);
+    }
+    uint64_t lo = tlo[b >> 60];
+    hi = thi[b >> 60];
+    for (int s = 56; s >= 0; s -= 4) {
+        hi = (hi << 4) | (lo >> 60);
+        lo <<= 4;
+        unsigned k = (b >> s) & 0xf;
+        lo ^= tlo[k];
+        hi ^= thi[k];
+    }
+    return lo;
+}
+
+template<unsigned sa, unsigned sb> SIMDPP_INL
+uint64<2> i_clmul(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_PCLMULQDQ
+    return _mm_clmulepi64_si128(a.native(), b.native(), (sb << 4) | sa);
+#elif SIMDPP_DETAIL_USE_NEON_PMULL
+    poly64_t pa = (poly64_t) vgetq_lane_u64(a.native(), sa);
+    poly64_t pb = (poly64_t) vgetq_lane_u64(b.native(), sb);
+    return vreinterpretq_u64_p128(vmull_p64(pa, pb));
+#else
+    SIMDPP_ALIGN(16) uint64_t ea[2], eb[2], r[2];
+    store(ea, a);
+    store(eb, b);
+    r[0] = i_clmul_el(ea[sa], eb[sb], r[1]);
+    return load(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned sa, unsigned sb> SIMDPP_INL
+uint64<4> i_clmul(const uint64<4>& a, const uint64<4>& b)
+{
+    uint64<2> a0, a1, b0, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    return combine(i_clmul<sa,sb>(a0, b0), i_clmul<sa,sb>(a1, b1));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned sa, unsigned sb> SIMDPP_INL
+uint64<8> i_clmul(const uint64<8>& a, const uint64<8>& b)
+{
+    uint64<4> a0, a1, b0, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    return combine(i_clmul<sa,sb>(a0, b0), i_clmul<sa,sb>(a1, b1));
+}
+#endif
+
+template<unsigned sa, unsigned sb, unsigned N> SIMDPP_INL
+uint64<N> i_clmul(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, (i_clmul<sa,sb>), a, b)
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
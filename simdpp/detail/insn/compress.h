@@ -0,0 +1,1158 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/zip_lo.h>
+#include <simdpp/detail/insn/compress_tables.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+static SIMDPP_INL
+unsigned i_compress_popcnt(uint64_t bits)
+{
+#if SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
+    return (unsigned) _mm_popcnt_u64(bits);
+#elif SIMDPP_USE_X86_POPCNT_INSN
+    return _mm_popcnt_u32(uint32_t(bits)) + _mm_popcnt_u32(uint32_t(bits >> 32));
+#else
+    uint64_t v = bits;
+    v = v - ((v >> 1) & 0x5555555555555555);
+    v = (v & 0x3333333333333333) + ((v >> 2) & 0x3333333333333333);
+    v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0f;
+    return (unsigned)((v * 0x0101010101010101) >> 56);
+#endif
+}
+
+// Compacts the bits returned by extract_bits_any() for elements that are
+// 2, 4 or 8 bytes wide into one bit per element
+static SIMDPP_INL
+uint64_t i_compact_mask_bits2(uint64_t b)
+{
+    b &= 0x5555;
+    b = (b | (b >> 1)) & 0x3333;
+    b = (b | (b >> 2)) & 0x0f0f;
+    b = (b | (b >> 4)) & 0x00ff;
+    return b;
+}
+
+static SIMDPP_INL
+uint64_t i_compact_mask_bits4(uint64_t b)
+{
+    b &= 0x1111;
+    b = (b | (b >> 3)) & 0x0303;
+    b = (b | (b >> 6)) & 0x000f;
+    return b;
+}
+
+static SIMDPP_INL
+uint64_t i_compact_mask_bits8(uint64_t b)
+{
+    b &= 0x0101;
+    b = (b | (b >> 7)) & 0x0003;
+    return b;
+}
+
+// -----------------------------------------------------------------------------
+// Returns a bit for each element of the mask, the first element in the least
+// significant bit
+
+#if SIMDPP_USE_AVX512F
+/*  Converts the value of an AVX-512 mask register to a bit mask. GCC 12 may
+    implement the zero extension of the value of a mask register to 64 bits
+    as a store of the width of the mask to a 64-bit stack slot, leaving
+    garbage in the upper bits. The moves are done explicitly to avoid this.
+*/
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER)
+#define SIMDPP_DETAIL_KMASK_BITS(INSN, TYPE, RTYPE)                             \
+static SIMDPP_INL uint64_t i_kmask_bits(TYPE m)                                 \
+{                                                                               \
+    RTYPE r;                                                                    \
+    __asm__(INSN " %1, %0" : "=r"(r) : "k"(m));                                 \
+    return (TYPE) r;                                                            \
+}
+#else
+#define SIMDPP_DETAIL_KMASK_BITS(INSN, TYPE, RTYPE)                             \
+static SIMDPP_INL uint64_t i_kmask_bits(TYPE m) { return m; }
+#endif
+
+// kmovb requires AVX512DQ, thus kmovw is used for 8-bit masks and the result
+// is truncated
+SIMDPP_DETAIL_KMASK_BITS("kmovw", __mmask8, uint32_t)
+SIMDPP_DETAIL_KMASK_BITS("kmovw", __mmask16, uint32_t)
+#if SIMDPP_USE_AVX512BW || SIMDPP_USE_AVX512VL
+SIMDPP_DETAIL_KMASK_BITS("kmovd", __mmask32, uint32_t)
+SIMDPP_DETAIL_KMASK_BITS("kmovq", __mmask64, uint64_t)
+#endif
+#undef SIMDPP_DETAIL_KMASK_BITS
+#endif
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#else
+    return i_extract_bits_any(uint8<16>(mask.unmask()));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_epi8(_mm_packs_epi16(mask.native(), _mm_setzero_si128()));
+#else
+    return i_compact_mask_bits2(i_extract_bits_any(uint8<16>(mask.unmask())));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_ps(_mm_castsi128_ps(mask.native()));
+#else
+    return i_compact_mask_bits4(i_extract_bits_any(uint8<16>(mask.unmask())));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_pd(_mm_castsi128_pd(mask.native()));
+#else
+    return i_compact_mask_bits8(i_extract_bits_any(uint8<16>(mask.unmask())));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_ps(mask.native());
+#else
+    uint8<16> a = bit_cast<uint8<16>>(mask.unmask());
+    return i_compact_mask_bits4(i_extract_bits_any(a));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_pd(mask.native());
+#else
+    uint8<16> a = bit_cast<uint8<16>>(mask.unmask());
+    return i_compact_mask_bits8(i_extract_bits_any(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#else
+    return (uint32_t) _mm256_movemask_epi8(mask.native());
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#else
+    // packs works within 128-bit lanes, thus the bits of the upper half end
+    // up in bits 16-23
+    __m256i p = _mm256_packs_epi16(mask.native(), _mm256_setzero_si256());
+    uint32_t b = _mm256_movemask_epi8(p);
+    return (b & 0xff) | ((b >> 8) & 0xff00);
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#else
+    return _mm256_movemask_ps(_mm256_castsi256_ps(mask.native()));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#else
+    return _mm256_movemask_pd(_mm256_castsi256_pd(mask.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#else
+    return _mm256_movemask_ps(mask.native());
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_kmask_bits(mask.native());
+#else
+    return _mm256_movemask_pd(mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int8<64>& mask) { return i_kmask_bits(mask.native()); }
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int16<32>& mask) { return i_kmask_bits(mask.native()); }
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int32<16>& mask) { return i_kmask_bits(mask.native()); }
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_int64<8>& mask) { return i_kmask_bits(mask.native()); }
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_float32<16>& mask) { return i_kmask_bits(mask.native()); }
+
+static SIMDPP_INL
+uint64_t i_mask_bits(const mask_float64<8>& mask) { return i_kmask_bits(mask.native()); }
+#endif
+
+template<class M> SIMDPP_INL
+unsigned i_mask_count_vec(const M& mask, std::true_type)
+{
+    return i_compress_popcnt(i_mask_bits(mask));
+}
+
+template<class M> SIMDPP_INL
+unsigned i_mask_count_vec(const M& mask, std::false_type)
+{
+    unsigned r = 0;
+    for (unsigned i = 0; i < M::vec_length; ++i) {
+        r += i_compress_popcnt(i_mask_bits(mask.vec(i)));
+    }
+    return r;
+}
+
+// Returns the number of the selected elements
+template<class M> SIMDPP_INL
+unsigned i_mask_count(const M& mask)
+{
+    return i_mask_count_vec(mask, std::integral_constant<bool, M::vec_length == 1>());
+}
+
+// -----------------------------------------------------------------------------
+// Element-wise implementations for instruction sets without byte shuffle
+
+template<class V> SIMDPP_INL
+V i_compress_bits_emul(const V& a, uint64_t bits)
+{
+    mem_block<V> ma = a;
+    mem_block<V> r;
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[n] = ma[i];
+        n += (bits >> i) & 1;
+    }
+    for (; n < V::length; ++n) {
+        r[n] = 0;
+    }
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V i_expand_bits_emul(const V& a, uint64_t bits)
+{
+    using T = typename V::element_type;
+    mem_block<V> ma = a;
+    mem_block<V> r;
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        bool sel = (bits >> i) & 1;
+        r[i] = sel ? ma[n] : T(0);
+        n += sel;
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+// Byte shuffle masks for 128-bit vectors
+
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+static SIMDPP_INL
+uint8<16> i_compress_shuffle_mask8(uint64_t bits)
+{
+    const uint8_t* table = i_compress_table8();
+    unsigned lo = bits & 0xff;
+    unsigned hi = (bits >> 8) & 0xff;
+    uint64_t lo_idx, hi_idx;
+    std::memcpy(&lo_idx, table + lo * 8, 8);
+    std::memcpy(&hi_idx, table + hi * 8, 8);
+    hi_idx |= 0x0808080808080808; // the unused 0xff bytes are not affected
+
+    SIMDPP_ALIGN(16) uint8_t buf[16];
+    store(buf, uint8<16>(make_ones()));
+    std::memcpy(buf, &lo_idx, 8);
+    std::memcpy(buf + i_compress_popcnt(lo), &hi_idx, 8);
+    return load(buf);
+}
+
+static SIMDPP_INL
+uint8<16> i_expand_shuffle_mask8(uint64_t bits)
+{
+    const uint8_t* table = i_expand_table8();
+    unsigned lo = bits & 0xff;
+    unsigned hi = (bits >> 8) & 0xff;
+    uint64_t lo_idx, hi_idx;
+    std::memcpy(&lo_idx, table + lo * 8, 8);
+    std::memcpy(&hi_idx, table + hi * 8, 8);
+
+    // The elements of the upper half are taken from after the elements used by
+    // the lower half. The indices are at most 15, thus the sign bit of the
+    // unused bytes can be preserved without a carry into the next byte.
+    const uint64_t msb = 0x8080808080808080;
+    uint64_t offset = i_compress_popcnt(lo) * 0x0101010101010101;
+    hi_idx = ((hi_idx & ~msb) + offset) | (hi_idx & msb);
+
+    SIMDPP_ALIGN(16) uint8_t buf[16];
+    std::memcpy(buf, &lo_idx, 8);
+    std::memcpy(buf + 8, &hi_idx, 8);
+    return load(buf);
+}
+
+// Expands the 8-bit indices of the first 8 elements to byte indices of 16-bit
+// elements
+static SIMDPP_INL
+uint8<16> i_shuffle_mask8_to_16(const uint8<16>& idx)
+{
+    uint8<16> r = zip16_lo(idx, idx);
+    r = add(r, r); // 0xff stays negative
+    return bit_or(r, uint8<16>(make_uint(0, 1)));
+}
+
+static SIMDPP_INL
+uint8<16> i_compress_shuffle_mask16(uint64_t bits)
+{
+    uint8<16> idx = load_u(i_compress_table8() + bits * 8);
+    return i_shuffle_mask8_to_16(idx);
+}
+
+static SIMDPP_INL
+uint8<16> i_expand_shuffle_mask16(uint64_t bits)
+{
+    uint8<16> idx = load_u(i_expand_table8() + bits * 8);
+    return i_shuffle_mask8_to_16(idx);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Implementations that take the mask as a bit mask. These are used when there
+// is no native compress or expand instruction.
+
+static SIMDPP_INL
+uint8<16> i_compress_bits(const uint8<16>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return permute_zbytes16(a, i_compress_shuffle_mask8(bits));
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<8> i_compress_bits(const uint16<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return uint16<8>(permute_zbytes16(uint8<16>(a), i_compress_shuffle_mask16(bits)));
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint32<4> i_compress_bits(const uint32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    uint8<16> idx = load_u(i_compress_table32() + bits * 16);
+    return uint32<4>(permute_zbytes16(uint8<16>(a), idx));
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint64<2> i_compress_bits(const uint64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    uint8<16> idx = load_u(i_compress_table64() + bits * 16);
+    return uint64<2>(permute_zbytes16(uint8<16>(a), idx));
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float32<4> i_compress_bits(const float32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return bit_cast<float32<4>>(i_compress_bits(bit_cast<uint32<4>>(a), bits));
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float64<2> i_compress_bits(const float64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return bit_cast<float64<2>>(i_compress_bits(bit_cast<uint64<2>>(a), bits));
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint8<16> i_expand_bits(const uint8<16>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return permute_zbytes16(a, i_expand_shuffle_mask8(bits));
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<8> i_expand_bits(const uint16<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return uint16<8>(permute_zbytes16(uint8<16>(a), i_expand_shuffle_mask16(bits)));
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint32<4> i_expand_bits(const uint32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    uint8<16> idx = load_u(i_expand_table32() + bits * 16);
+    return uint32<4>(permute_zbytes16(uint8<16>(a), idx));
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint64<2> i_expand_bits(const uint64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    uint8<16> idx = load_u(i_expand_table64() + bits * 16);
+    return uint64<2>(permute_zbytes16(uint8<16>(a), idx));
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float32<4> i_expand_bits(const float32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return bit_cast<float32<4>>(i_expand_bits(bit_cast<uint32<4>>(a), bits));
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float64<2> i_expand_bits(const float64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return bit_cast<float64<2>>(i_expand_bits(bit_cast<uint64<2>>(a), bits));
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+// Used by i_compress_bits_halves for 512-bit vectors
+static SIMDPP_INL uint8<32> i_compress_bits(const uint8<32>& a, uint64_t bits);
+static SIMDPP_INL uint16<16> i_compress_bits(const uint16<16>& a, uint64_t bits);
+static SIMDPP_INL uint8<32> i_expand_bits(const uint8<32>& a, uint64_t bits);
+static SIMDPP_INL uint16<16> i_expand_bits(const uint16<16>& a, uint64_t bits);
+#endif
+
+/*  Compresses the two halves of a vector separately and joins the results in
+    memory. H is the type of the halves.
+*/
+template<class H, class V> SIMDPP_INL
+V i_compress_bits_halves(const V& a, uint64_t bits)
+{
+    using T = typename V::element_type;
+    const unsigned half = H::length;
+    uint64_t lo_bits = bits & ((uint64_t(1) << half) - 1);
+    uint64_t hi_bits = bits >> half;
+
+    H lo, hi;
+    split(a, lo, hi);
+    SIMDPP_ALIGN(64) T buf[V::length];
+    store(buf + half, H(make_zero()));
+    store(buf, i_compress_bits(lo, lo_bits));
+    store_u(buf + i_compress_popcnt(lo_bits), i_compress_bits(hi, hi_bits));
+    return load(buf);
+}
+
+template<class H, class V> SIMDPP_INL
+V i_expand_bits_halves(const V& a, uint64_t bits)
+{
+    using T = typename V::element_type;
+    const unsigned half = H::length;
+    uint64_t lo_bits = bits & ((uint64_t(1) << half) - 1);
+    uint64_t hi_bits = bits >> half;
+
+    SIMDPP_ALIGN(64) T buf[V::length];
+    store(buf, a);
+    H lo = load(buf);
+    H hi = load_u(buf + i_compress_popcnt(lo_bits));
+    lo = i_expand_bits(lo, lo_bits);
+    hi = i_expand_bits(hi, hi_bits);
+    return combine(lo, hi);
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_compress_bits(const uint8<32>& a, uint64_t bits)
+{
+    return i_compress_bits_halves<uint8<16>>(a, bits);
+}
+
+static SIMDPP_INL
+uint16<16> i_compress_bits(const uint16<16>& a, uint64_t bits)
+{
+    return i_compress_bits_halves<uint16<8>>(a, bits);
+}
+
+static SIMDPP_INL
+uint32<8> i_compress_bits(const uint32<8>& a, uint64_t bits)
+{
+    __m128i e = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(
+                                    i_compress_table8() + bits * 8));
+    __m256i idx = _mm256_cvtepi8_epi32(e);
+    __m256i r = _mm256_permutevar8x32_epi32(a.native(), idx);
+    return _mm256_andnot_si256(_mm256_srai_epi32(idx, 31), r);
+}
+
+static SIMDPP_INL
+uint64<4> i_compress_bits(const uint64<4>& a, uint64_t bits)
+{
+    int32_t e;
+    std::memcpy(&e, i_compress_table8() + bits * 8, 4);
+    __m256i idx = _mm256_cvtepi8_epi64(_mm_cvtsi32_si128(e));
+    // element i is moved by selecting 32-bit elements 2*i and 2*i+1
+    __m256i p = _mm256_or_si256(_mm256_slli_epi64(idx, 1), _mm256_slli_epi64(idx, 33));
+    p = _mm256_or_si256(p, _mm256_set1_epi64x(int64_t(1) << 32));
+    __m256i r = _mm256_permutevar8x32_epi32(a.native(), p);
+    return _mm256_andnot_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), idx), r);
+}
+
+static SIMDPP_INL
+uint8<32> i_expand_bits(const uint8<32>& a, uint64_t bits)
+{
+    return i_expand_bits_halves<uint8<16>>(a, bits);
+}
+
+static SIMDPP_INL
+uint16<16> i_expand_bits(const uint16<16>& a, uint64_t bits)
+{
+    return i_expand_bits_halves<uint16<8>>(a, bits);
+}
+
+static SIMDPP_INL
+uint32<8> i_expand_bits(const uint32<8>& a, uint64_t bits)
+{
+    __m128i e = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(
+                                    i_expand_table8() + bits * 8));
+    __m256i idx = _mm256_cvtepi8_epi32(e);
+    __m256i r = _mm256_permutevar8x32_epi32(a.native(), idx);
+    return _mm256_andnot_si256(_mm256_srai_epi32(idx, 31), r);
+}
+
+static SIMDPP_INL
+uint64<4> i_expand_bits(const uint64<4>& a, uint64_t bits)
+{
+    int32_t e;
+    std::memcpy(&e, i_expand_table8() + bits * 8, 4);
+    __m256i idx = _mm256_cvtepi8_epi64(_mm_cvtsi32_si128(e));
+    __m256i p = _mm256_or_si256(_mm256_slli_epi64(idx, 1), _mm256_slli_epi64(idx, 33));
+    p = _mm256_or_si256(p, _mm256_set1_epi64x(int64_t(1) << 32));
+    __m256i r = _mm256_permutevar8x32_epi32(a.native(), p);
+    return _mm256_andnot_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), idx), r);
+}
+#endif
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32<8> i_compress_bits(const float32<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX2
+    return bit_cast<float32<8>>(i_compress_bits(bit_cast<uint32<8>>(a), bits));
+#else
+    return i_compress_bits_halves<float32<4>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float64<4> i_compress_bits(const float64<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX2
+    return bit_cast<float64<4>>(i_compress_bits(bit_cast<uint64<4>>(a), bits));
+#else
+    return i_compress_bits_halves<float64<2>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float32<8> i_expand_bits(const float32<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX2
+    return bit_cast<float32<8>>(i_expand_bits(bit_cast<uint32<8>>(a), bits));
+#else
+    return i_expand_bits_halves<float32<4>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float64<4> i_expand_bits(const float64<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX2
+    return bit_cast<float64<4>>(i_expand_bits(bit_cast<uint64<4>>(a), bits));
+#else
+    return i_expand_bits_halves<float64<2>>(a, bits);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_compress_bits(const uint8<64>& a, uint64_t bits)
+{
+    return i_compress_bits_halves<uint8<32>>(a, bits);
+}
+
+static SIMDPP_INL
+uint16<32> i_compress_bits(const uint16<32>& a, uint64_t bits)
+{
+    return i_compress_bits_halves<uint16<16>>(a, bits);
+}
+
+static SIMDPP_INL
+uint8<64> i_expand_bits(const uint8<64>& a, uint64_t bits)
+{
+    return i_expand_bits_halves<uint8<32>>(a, bits);
+}
+
+static SIMDPP_INL
+uint16<32> i_expand_bits(const uint16<32>& a, uint64_t bits)
+{
+    return i_expand_bits_halves<uint16<16>>(a, bits);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Native compress and expand instructions
+
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint8<16> i_compress(const uint8<16>& a, const mask_int8<16>& mask)
+{
+    return _mm_maskz_compress_epi8(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint8<32> i_compress(const uint8<32>& a, const mask_int8<32>& mask)
+{
+    return _mm256_maskz_compress_epi8(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint16<8> i_compress(const uint16<8>& a, const mask_int16<8>& mask)
+{
+    return _mm_maskz_compress_epi16(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_compress(const uint16<16>& a, const mask_int16<16>& mask)
+{
+    return _mm256_maskz_compress_epi16(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint8<16> i_expand(const uint8<16>& a, const mask_int8<16>& mask)
+{
+    return _mm_maskz_expand_epi8(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint8<32> i_expand(const uint8<32>& a, const mask_int8<32>& mask)
+{
+    return _mm256_maskz_expand_epi8(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint16<8> i_expand(const uint16<8>& a, const mask_int16<8>& mask)
+{
+    return _mm_maskz_expand_epi16(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_expand(const uint16<16>& a, const mask_int16<16>& mask)
+{
+    return _mm256_maskz_expand_epi16(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint8<16>& a, const mask_int8<16>& mask)
+{
+    _mm_mask_compressstoreu_epi8(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint8<32>& a, const mask_int8<32>& mask)
+{
+    _mm256_mask_compressstoreu_epi8(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint16<8>& a, const mask_int16<8>& mask)
+{
+    _mm_mask_compressstoreu_epi16(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint16<16>& a, const mask_int16<16>& mask)
+{
+    _mm256_mask_compressstoreu_epi16(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512VBMI2
+static SIMDPP_INL
+uint8<64> i_compress(const uint8<64>& a, const mask_int8<64>& mask)
+{
+    return _mm512_maskz_compress_epi8(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint16<32> i_compress(const uint16<32>& a, const mask_int16<32>& mask)
+{
+    return _mm512_maskz_compress_epi16(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint8<64> i_expand(const uint8<64>& a, const mask_int8<64>& mask)
+{
+    return _mm512_maskz_expand_epi8(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint16<32> i_expand(const uint16<32>& a, const mask_int16<32>& mask)
+{
+    return _mm512_maskz_expand_epi16(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint8<64>& a, const mask_int8<64>& mask)
+{
+    _mm512_mask_compressstoreu_epi8(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint16<32>& a, const mask_int16<32>& mask)
+{
+    _mm512_mask_compressstoreu_epi16(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint32<4> i_compress(const uint32<4>& a, const mask_int32<4>& mask)
+{
+    return _mm_maskz_compress_epi32(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint32<8> i_compress(const uint32<8>& a, const mask_int32<8>& mask)
+{
+    return _mm256_maskz_compress_epi32(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64<2> i_compress(const uint64<2>& a, const mask_int64<2>& mask)
+{
+    return _mm_maskz_compress_epi64(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64<4> i_compress(const uint64<4>& a, const mask_int64<4>& mask)
+{
+    return _mm256_maskz_compress_epi64(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float32<4> i_compress(const float32<4>& a, const mask_float32<4>& mask)
+{
+    return _mm_maskz_compress_ps(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float32<8> i_compress(const float32<8>& a, const mask_float32<8>& mask)
+{
+    return _mm256_maskz_compress_ps(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float64<2> i_compress(const float64<2>& a, const mask_float64<2>& mask)
+{
+    return _mm_maskz_compress_pd(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float64<4> i_compress(const float64<4>& a, const mask_float64<4>& mask)
+{
+    return _mm256_maskz_compress_pd(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint32<4> i_expand(const uint32<4>& a, const mask_int32<4>& mask)
+{
+    return _mm_maskz_expand_epi32(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint32<8> i_expand(const uint32<8>& a, const mask_int32<8>& mask)
+{
+    return _mm256_maskz_expand_epi32(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64<2> i_expand(const uint64<2>& a, const mask_int64<2>& mask)
+{
+    return _mm_maskz_expand_epi64(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64<4> i_expand(const uint64<4>& a, const mask_int64<4>& mask)
+{
+    return _mm256_maskz_expand_epi64(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float32<4> i_expand(const float32<4>& a, const mask_float32<4>& mask)
+{
+    return _mm_maskz_expand_ps(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float32<8> i_expand(const float32<8>& a, const mask_float32<8>& mask)
+{
+    return _mm256_maskz_expand_ps(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float64<2> i_expand(const float64<2>& a, const mask_float64<2>& mask)
+{
+    return _mm_maskz_expand_pd(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float64<4> i_expand(const float64<4>& a, const mask_float64<4>& mask)
+{
+    return _mm256_maskz_expand_pd(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint32<4>& a, const mask_int32<4>& mask)
+{
+    _mm_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint32<8>& a, const mask_int32<8>& mask)
+{
+    _mm256_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint64<2>& a, const mask_int64<2>& mask)
+{
+    _mm_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint64<4>& a, const mask_int64<4>& mask)
+{
+    _mm256_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const float32<4>& a, const mask_float32<4>& mask)
+{
+    _mm_mask_compressstoreu_ps(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const float32<8>& a, const mask_float32<8>& mask)
+{
+    _mm256_mask_compressstoreu_ps(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const float64<2>& a, const mask_float64<2>& mask)
+{
+    _mm_mask_compressstoreu_pd(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const float64<4>& a, const mask_float64<4>& mask)
+{
+    _mm256_mask_compressstoreu_pd(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_compress(const uint32<16>& a, const mask_int32<16>& mask)
+{
+    return _mm512_maskz_compress_epi32(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64<8> i_compress(const uint64<8>& a, const mask_int64<8>& mask)
+{
+    return _mm512_maskz_compress_epi64(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float32<16> i_compress(const float32<16>& a, const mask_float32<16>& mask)
+{
+    return _mm512_maskz_compress_ps(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float64<8> i_compress(const float64<8>& a, const mask_float64<8>& mask)
+{
+    return _mm512_maskz_compress_pd(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint32<16> i_expand(const uint32<16>& a, const mask_int32<16>& mask)
+{
+    return _mm512_maskz_expand_epi32(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64<8> i_expand(const uint64<8>& a, const mask_int64<8>& mask)
+{
+    return _mm512_maskz_expand_epi64(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float32<16> i_expand(const float32<16>& a, const mask_float32<16>& mask)
+{
+    return _mm512_maskz_expand_ps(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+float64<8> i_expand(const float64<8>& a, const mask_float64<8>& mask)
+{
+    return _mm512_maskz_expand_pd(mask.native(), a.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint32<16>& a, const mask_int32<16>& mask)
+{
+    _mm512_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const float32<16>& a, const mask_float32<16>& mask)
+{
+    _mm512_mask_compressstoreu_ps(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const float64<8>& a, const mask_float64<8>& mask)
+{
+    _mm512_mask_compressstoreu_pd(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Generic implementations. Vectors consisting of several native vectors are
+// processed one native vector at a time and joined in memory.
+
+template<class V, class M> SIMDPP_INL
+V i_compress(const V& a, const M& mask);
+template<class V, class M> SIMDPP_INL
+V i_expand(const V& a, const M& mask);
+
+template<class V, class M> SIMDPP_INL
+V i_compress_vec(const V& a, const M& mask, std::true_type)
+{
+    return i_compress_bits(a, i_mask_bits(mask));
+}
+
+template<class V, class M> SIMDPP_INL
+V i_compress_vec(const V& a, const M& mask, std::false_type)
+{
+    using T = typename V::element_type;
+    using B = typename V::base_vector_type;
+
+    SIMDPP_ALIGN(64) T buf[V::length + B::length];
+    store(buf, V(make_zero()));
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        store_u(buf + n, i_compress(a.vec(i), mask.vec(i)));
+        n += i_mask_count(mask.vec(i));
+    }
+    return load(buf);
+}
+
+template<class V, class M> SIMDPP_INL
+V i_compress(const V& a, const M& mask)
+{
+    return i_compress_vec(a, mask, std::integral_constant<bool, V::vec_length == 1>());
+}
+
+template<class V, class M> SIMDPP_INL
+V i_expand_vec(const V& a, const M& mask, std::true_type)
+{
+    return i_expand_bits(a, i_mask_bits(mask));
+}
+
+template<class V, class M> SIMDPP_INL
+V i_expand_vec(const V& a, const M& mask, std::false_type)
+{
+    using T = typename V::element_type;
+    using B = typename V::base_vector_type;
+
+    SIMDPP_ALIGN(64) T buf[V::length];
+    store(buf, a);
+    V r;
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        // n never exceeds the number of elements in the preceding vectors
+        B src = load_u(buf + n);
+        r.vec(i) = i_expand(src, mask.vec(i));
+        n += i_mask_count(mask.vec(i));
+    }
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_expand(const V& a, const M& mask)
+{
+    return i_expand_vec(a, mask, std::integral_constant<bool, V::vec_length == 1>());
+}
+
+template<class V, class M> SIMDPP_INL
+unsigned i_compress_store_u(char* p, const V& a, const M& mask)
+{
+    using T = typename V::element_type;
+
+    mem_block<V> r = i_compress(a, mask);
+    unsigned n = i_mask_count(mask);
+    std::memcpy(p, r.data(), n * sizeof(T));
+    return n;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,385 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_TABLES_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_TABLES_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Lookup tables used by compress() and expand() on instruction sets that have
+    a byte shuffle, but no compress instruction. The tables are indexed by the
+    bit mask of the selected elements. Unused bytes are set to 0xff, so that
+    they select zero in permute_zbytes16 and become -1 when sign-extended.
+*/
+
+/*  Entry m contains the positions of the set bits in m, in increasing order.
+    The entries are 8 bytes long. The table is padded so that 16 bytes can be
+    loaded from any entry.
+*/
+static SIMDPP_INL const uint8_t* i_compress_table8()
+{
+    static const uint8_t table[256*8 + 8] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff,
+        0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0xff, 0xff, 0xff, 0xff,
+        0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff,
+        0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x05, 0xff, 0xff, 0xff, 0xff,
+        0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x05, 0xff, 0xff, 0xff,
+        0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x05, 0xff, 0xff, 0xff,
+        0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff,
+        0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x06, 0xff, 0xff, 0xff,
+        0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x06, 0xff, 0xff, 0xff,
+        0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0xff, 0xff,
+        0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x05, 0x06, 0xff, 0xff, 0xff,
+        0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0xff, 0xff,
+        0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff,
+        0x02, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0xff, 0xff,
+        0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff,
+        0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x07, 0xff, 0xff, 0xff,
+        0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x07, 0xff, 0xff, 0xff,
+        0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x07, 0xff, 0xff,
+        0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x05, 0x07, 0xff, 0xff, 0xff,
+        0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x05, 0x07, 0xff, 0xff,
+        0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff,
+        0x02, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x05, 0x07, 0xff, 0xff,
+        0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff,
+        0x02, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0xff,
+        0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x02, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x02, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0xff, 0xff,
+        0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x02, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0xff, 0xff,
+        0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff,
+        0x02, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0xff,
+        0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x02, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x05, 0x06, 0x07, 0xff, 0xff,
+        0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff,
+        0x02, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff,
+        0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0xff,
+        0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff,
+        0x01, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff,
+        0x02, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x02, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff,
+        0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0xff,
+        0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff,
+        0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    };
+    return table;
+}
+
+/*  Entry m contains, for each set bit in m, the number of set bits below it.
+    The entries are 8 bytes long. The table is padded so that 16 bytes can be
+    loaded from any entry.
+*/
+static SIMDPP_INL const uint8_t* i_expand_table8()
+{
+    static const uint8_t table[256*8 + 8] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04, 0xff,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05, 0xff,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05, 0xff,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0x03,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0x04,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff, 0x03,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff, 0x04,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff, 0x04,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0x05,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0x03,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff, 0x04,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff, 0x04,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff, 0x05,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff, 0x04,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff, 0x05,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff, 0x05,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0x06,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02, 0x03,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03, 0x04,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03, 0x04,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04, 0x05,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03, 0x04,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04, 0x05,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04, 0x05,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05, 0x06,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03,
+        0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03, 0x04,
+        0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04,
+        0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04, 0x05,
+        0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04,
+        0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04, 0x05,
+        0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05,
+        0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05, 0x06,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04,
+        0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04, 0x05,
+        0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05,
+        0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05, 0x06,
+        0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    };
+    return table;
+}
+
+// Byte shuffle masks that pack the selected 32-bit elements of a 128-bit vector
+static SIMDPP_INL const uint8_t* i_compress_table32()
+{
+    static const uint8_t table[16*16] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x08, 0x09, 0x0a, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xff, 0xff, 0xff,
+        0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+    return table;
+}
+
+// Byte shuffle masks that are the inverse of those in i_compress_table32
+static SIMDPP_INL const uint8_t* i_expand_table32()
+{
+    static const uint8_t table[16*16] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03,
+        0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x05, 0x06, 0x07,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0x04, 0x05, 0x06, 0x07,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0x08, 0x09, 0x0a, 0x0b,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+    return table;
+}
+
+// Byte shuffle masks that pack the selected 64-bit elements of a 128-bit vector
+static SIMDPP_INL const uint8_t* i_compress_table64()
+{
+    static const uint8_t table[4*16] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+    return table;
+}
+
+// Byte shuffle masks that are the inverse of those in i_compress_table64
+static SIMDPP_INL const uint8_t* i_expand_table64()
+{
+    static const uint8_t table[4*16] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+    return table;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,299 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CRC_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CRC_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/clmul.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+
+#if SIMDPP_USE_NEON && __ARM_FEATURE_CRC32
+#include <arm_acle.h>
+#define SIMDPP_DETAIL_USE_ARM_CRC32 1
+#else
+#define SIMDPP_DETAIL_USE_ARM_CRC32 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The parameters of the supported CRCs. All of them use reflected bit order.
+
+    The constants are reflected 64-bit representations of polynomials modulo
+    the CRC polynomial P of degree n. A product computed by clmul() of two
+    such values is the reflected 128-bit representation of the product
+    multiplied by x, thus the exponents below are one less than the distance
+    the data is moved by.
+
+     - fold1_lo, fold1_hi: x^(128+63) mod P, x^(128-1) mod P
+     - fold4_lo, fold4_hi: x^(512+63) mod P, x^(512-1) mod P
+     - reduce: x^(64+n-1) mod P
+     - mu: floor(x^(64+n) / P) without the x^64 term
+     - poly: P without the x^n term
+*/
+struct crc32_params {
+    using type = uint32_t;
+    static const unsigned width = 32;
+    static uint32_t rpoly() { return 0xedb88320; }
+    static uint64_t fold1_lo() { return 0x65673b4600000000; }
+    static uint64_t fold1_hi() { return 0x9ba54c6f00000000; }
+    static uint64_t fold4_lo() { return 0x653d982200000000; }
+    static uint64_t fold4_hi() { return 0xcad38e8f00000000; }
+    static uint64_t reduce() { return 0xccaa009e00000000; }
+    static uint64_t mu() { return 0x5a72d812fb808b20; }
+    static uint64_t poly() { return 0xedb8832000000000; }
+};
+
+struct crc32c_params {
+    using type = uint32_t;
+    static const unsigned width = 32;
+    static uint32_t rpoly() { return 0x82f63b78; }
+    static uint64_t fold1_lo() { return 0x3743f7bd00000000; }
+    static uint64_t fold1_hi() { return 0x3171d43000000000; }
+    static uint64_t fold4_lo() { return 0x1c19243b00000000; }
+    static uint64_t fold4_hi() { return 0x75bba45b00000000; }
+    static uint64_t reduce() { return 0x493c7d2700000000; }
+    static uint64_t mu() { return 0xa434f61c6f5389f8; }
+    static uint64_t poly() { return 0x82f63b7800000000; }
+};
+
+// CRC-64/XZ, the ECMA-182 polynomial
+struct crc64_params {
+    using type = uint64_t;
+    static const unsigned width = 64;
+    static uint64_t rpoly() { return 0xc96c5795d7870f42; }
+    static uint64_t fold1_lo() { return 0xe05dd497ca393ae4; }
+    static uint64_t fold1_hi() { return 0xdabe95afc7875f40; }
+    static uint64_t fold4_lo() { return 0x6ae3efbb9dd441f3; }
+    static uint64_t fold4_hi() { return 0x081f6054a7842df4; }
+    static uint64_t reduce() { return 0xdabe95afc7875f40; }
+    static uint64_t mu() { return 0x4e1f23360b94b1ea; }
+    static uint64_t poly() { return 0xc96c5795d7870f42; }
+};
+
+/*  Slicing-by-8 tables: t[k][b] is the CRC of the byte b followed by k zero
+    bytes. The tables are computed on first use.
+*/
+template<class P>
+struct i_crc_table {
+    using T = typename P::type;
+    T t[8][256];
+
+    i_crc_table()
+    {
+        for (unsigned b = 0; b < 256; ++b) {
+            T c = b;
+            for (unsigned i = 0; i < 8; ++i)
+                c = (c & 1) ? (c >> 1) ^ P::rpoly() : c >> 1;
+            t[0][b] = c;
+        }
+        for (unsigned k = 1; k < 8; ++k) {
+            for (unsigned b = 0; b < 256; ++b)
+                t[k][b] = (t[k-1][b] >> 8) ^ t[0][t[k-1][b] & 0xff];
+        }
+    }
+
+    static const i_crc_table& get()
+    {
+        static const i_crc_table table;
+        return table;
+    }
+};
+
+static SIMDPP_INL uint64_t i_crc_load_le64(const uint8_t* p)
+{
+    uint64_t r = 0;
+    for (unsigned i = 0; i < 8; ++i)
+        r |= uint64_t(p[i]) << (8 * i);
+    return r;
+}
+
+// Updates the CRC state @a crc with the data using lookup tables
+template<class P> SIMDPP_INL
+typename P::type i_crc_scalar(const P&, typename P::type crc,
+                              const uint8_t* p, std::size_t n)
+{
+    using T = typename P::type;
+    const i_crc_table<P>& tb = i_crc_table<P>::get();
+    for (; n >= 8; n -= 8, p += 8) {
+        uint64_t v = crc ^ i_crc_load_le64(p);
+        crc = tb.t[7][v & 0xff] ^ tb.t[6][(v >> 8) & 0xff] ^
+              tb.t[5][(v >> 16) & 0xff] ^ tb.t[4][(v >> 24) & 0xff] ^
+              tb.t[3][(v >> 32) & 0xff] ^ tb.t[2][(v >> 40) & 0xff] ^
+              tb.t[1][(v >> 48) & 0xff] ^ tb.t[0][v >> 56];
+    }
+    for (; n > 0; --n, ++p)
+        crc = T(crc >> 8) ^ tb.t[0][(crc ^ *p) & 0xff];
+    return crc;
+}
+
+static SIMDPP_INL uint32_t i_crc32c_u8(uint32_t crc, uint8_t v)
+{
+#if SIMDPP_USE_SSE4_2
+    return _mm_crc32_u8(crc, v);
+#elif SIMDPP_DETAIL_USE_ARM_CRC32
+    return __crc32cb(crc, v);
+#else
+    return i_crc_scalar(crc32c_params(), crc, &v, 1);
+#endif
+}
+
+static SIMDPP_INL uint32_t i_crc32c_u32(uint32_t crc, uint32_t v)
+{
+#if SIMDPP_USE_SSE4_2
+    return _mm_crc32_u32(crc, v);
+#elif SIMDPP_DETAIL_USE_ARM_CRC32
+    return __crc32cw(crc, v);
+#else
+    for (unsigned i = 0; i < 4; ++i)
+        crc = i_crc32c_u8(crc, uint8_t(v >> (8 * i)));
+    return crc;
+#endif
+}
+
+static SIMDPP_INL uint32_t i_crc32c_u64(uint32_t crc, uint64_t v)
+{
+#if SIMDPP_USE_SSE4_2 && SIMDPP_64_BITS
+    return uint32_t(_mm_crc32_u64(crc, v));
+#elif SIMDPP_DETAIL_USE_ARM_CRC32
+    return __crc32cd(crc, v);
+#else
+    crc = i_crc32c_u32(crc, uint32_t(v));
+    return i_crc32c_u32(crc, uint32_t(v >> 32));
+#endif
+}
+
+#if SIMDPP_USE_SSE4_2 || SIMDPP_DETAIL_USE_ARM_CRC32
+static SIMDPP_INL
+uint32_t i_crc_scalar(const crc32c_params&, uint32_t crc, const uint8_t* p, std::size_t n)
+{
+    for (; n >= 8; n -= 8, p += 8)
+        crc = i_crc32c_u64(crc, i_crc_load_le64(p));
+    for (; n > 0; --n, ++p)
+        crc = i_crc32c_u8(crc, *p);
+    return crc;
+}
+#endif
+
+#if SIMDPP_DETAIL_USE_ARM_CRC32
+static SIMDPP_INL
+uint32_t i_crc_scalar(const crc32_params&, uint32_t crc, const uint8_t* p, std::size_t n)
+{
+    for (; n >= 8; n -= 8, p += 8)
+        crc = __crc32d(crc, i_crc_load_le64(p));
+    for (; n > 0; --n, ++p)
+        crc = __crc32b(crc, *p);
+    return crc;
+}
+#endif
+
+#if SIMDPP_DETAIL_CLMUL_NATIVE
+static SIMDPP_INL uint64_t i_crc_clmul(uint64_t a, uint64_t b, uint64_t& hi)
+{
+    uint64<2> va = make_uint(a, 0);
+    uint64<2> vb = make_uint(b, 0);
+    uint64<2> r = clmul<0,0>(va, vb);
+    hi = extract<1>(r);
+    return extract<0>(r);
+}
+
+// Moves the data in each 128-bit segment of x forward by the distance the
+// constants in k correspond to
+template<unsigned N> SIMDPP_INL
+uint64<N> i_crc_fold(const uint64<N>& x, const uint64<N>& k)
+{
+    return bit_xor(clmul<0,0>(x, k), clmul<1,1>(x, k));
+}
+
+/*  Computes the CRC state from the 128 bits of data x. The data is first
+    reduced to 64+n bits, then to n bits using Barrett reduction.
+*/
+template<class P> SIMDPP_INL
+typename P::type i_crc_reduce(const uint64<2>& x)
+{
+    const unsigned n = P::width;
+    uint64_t lo = extract<0>(x);
+    uint64_t hi = extract<1>(x);
+
+    uint64_t t_lo, t_hi;
+    t_lo = i_crc_clmul(lo, P::reduce(), t_hi);
+    uint64_t a;
+    if (n == 64) {
+        t_lo ^= hi;
+        a = t_lo;
+    } else {
+        // the shift amounts are reduced so that they are valid when n == 64
+        t_lo ^= hi << (64 - n) % 64;
+        t_hi ^= hi >> n % 64;
+        a = (t_lo >> (64 - n) % 64) | (t_hi << n % 64);
+    }
+
+    uint64_t u_hi, r_hi;
+    uint64_t q = a ^ (i_crc_clmul(a, P::mu(), u_hi) << 1);
+    uint64_t r_lo = i_crc_clmul(q, P::poly(), r_hi);
+    uint64_t r = (r_hi << 1) | (r_lo >> 63);
+    uint64_t b = t_hi >> (64 - n);
+    return typename P::type(b ^ (r >> (64 - n)));
+}
+#endif
+
+/*  Updates the CRC state @a crc with the data. The data is folded into four
+    128-bit accumulators, 64 bytes at a time, which are then folded into one
+    and reduced. The rest of the data is processed by i_crc_scalar.
+*/
+template<class P> SIMDPP_INL
+typename P::type i_crc(typename P::type crc, const uint8_t* p, std::size_t n)
+{
+#if SIMDPP_DETAIL_CLMUL_NATIVE
+    if (n >= 64) {
+        uint64<8> k4 = make_uint(P::fold4_lo(), P::fold4_hi());
+        uint64<8> init = make_uint(uint64_t(crc), 0, 0, 0, 0, 0, 0, 0);
+        uint64<8> acc = load_u(p);
+        acc = bit_xor(acc, init);
+        for (p += 64, n -= 64; n >= 64; p += 64, n -= 64) {
+            uint64<8> d = load_u(p);
+            acc = bit_xor(i_crc_fold(acc, k4), d);
+        }
+
+        uint64<2> k1 = make_uint(P::fold1_lo(), P::fold1_hi());
+        uint64<4> h0, h1;
+        uint64<2> x0, x1, x2, x3;
+        split(acc, h0, h1);
+        split(h0, x0, x1);
+        split(h1, x2, x3);
+        uint64<2> x = bit_xor(i_crc_fold(x0, k1), x1);
+        x = bit_xor(i_crc_fold(x, k1), x2);
+        x = bit_xor(i_crc_fold(x, k1), x3);
+        for (; n >= 16; p += 16, n -= 16) {
+            uint64<2> d = load_u(p);
+            x = bit_xor(i_crc_fold(x, k1), d);
+        }
+        crc = i_crc_reduce<P>(x);
+    }
+#endif
+    return i_crc_scalar(P(), crc, p, n);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -13,8 +13,11 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/blend.h>
 #include <simdpp/detail/null/math.h>
 #include <simdpp/detail/not_implemented.h>
+#include <simdpp/detail/vector_array_macros.h>
 
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
@@ -119,6 +122,168 @@ V i_fmadd(const V& a, const V& b, const V& c)
     SIMDPP_VEC_ARRAY_IMPL3(V, i_fmadd, a, b, c);
 }
 
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float32<4> i_fmadd_mask(const float32<4>& a, const float32<4>& b,
+                        const float32<4>& c, const mask_float32<4>& mask,
+                        const float32<4>& src)
+{
+    __m128 r = _mm_maskz_fmadd_ps(mask.native(), a.native(), b.native(), c.native());
+    return _mm_mask_mov_ps(src.native(), mask.native(), r);
+}
+
+static SIMDPP_INL
+float32<8> i_fmadd_mask(const float32<8>& a, const float32<8>& b,
+                        const float32<8>& c, const mask_float32<8>& mask,
+                        const float32<8>& src)
+{
+    __m256 r = _mm256_maskz_fmadd_ps(mask.native(), a.native(), b.native(), c.native());
+    return _mm256_mask_mov_ps(src.native(), mask.native(), r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_fmadd_mask(const float32<16>& a, const float32<16>& b,
+                         const float32<16>& c, const mask_float32<16>& mask,
+                         const float32<16>& src)
+{
+    __m512 r = _mm512_fmadd_ps(a.native(), b.native(), c.native());
+    return _mm512_mask_mov_ps(src.native(), mask.native(), r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_fmadd_mask(const float32<N>& a, const float32<N>& b,
+                        const float32<N>& c, const mask_float32<N>& mask,
+                        const float32<N>& src)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL5(float32<N>, i_fmadd_mask, a, b, c, mask, src)
+#else
+    return blend(i_fmadd(a, b, c), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float32<4> i_fmadd_maskz(const float32<4>& a, const float32<4>& b,
+                         const float32<4>& c, const mask_float32<4>& mask)
+{
+    return _mm_maskz_fmadd_ps(mask.native(), a.native(), b.native(), c.native());
+}
+
+static SIMDPP_INL
+float32<8> i_fmadd_maskz(const float32<8>& a, const float32<8>& b,
+                         const float32<8>& c, const mask_float32<8>& mask)
+{
+    return _mm256_maskz_fmadd_ps(mask.native(), a.native(), b.native(), c.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_fmadd_maskz(const float32<16>& a, const float32<16>& b,
+                          const float32<16>& c, const mask_float32<16>& mask)
+{
+    return _mm512_maskz_fmadd_ps(mask.native(), a.native(), b.native(), c.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_fmadd_maskz(const float32<N>& a, const float32<N>& b,
+                         const float32<N>& c, const mask_float32<N>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(float32<N>, i_fmadd_maskz, a, b, c, mask)
+#else
+    return bit_and(i_fmadd(a, b, c), mask);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float64<2> i_fmadd_mask(const float64<2>& a, const float64<2>& b,
+                        const float64<2>& c, const mask_float64<2>& mask,
+                        const float64<2>& src)
+{
+    __m128d r = _mm_maskz_fmadd_pd(mask.native(), a.native(), b.native(), c.native());
+    return _mm_mask_mov_pd(src.native(), mask.native(), r);
+}
+
+static SIMDPP_INL
+float64<4> i_fmadd_mask(const float64<4>& a, const float64<4>& b,
+                        const float64<4>& c, const mask_float64<4>& mask,
+                        const float64<4>& src)
+{
+    __m256d r = _mm256_maskz_fmadd_pd(mask.native(), a.native(), b.native(), c.native());
+    return _mm256_mask_mov_pd(src.native(), mask.native(), r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_fmadd_mask(const float64<8>& a, const float64<8>& b,
+                        const float64<8>& c, const mask_float64<8>& mask,
+                        const float64<8>& src)
+{
+    __m512d r = _mm512_fmadd_pd(a.native(), b.native(), c.native());
+    return _mm512_mask_mov_pd(src.native(), mask.native(), r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_fmadd_mask(const float64<N>& a, const float64<N>& b,
+                        const float64<N>& c, const mask_float64<N>& mask,
+                        const float64<N>& src)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL5(float64<N>, i_fmadd_mask, a, b, c, mask, src)
+#else
+    return blend(i_fmadd(a, b, c), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float64<2> i_fmadd_maskz(const float64<2>& a, const float64<2>& b,
+                         const float64<2>& c, const mask_float64<2>& mask)
+{
+    return _mm_maskz_fmadd_pd(mask.native(), a.native(), b.native(), c.native());
+}
+
+static SIMDPP_INL
+float64<4> i_fmadd_maskz(const float64<4>& a, const float64<4>& b,
+                         const float64<4>& c, const mask_float64<4>& mask)
+{
+    return _mm256_maskz_fmadd_pd(mask.native(), a.native(), b.native(), c.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_fmadd_maskz(const float64<8>& a, const float64<8>& b,
+                         const float64<8>& c, const mask_float64<8>& mask)
+{
+    return _mm512_maskz_fmadd_pd(mask.native(), a.native(), b.native(), c.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_fmadd_maskz(const float64<N>& a, const float64<N>& b,
+                         const float64<N>& c, const mask_float64<N>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(float64<N>, i_fmadd_maskz, a, b, c, mask)
+#else
+    return bit_and(i_fmadd(a, b, c), mask);
+#endif
+}
+
 } // namespace insn
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -13,6 +13,8 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/blend.h>
 #include <simdpp/detail/null/math.h>
 #include <simdpp/detail/vector_array_macros.h>
 
@@ -100,6 +102,154 @@ float64<N> i_max(const float64<N>& a, const float64<N>& b)
     SIMDPP_VEC_ARRAY_IMPL2(float64<N>, i_max, a, b);
 }
 
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float32<4> i_max_mask(const float32<4>& a, const float32<4>& b,
+                      const mask_float32<4>& mask, const float32<4>& src)
+{
+    return _mm_mask_max_ps(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+float32<8> i_max_mask(const float32<8>& a, const float32<8>& b,
+                      const mask_float32<8>& mask, const float32<8>& src)
+{
+    return _mm256_mask_max_ps(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_max_mask(const float32<16>& a, const float32<16>& b,
+                       const mask_float32<16>& mask, const float32<16>& src)
+{
+    return _mm512_mask_max_ps(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_max_mask(const float32<N>& a, const float32<N>& b,
+                      const mask_float32<N>& mask, const float32<N>& src)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(float32<N>, i_max_mask, a, b, mask, src)
+#else
+    return blend(i_max(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float32<4> i_max_maskz(const float32<4>& a, const float32<4>& b,
+                       const mask_float32<4>& mask)
+{
+    return _mm_maskz_max_ps(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+float32<8> i_max_maskz(const float32<8>& a, const float32<8>& b,
+                       const mask_float32<8>& mask)
+{
+    return _mm256_maskz_max_ps(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_max_maskz(const float32<16>& a, const float32<16>& b,
+                        const mask_float32<16>& mask)
+{
+    return _mm512_maskz_max_ps(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_max_maskz(const float32<N>& a, const float32<N>& b,
+                       const mask_float32<N>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(float32<N>, i_max_maskz, a, b, mask)
+#else
+    return bit_and(i_max(a, b), mask);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float64<2> i_max_mask(const float64<2>& a, const float64<2>& b,
+                      const mask_float64<2>& mask, const float64<2>& src)
+{
+    return _mm_mask_max_pd(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+float64<4> i_max_mask(const float64<4>& a, const float64<4>& b,
+                      const mask_float64<4>& mask, const float64<4>& src)
+{
+    return _mm256_mask_max_pd(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_max_mask(const float64<8>& a, const float64<8>& b,
+                      const mask_float64<8>& mask, const float64<8>& src)
+{
+    return _mm512_mask_max_pd(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_max_mask(const float64<N>& a, const float64<N>& b,
+                      const mask_float64<N>& mask, const float64<N>& src)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(float64<N>, i_max_mask, a, b, mask, src)
+#else
+    return blend(i_max(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+float64<2> i_max_maskz(const float64<2>& a, const float64<2>& b,
+                       const mask_float64<2>& mask)
+{
+    return _mm_maskz_max_pd(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+float64<4> i_max_maskz(const float64<4>& a, const float64<4>& b,
+                       const mask_float64<4>& mask)
+{
+    return _mm256_maskz_max_pd(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_max_maskz(const float64<8>& a, const float64<8>& b,
+                       const mask_float64<8>& mask)
+{
+    return _mm512_maskz_max_pd(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_max_maskz(const float64<N>& a, const float64<N>& b,
+                       const mask_float64<N>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(float64<N>, i_max_maskz, a, b, mask)
+#else
+    return bit_and(i_max(a, b), mask);
+#endif
+}
+
 } // namespace insn
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,437 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Loads the elements one by one. The indices are interpreted as signed
+    values so that the results match the hardware gather instructions.
+*/
+template<class V, class I> SIMDPP_INL
+void i_gather_emul(V& a, const char* base, const I& idx)
+{
+    using T = typename V::element_type;
+    using S = typename std::make_signed<typename I::element_type>::type;
+
+    mem_block<I> mi = idx;
+    mem_block<V> r;
+    const T* pt = reinterpret_cast<const T*>(base);
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = pt[static_cast<S>(mi[i])];
+    }
+    a = r;
+}
+
+/*  Loads the elements selected by the mask one by one. The elements that are
+    not selected are set to zero and the memory they point to is not accessed.
+*/
+template<class V, class I, class M> SIMDPP_INL
+void i_gather_masked_emul(V& a, const char* base, const I& idx, const M& mask)
+{
+    using T = typename V::element_type;
+    using U = typename V::uint_vector_type;
+    using S = typename std::make_signed<typename I::element_type>::type;
+
+    mem_block<I> mi = idx;
+    mem_block<U> m = bit_cast<U>(mask.unmask());
+    mem_block<V> r;
+    const T* pt = reinterpret_cast<const T*>(base);
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = m[i] ? pt[static_cast<S>(mi[i])] : T(0);
+    }
+    a = r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(uint32<4>& a, const char* base, const uint32<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm_i32gather_epi32(reinterpret_cast<const int*>(base), idx.native(), 4);
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather(uint32<8>& a, const char* base, const uint32<8>& idx)
+{
+    a = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx.native(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(uint32<16>& a, const char* base, const uint32<16>& idx)
+{
+    a = _mm512_i32gather_epi32(idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(uint64<2>& a, const char* base, const uint64<2>& idx)
+{
+#if SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    a = _mm_i64gather_epi64(reinterpret_cast<const __int64*>(base), idx.native(), 8);
+#else
+    a = _mm_i64gather_epi64(reinterpret_cast<const long long*>(base), idx.native(), 8);
+#endif
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather(uint64<4>& a, const char* base, const uint64<4>& idx)
+{
+#if __INTEL_COMPILER
+    a = _mm256_i64gather_epi64(reinterpret_cast<const __int64*>(base), idx.native(), 8);
+#else
+    a = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(base), idx.native(), 8);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(uint64<8>& a, const char* base, const uint64<8>& idx)
+{
+    a = _mm512_i64gather_epi64(idx.native(), base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(float32<4>& a, const char* base, const uint32<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm_i32gather_ps(reinterpret_cast<const float*>(base), idx.native(), 4);
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather(float32<8>& a, const char* base, const uint32<8>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm256_i32gather_ps(reinterpret_cast<const float*>(base), idx.native(), 4);
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(float32<16>& a, const char* base, const uint32<16>& idx)
+{
+    a = _mm512_i32gather_ps(idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(float64<2>& a, const char* base, const uint64<2>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm_i64gather_pd(reinterpret_cast<const double*>(base), idx.native(), 8);
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather(float64<4>& a, const char* base, const uint64<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm256_i64gather_pd(reinterpret_cast<const double*>(base), idx.native(), 8);
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(float64<8>& a, const char* base, const uint64<8>& idx)
+{
+    a = _mm512_i64gather_pd(idx.native(), base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class I> SIMDPP_INL
+void i_gather_vec(V& a, const char* base, const I& idx, std::true_type)
+{
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_gather(a.vec(i), base, idx.vec(i));
+    }
+}
+
+// On AVX floating-point vectors are wider than integer vectors
+template<class V, class I> SIMDPP_INL
+void i_gather_vec(V& a, const char* base, const I& idx, std::false_type)
+{
+    i_gather_emul(a, base, idx);
+}
+
+template<class V, class I> SIMDPP_INL
+void i_gather(V& a, const char* base, const I& idx)
+{
+    i_gather_vec(a, base, idx, std::integral_constant<bool,
+                 V::vec_length == I::vec_length>());
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(uint32<4>& a, const char* base,
+                     const uint32<4>& idx, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_mmask_i32gather_epi32(_mm_setzero_si128(), mask.native(),
+                                  idx.native(), base, 4);
+#elif SIMDPP_USE_AVX2
+    a = _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                 reinterpret_cast<const int*>(base),
+                                 idx.native(), mask.native(), 4);
+#else
+    i_gather_masked_emul(a, base, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather_masked(uint32<8>& a, const char* base,
+                     const uint32<8>& idx, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(), mask.native(),
+                                     idx.native(), base, 4);
+#else
+    a = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                    reinterpret_cast<const int*>(base),
+                                    idx.native(), mask.native(), 4);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(uint32<16>& a, const char* base,
+                     const uint32<16>& idx, const mask_int32<16>& mask)
+{
+    a = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask.native(),
+                                    idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(uint64<2>& a, const char* base,
+                     const uint64<2>& idx, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_mmask_i64gather_epi64(_mm_setzero_si128(), mask.native(),
+                                  idx.native(), base, 8);
+#elif SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    a = _mm_mask_i64gather_epi64(_mm_setzero_si128(),
+                                 reinterpret_cast<const __int64*>(base),
+                                 idx.native(), mask.native(), 8);
+#else
+    a = _mm_mask_i64gather_epi64(_mm_setzero_si128(),
+                                 reinterpret_cast<const long long*>(base),
+                                 idx.native(), mask.native(), 8);
+#endif
+#else
+    i_gather_masked_emul(a, base, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather_masked(uint64<4>& a, const char* base,
+                     const uint64<4>& idx, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_mmask_i64gather_epi64(_mm256_setzero_si256(), mask.native(),
+                                     idx.native(), base, 8);
+#else
+#if __INTEL_COMPILER
+    a = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const __int64*>(base),
+                                    idx.native(), mask.native(), 8);
+#else
+    a = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const long long*>(base),
+                                    idx.native(), mask.native(), 8);
+#endif
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(uint64<8>& a, const char* base,
+                     const uint64<8>& idx, const mask_int64<8>& mask)
+{
+    a = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask.native(),
+                                    idx.native(), base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(float32<4>& a, const char* base,
+                     const uint32<4>& idx, const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_mmask_i32gather_ps(_mm_setzero_ps(), mask.native(),
+                               idx.native(), base, 4);
+#elif SIMDPP_USE_AVX2
+    a = _mm_mask_i32gather_ps(_mm_setzero_ps(),
+                              reinterpret_cast<const float*>(base),
+                              idx.native(), mask.native(), 4);
+#else
+    i_gather_masked_emul(a, base, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather_masked(float32<8>& a, const char* base,
+                     const uint32<8>& idx, const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_mmask_i32gather_ps(_mm256_setzero_ps(), mask.native(),
+                                  idx.native(), base, 4);
+#elif SIMDPP_USE_AVX2
+    a = _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                 reinterpret_cast<const float*>(base),
+                                 idx.native(), mask.native(), 4);
+#else
+    i_gather_masked_emul(a, base, idx, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(float32<16>& a, const char* base,
+                     const uint32<16>& idx, const mask_float32<16>& mask)
+{
+    a = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask.native(),
+                                 idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(float64<2>& a, const char* base,
+                     const uint64<2>& idx, const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_mmask_i64gather_pd(_mm_setzero_pd(), mask.native(),
+                               idx.native(), base, 8);
+#elif SIMDPP_USE_AVX2
+    a = _mm_mask_i64gather_pd(_mm_setzero_pd(),
+                              reinterpret_cast<const double*>(base),
+                              idx.native(), mask.native(), 8);
+#else
+    i_gather_masked_emul(a, base, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather_masked(float64<4>& a, const char* base,
+                     const uint64<4>& idx, const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_mmask_i64gather_pd(_mm256_setzero_pd(), mask.native(),
+                                  idx.native(), base, 8);
+#elif SIMDPP_USE_AVX2
+    a = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
+                                 reinterpret_cast<const double*>(base),
+                                 idx.native(), mask.native(), 8);
+#else
+    i_gather_masked_emul(a, base, idx, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(float64<8>& a, const char* base,
+                     const uint64<8>& idx, const mask_float64<8>& mask)
+{
+    a = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask.native(),
+                                 idx.native(), base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class I, class M> SIMDPP_INL
+void i_gather_masked_vec(V& a, const char* base, const I& idx, const M& mask,
+                         std::true_type)
+{
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_gather_masked(a.vec(i), base, idx.vec(i), mask.vec(i));
+    }
+}
+
+template<class V, class I, class M> SIMDPP_INL
+void i_gather_masked_vec(V& a, const char* base, const I& idx, const M& mask,
+                         std::false_type)
+{
+    i_gather_masked_emul(a, base, idx, mask);
+}
+
+template<class V, class I, class M> SIMDPP_INL
+void i_gather_masked(V& a, const char* base, const I& idx, const M& mask)
+{
+    i_gather_masked_vec(a, base, idx, mask, std::integral_constant<bool,
+                        V::vec_length == I::vec_length>());
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
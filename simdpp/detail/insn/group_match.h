@@ -0,0 +1,117 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_GROUP_MATCH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_GROUP_MATCH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/detail/insn/byte_search.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+static const uint8_t group_ctrl_empty_value = 0x80;
+static const uint8_t group_ctrl_deleted_value = 0xfe;
+static const uint8_t group_ctrl_sentinel_value = 0xff;
+
+/*  The match bit masks contain 1 << slot_shift bits per control byte, of
+    which only the lowest one may be set. One bit per byte is used everywhere
+    except on NEON, which lacks a movemask instruction. There a 16-byte mask
+    is narrowed to 4 bits per byte with a single shift-narrow instruction,
+    which is much cheaper than collecting one bit per byte.
+*/
+template<unsigned N>
+struct group_mask_shift {
+#if SIMDPP_USE_NEON
+    static const unsigned value = N == 16 ? 2 : 0;
+#else
+    static const unsigned value = 0;
+#endif
+};
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_group_bits(const mask_int8<N>& m)
+{
+    const unsigned vec_length = mask_int8<N>::vec_length;
+    const unsigned vec_bytes = N / vec_length;
+    uint64_t r = 0;
+    for (unsigned i = 0; i < vec_length; ++i) {
+        r |= i_mask_bits(m.vec(i)) << (i * vec_bytes);
+    }
+    return r;
+}
+
+#if SIMDPP_USE_NEON
+static SIMDPP_INL
+uint64_t i_group_bits(const mask_int8<16>& m)
+{
+    uint8<16> a = m.unmask();
+    uint8x8_t n = vshrn_n_u16(vreinterpretq_u16_u8(a.native()), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(n), 0) & 0x1111111111111111;
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_group_match(const uint8<N>& ctrl, uint8_t tag)
+{
+    mask_int8<N> m = cmp_eq(ctrl, uint8<N>(splat(tag)));
+    return i_group_bits(m);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_group_match_empty_or_deleted(const uint8<N>& ctrl)
+{
+    // Empty and deleted are the only control bytes that are less than the
+    // sentinel when compared as signed values
+    mask_int8<N> m = cmp_lt(int8<N>(ctrl), int8_t(group_ctrl_sentinel_value));
+    return i_group_bits(m);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_group_match_full(const uint8<N>& ctrl)
+{
+    // Full slots are the only ones with the highest bit cleared
+    mask_int8<N> m = cmp_gt(int8<N>(ctrl), int8_t(-1));
+    return i_group_bits(m);
+}
+
+static SIMDPP_INL
+unsigned i_group_ctz(uint64_t bits)
+{
+    return i_byte_search_ctz(bits);
+}
+
+static SIMDPP_INL
+unsigned i_group_msb(uint64_t bits)
+{
+    return i_byte_search_msb(bits);
+}
+
+static SIMDPP_INL
+unsigned i_group_popcnt(uint64_t bits)
+{
+    return i_compress_popcnt(bits);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
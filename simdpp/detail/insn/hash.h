@@ -0,0 +1,204 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_HASH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_HASH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_rotate.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/store_u.h>
+
+// Whether 64-bit multiplication is done by a single instruction. Otherwise
+// it's emulated using three 32-bit multiplications and the vectorized 64-bit
+// hashes are slower than scalar code.
+#define SIMDPP_DETAIL_MUL_LO64_NATIVE (SIMDPP_USE_AVX512DQ || SIMDPP_USE_MSA)
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Each of the hash operations below provides a vector version and a scalar
+    version that computes exactly the same function. The latter is used for
+    the tails of arrays.
+*/
+
+// MurmurHash3 32-bit finalizer
+struct hash_fmix32_op {
+    using element_type = uint32_t;
+
+    template<class V> static SIMDPP_INL
+    V vec(V h, uint32_t)
+    {
+        h = bit_xor(h, shift_r<16>(h));
+        h = mul_lo(h, 0x85ebca6bu);
+        h = bit_xor(h, shift_r<13>(h));
+        h = mul_lo(h, 0xc2b2ae35u);
+        h = bit_xor(h, shift_r<16>(h));
+        return h;
+    }
+
+    static SIMDPP_INL uint32_t el(uint32_t h, uint32_t)
+    {
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+        return h;
+    }
+};
+
+// MurmurHash3 64-bit finalizer
+struct hash_fmix64_op {
+    using element_type = uint64_t;
+
+    template<class V> static SIMDPP_INL
+    V vec(V h, uint64_t)
+    {
+        h = bit_xor(h, shift_r<33>(h));
+        h = mul_lo(h, 0xff51afd7ed558ccdull);
+        h = bit_xor(h, shift_r<33>(h));
+        h = mul_lo(h, 0xc4ceb9fe1a85ec53ull);
+        h = bit_xor(h, shift_r<33>(h));
+        return h;
+    }
+
+    static SIMDPP_INL uint64_t el(uint64_t h, uint64_t)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+};
+
+static const uint32_t xxh32_p2 = 0x85ebca77u;
+static const uint32_t xxh32_p3 = 0xc2b2ae3du;
+static const uint32_t xxh32_p4 = 0x27d4eb2fu;
+static const uint32_t xxh32_p5 = 0x165667b1u;
+
+/*  XXH32 of a 4-byte input. Only the steps that are reached for inputs of that
+    length are performed:
+
+    h = seed + P5 + 4
+    h = rotl(h + key * P3, 17) * P4
+    avalanche(h)
+*/
+struct hash_xxh32_op {
+    using element_type = uint32_t;
+
+    template<class V> static SIMDPP_INL
+    V vec(const V& key, uint32_t seed)
+    {
+        V h = add(mul_lo(key, xxh32_p3), seed + xxh32_p5 + 4);
+        h = mul_lo(rotate_l<17>(h), xxh32_p4);
+        h = bit_xor(h, shift_r<15>(h));
+        h = mul_lo(h, xxh32_p2);
+        h = bit_xor(h, shift_r<13>(h));
+        h = mul_lo(h, xxh32_p3);
+        h = bit_xor(h, shift_r<16>(h));
+        return h;
+    }
+
+    static SIMDPP_INL uint32_t el(uint32_t key, uint32_t seed)
+    {
+        uint32_t h = seed + xxh32_p5 + 4 + key * xxh32_p3;
+        h = ((h << 17) | (h >> 15)) * xxh32_p4;
+        h ^= h >> 15;
+        h *= xxh32_p2;
+        h ^= h >> 13;
+        h *= xxh32_p3;
+        h ^= h >> 16;
+        return h;
+    }
+};
+
+static const uint64_t xxh64_p1 = 0x9e3779b185ebca87ull;
+static const uint64_t xxh64_p2 = 0xc2b2ae3d27d4eb4full;
+static const uint64_t xxh64_p3 = 0x165667b19e3779f9ull;
+static const uint64_t xxh64_p4 = 0x85ebca77c2b2ae63ull;
+static const uint64_t xxh64_p5 = 0x27d4eb2f165667c5ull;
+
+/*  XXH64 of an 8-byte input:
+
+    k = rotl(key * P2, 31) * P1
+    h = seed + P5 + 8
+    h = rotl(h ^ k, 27) * P1 + P4
+    avalanche(h)
+*/
+struct hash_xxh64_op {
+    using element_type = uint64_t;
+
+    template<class V> static SIMDPP_INL
+    V vec(const V& key, uint64_t seed)
+    {
+        V k = mul_lo(key, xxh64_p2);
+        k = mul_lo(rotate_l<31>(k), xxh64_p1);
+        V h = bit_xor(k, seed + xxh64_p5 + 8);
+        h = add(mul_lo(rotate_l<27>(h), xxh64_p1), xxh64_p4);
+        h = bit_xor(h, shift_r<33>(h));
+        h = mul_lo(h, xxh64_p2);
+        h = bit_xor(h, shift_r<29>(h));
+        h = mul_lo(h, xxh64_p3);
+        h = bit_xor(h, shift_r<32>(h));
+        return h;
+    }
+
+    static SIMDPP_INL uint64_t el(uint64_t key, uint64_t seed)
+    {
+        uint64_t k = key * xxh64_p2;
+        k = ((k << 31) | (k >> 33)) * xxh64_p1;
+        uint64_t h = (seed + xxh64_p5 + 8) ^ k;
+        h = ((h << 27) | (h >> 37)) * xxh64_p1 + xxh64_p4;
+        h ^= h >> 33;
+        h *= xxh64_p2;
+        h ^= h >> 29;
+        h *= xxh64_p3;
+        h ^= h >> 32;
+        return h;
+    }
+};
+
+/*  Hashes an array of keys. Whole vectors are processed in the main loop, the
+    remaining keys are hashed one by one. 64-bit keys are hashed one by one
+    unless 64-bit multiplication is native. @a out may alias @a keys.
+*/
+template<class V, class Op, class T> SIMDPP_INL
+void i_hash_array(T* out, const T* keys, std::size_t n, T seed)
+{
+    const unsigned W = V::length;
+    const bool use_vec = sizeof(T) == 4 || SIMDPP_DETAIL_MUL_LO64_NATIVE;
+    std::size_t i = 0;
+    for (; use_vec && i + W <= n; i += W) {
+        V k = load_u(keys + i);
+        store_u(out + i, Op::vec(k, seed));
+    }
+    for (; i < n; ++i) {
+        out[i] = Op::el(keys[i], seed);
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
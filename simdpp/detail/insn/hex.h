@@ -0,0 +1,171 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_HEX_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_HEX_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_not.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/core/to_int8.h>
+#include <simdpp/core/zip_hi.h>
+#include <simdpp/core/zip_lo.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+static const std::size_t hex_invalid_result = ~std::size_t(0);
+
+template<bool Upper> SIMDPP_INL
+char i_hex_char(unsigned v)
+{
+    return char(v < 10 ? '0' + v : (Upper ? 'A' : 'a') + v - 10);
+}
+
+// Returns the value of a hex digit of either case or -1 if it's not one
+static SIMDPP_INL int i_hex_value(unsigned char c)
+{
+    if (unsigned(c - '0') < 10) return c - '0';
+    unsigned l = unsigned((c | 0x20) - 'a');
+    return l < 6 ? int(l + 10) : -1;
+}
+
+// Converts the nibbles in each element to hex digits
+template<bool Upper, unsigned N> SIMDPP_INL
+uint8<N> i_hex_digits(const uint8<N>& nib)
+{
+    uint8<N> letter = bit_and(uint8<N>(cmp_gt(nib, 9)), Upper ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    return add(add(nib, '0'), letter);
+}
+
+/*  zip16_lo() and zip16_hi() interleave the elements within each 128-bit
+    lane, so the result lanes are stored alternating between the two vectors.
+*/
+static SIMDPP_INL
+void i_hex_store_zipped(uint8_t* p, const uint8<16>& lo, const uint8<16>& hi)
+{
+    store_u(p, lo);
+    store_u(p + 16, hi);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_hex_store_zipped(uint8_t* p, const uint8<N>& lo, const uint8<N>& hi)
+{
+    uint8<N/2> lo0, lo1, hi0, hi1;
+    split(lo, lo0, lo1);
+    split(hi, hi0, hi1);
+    i_hex_store_zipped(p, lo0, hi0);
+    i_hex_store_zipped(p + N, lo1, hi1);
+}
+
+template<bool Upper> SIMDPP_INL
+std::size_t i_hex_encode(const uint8_t* p, std::size_t n, char* out)
+{
+    using V = uint8v;
+    const std::size_t N = V::length;
+    uint8_t* uout = reinterpret_cast<uint8_t*>(out);
+    std::size_t i = 0;
+    for (; i + N <= n; i += N) {
+        V in = load_u(p + i);
+        V hi = i_hex_digits<Upper>(V(shift_r<4>(in)));
+        V lo = i_hex_digits<Upper>(V(bit_and(in, 0x0f)));
+        i_hex_store_zipped(uout + 2 * i, V(zip16_lo(hi, lo)), V(zip16_hi(hi, lo)));
+    }
+    for (; i < n; ++i) {
+        out[2*i] = i_hex_char<Upper>(p[i] >> 4);
+        out[2*i+1] = i_hex_char<Upper>(p[i] & 0x0f);
+    }
+    return 2 * n;
+}
+
+/*  Converts the hex digits in each element to their values. The elements that
+    are not hex digits are set in @a err.
+*/
+template<unsigned N> SIMDPP_INL
+uint8<N> i_hex_values(const uint8<N>& c, uint8<N>& err)
+{
+    uint8<N> digit = sub(c, '0');
+    uint8<N> letter = sub(bit_or(c, 0x20), 'a');
+    mask_int8<N> is_digit = cmp_lt(digit, 10);
+    mask_int8<N> is_letter = cmp_lt(letter, 6);
+    err = bit_or(err, bit_not(uint8<N>(bit_or(is_digit, is_letter))));
+    return blend(digit, add(letter, 10), is_digit);
+}
+
+/*  Merges the pairs of values in each 16-bit element into a byte in the low
+    half of the element. The first value of each pair is the high nibble.
+*/
+template<unsigned N> SIMDPP_INL
+uint16<N> i_hex_merge(const uint16<N>& a)
+{
+#if SIMDPP_BIG_ENDIAN
+    return bit_or(shift_r<4>(a), bit_and(a, 0x0f));
+#else
+    return bit_or(shift_l<4>(bit_and(a, 0x0f)), shift_r<8>(a));
+#endif
+}
+
+static SIMDPP_INL
+std::size_t i_hex_decode(const char* s, std::size_t n, uint8_t* out)
+{
+    if (n % 2 != 0)
+        return hex_invalid_result;
+
+    using V = uint8v;
+    using U16 = uint16<V::length / 2>;
+    const std::size_t N = V::length;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+    std::size_t i = 0;
+    V err = make_zero();
+    for (; i + 2 * N <= n; i += 2 * N) {
+        V a = load_u(p + i);
+        V b = load_u(p + i + N);
+        U16 ma = i_hex_merge(U16(i_hex_values(a, err)));
+        U16 mb = i_hex_merge(U16(i_hex_values(b, err)));
+        store_u(out + i / 2, to_uint8(combine(ma, mb)));
+    }
+    if (test_bits_any(err))
+        return hex_invalid_result;
+
+    for (; i < n; i += 2) {
+        int hi = i_hex_value(p[i]);
+        int lo = i_hex_value(p[i+1]);
+        if ((hi | lo) < 0)
+            return hex_invalid_result;
+        out[i / 2] = uint8_t((hi << 4) | lo);
+    }
+    return n / 2;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -13,6 +13,7 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/blend.h>
 #include <simdpp/core/bit_and.h>
 #include <simdpp/detail/null/math.h>
 #include <simdpp/detail/vector_array_macros.h>
@@ -164,6 +165,302 @@ V i_iadd(const V& a, const V& b)
     SIMDPP_VEC_ARRAY_IMPL2(V, i_iadd, a, b)
 }
 
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint8<16> i_iadd_mask(const uint8<16>& a, const uint8<16>& b,
+                      const mask_int8<16>& mask, const uint8<16>& src)
+{
+    return _mm_mask_add_epi8(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint8<32> i_iadd_mask(const uint8<32>& a, const uint8<32>& b,
+                      const mask_int8<32>& mask, const uint8<32>& src)
+{
+    return _mm256_mask_add_epi8(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_iadd_mask(const uint8<64>& a, const uint8<64>& b,
+                      const mask_int8<64>& mask, const uint8<64>& src)
+{
+    return _mm512_mask_add_epi8(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_iadd_mask(const uint8<N>& a, const uint8<N>& b,
+                     const mask_int8<N>& mask, const uint8<N>& src)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(uint8<N>, i_iadd_mask, a, b, mask, src)
+#else
+    return blend(i_iadd(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint8<16> i_iadd_maskz(const uint8<16>& a, const uint8<16>& b,
+                       const mask_int8<16>& mask)
+{
+    return _mm_maskz_add_epi8(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint8<32> i_iadd_maskz(const uint8<32>& a, const uint8<32>& b,
+                       const mask_int8<32>& mask)
+{
+    return _mm256_maskz_add_epi8(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_iadd_maskz(const uint8<64>& a, const uint8<64>& b,
+                       const mask_int8<64>& mask)
+{
+    return _mm512_maskz_add_epi8(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_iadd_maskz(const uint8<N>& a, const uint8<N>& b,
+                      const mask_int8<N>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(uint8<N>, i_iadd_maskz, a, b, mask)
+#else
+    return bit_and(i_iadd(a, b), mask);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint16<8> i_iadd_mask(const uint16<8>& a, const uint16<8>& b,
+                      const mask_int16<8>& mask, const uint16<8>& src)
+{
+    return _mm_mask_add_epi16(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_iadd_mask(const uint16<16>& a, const uint16<16>& b,
+                       const mask_int16<16>& mask, const uint16<16>& src)
+{
+    return _mm256_mask_add_epi16(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_iadd_mask(const uint16<32>& a, const uint16<32>& b,
+                       const mask_int16<32>& mask, const uint16<32>& src)
+{
+    return _mm512_mask_add_epi16(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_iadd_mask(const uint16<N>& a, const uint16<N>& b,
+                      const mask_int16<N>& mask, const uint16<N>& src)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(uint16<N>, i_iadd_mask, a, b, mask, src)
+#else
+    return blend(i_iadd(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint16<8> i_iadd_maskz(const uint16<8>& a, const uint16<8>& b,
+                       const mask_int16<8>& mask)
+{
+    return _mm_maskz_add_epi16(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_iadd_maskz(const uint16<16>& a, const uint16<16>& b,
+                        const mask_int16<16>& mask)
+{
+    return _mm256_maskz_add_epi16(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_iadd_maskz(const uint16<32>& a, const uint16<32>& b,
+                        const mask_int16<32>& mask)
+{
+    return _mm512_maskz_add_epi16(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_iadd_maskz(const uint16<N>& a, const uint16<N>& b,
+                       const mask_int16<N>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(uint16<N>, i_iadd_maskz, a, b, mask)
+#else
+    return bit_and(i_iadd(a, b), mask);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint32<4> i_iadd_mask(const uint32<4>& a, const uint32<4>& b,
+                      const mask_int32<4>& mask, const uint32<4>& src)
+{
+    return _mm_mask_add_epi32(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint32<8> i_iadd_mask(const uint32<8>& a, const uint32<8>& b,
+                      const mask_int32<8>& mask, const uint32<8>& src)
+{
+    return _mm256_mask_add_epi32(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_iadd_mask(const uint32<16>& a, const uint32<16>& b,
+                       const mask_int32<16>& mask, const uint32<16>& src)
+{
+    return _mm512_mask_add_epi32(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_iadd_mask(const uint32<N>& a, const uint32<N>& b,
+                      const mask_int32<N>& mask, const uint32<N>& src)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(uint32<N>, i_iadd_mask, a, b, mask, src)
+#else
+    return blend(i_iadd(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint32<4> i_iadd_maskz(const uint32<4>& a, const uint32<4>& b,
+                       const mask_int32<4>& mask)
+{
+    return _mm_maskz_add_epi32(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint32<8> i_iadd_maskz(const uint32<8>& a, const uint32<8>& b,
+                       const mask_int32<8>& mask)
+{
+    return _mm256_maskz_add_epi32(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_iadd_maskz(const uint32<16>& a, const uint32<16>& b,
+                        const mask_int32<16>& mask)
+{
+    return _mm512_maskz_add_epi32(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_iadd_maskz(const uint32<N>& a, const uint32<N>& b,
+                       const mask_int32<N>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(uint32<N>, i_iadd_maskz, a, b, mask)
+#else
+    return bit_and(i_iadd(a, b), mask);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint64<2> i_iadd_mask(const uint64<2>& a, const uint64<2>& b,
+                      const mask_int64<2>& mask, const uint64<2>& src)
+{
+    return _mm_mask_add_epi64(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint64<4> i_iadd_mask(const uint64<4>& a, const uint64<4>& b,
+                      const mask_int64<4>& mask, const uint64<4>& src)
+{
+    return _mm256_mask_add_epi64(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_iadd_mask(const uint64<8>& a, const uint64<8>& b,
+                      const mask_int64<8>& mask, const uint64<8>& src)
+{
+    return _mm512_mask_add_epi64(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_iadd_mask(const uint64<N>& a, const uint64<N>& b,
+                      const mask_int64<N>& mask, const uint64<N>& src)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(uint64<N>, i_iadd_mask, a, b, mask, src)
+#else
+    return blend(i_iadd(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint64<2> i_iadd_maskz(const uint64<2>& a, const uint64<2>& b,
+                       const mask_int64<2>& mask)
+{
+    return _mm_maskz_add_epi64(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint64<4> i_iadd_maskz(const uint64<4>& a, const uint64<4>& b,
+                       const mask_int64<4>& mask)
+{
+    return _mm256_maskz_add_epi64(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_iadd_maskz(const uint64<8>& a, const uint64<8>& b,
+                       const mask_int64<8>& mask)
+{
+    return _mm512_maskz_add_epi64(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_iadd_maskz(const uint64<N>& a, const uint64<N>& b,
+                       const mask_int64<N>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(uint64<N>, i_iadd_maskz, a, b, mask)
+#else
+    return bit_and(i_iadd(a, b), mask);
+#endif
+}
+
 } // namespace insn
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
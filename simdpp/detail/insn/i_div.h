@@ -0,0 +1,248 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_mull.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/unzip_hi.h>
+#include <simdpp/core/unzip_lo.h>
+#include <simdpp/detail/traits.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Multiplies the low 32 bits of each 64-bit element and returns the full
+    64-bit products. This maps to a single instruction on SSE2, AVX2, AVX-512
+    and NEON and is the building block of the 32 and 64-bit multiply-high
+    operations below.
+*/
+static SIMDPP_INL
+uint64<2> i_mul_lo32(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    r.el(0) = (a.el(0) & 0xffffffff) * (b.el(0) & 0xffffffff);
+    r.el(1) = (a.el(1) & 0xffffffff) * (b.el(1) & 0xffffffff);
+    return r;
+#elif SIMDPP_USE_SSE2
+    return _mm_mul_epu32(a.native(), b.native());
+#elif SIMDPP_USE_NEON
+    return vmull_u32(vmovn_u64(a.native()), vmovn_u64(b.native()));
+#else
+    uint64<4> p = mull(uint32<4>(a), uint32<4>(b));
+    uint64<2> p0, p1;
+    split(p, p0, p1);
+#if SIMDPP_BIG_ENDIAN
+    return unzip2_hi(p0, p1);
+#else
+    return unzip2_lo(p0, p1);
+#endif
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_lo32(const uint64<4>& a, const uint64<4>& b)
+{
+    return _mm256_mul_epu32(a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_lo32(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_mul_epu32(a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_mul_lo32(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, i_mul_lo32, a, b)
+}
+
+// -----------------------------------------------------------------------------
+// Unsigned multiply-high. Signed variants are derived by subtracting
+// (a < 0 ? b : 0) + (b < 0 ? a : 0) from the unsigned result.
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_div_mul_hi(const uint16<N>& a, const uint16<N>& b)
+{
+    return mul_hi(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_div_mul_hi(const uint32<N>& a, const uint32<N>& b)
+{
+    using U = uint64<N/2>;
+    U a64 = U(a), b64 = U(b);
+    U even = i_mul_lo32(a64, b64);
+    U odd = i_mul_lo32(U(shift_r<32>(a64)), U(shift_r<32>(b64)));
+    U r = bit_or(shift_r<32>(even), bit_and(odd, 0xffffffff00000000));
+    return uint32<N>(r);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_div_mul_hi(const uint64<N>& a, const uint64<N>& b)
+{
+    using U = uint64<N>;
+    U ah = shift_r<32>(a);
+    U bh = shift_r<32>(b);
+    U p00 = i_mul_lo32(a, b);
+    U p01 = i_mul_lo32(a, bh);
+    U p10 = i_mul_lo32(ah, b);
+    U p11 = i_mul_lo32(ah, bh);
+
+    U mid = shift_r<32>(p00);
+    mid = add(mid, bit_and(p01, 0xffffffff));
+    mid = add(mid, bit_and(p10, 0xffffffff));
+    U r = add(p11, shift_r<32>(p01));
+    r = add(r, shift_r<32>(p10));
+    return add(r, shift_r<32>(mid));
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_div_mul_lo(const uint16<N>& a, const uint16<N>& b)
+{
+    return mul_lo(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_div_mul_lo(const uint32<N>& a, const uint32<N>& b)
+{
+    return mul_lo(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_div_mul_lo(const uint64<N>& a, const uint64<N>& b)
+{
+    using U = uint64<N>;
+    U cross = add(i_mul_lo32(a, U(shift_r<32>(b))),
+                  i_mul_lo32(U(shift_r<32>(a)), b));
+    return add(i_mul_lo32(a, b), shift_l<32>(cross));
+}
+
+// -----------------------------------------------------------------------------
+
+template<class V, class D> SIMDPP_INL
+V i_div_unsigned(const V& a, const D& d)
+{
+    using T = typename V::element_type;
+    if (d.algorithm() == D::algo_shift)
+        return shift_r(a, d.shift());
+
+    V t = i_div_mul_hi(a, V(splat(T(d.magic()))));
+    if (d.algorithm() == D::algo_mul_shift)
+        return shift_r(t, d.shift());
+
+    // q = (t + ((a - t) >> 1)) >> s avoids the overflow of a + t
+    V q = shift_r<1>(sub(a, t));
+    q = add(q, t);
+    return shift_r(q, d.shift());
+}
+
+template<class V, class D> SIMDPP_INL
+V i_div_signed(const V& a, const D& d)
+{
+    using S = typename V::element_type;
+    using U = typename remove_sign<V>::type;
+    using T = typename U::element_type;
+    const unsigned bits = sizeof(S) * 8;
+
+    U ua = U(a);
+    V sa = shift_r<bits-1>(a); // all ones if a < 0
+    V q;
+    if (d.algorithm() == D::algo_shift) {
+        q = a;
+        if (d.shift() != 0) {
+            // round towards zero by adding 2^shift - 1 to negative numerators
+            U bias = shift_r(U(sa), bits - d.shift());
+            q = V(add(ua, bias));
+            q = shift_r(q, d.shift());
+        }
+    } else {
+        T magic = T(d.magic());
+        U h = i_div_mul_hi(ua, U(splat(magic)));
+        h = sub(h, bit_and(U(sa), magic));
+        if (S(magic) < 0)
+            h = sub(h, ua);
+        q = V(h);
+        if (d.algorithm() == D::algo_mul_add_shift)
+            q = add(q, a);
+        q = shift_r(q, d.shift());
+        // q + 1 for negative q
+        q = sub(q, shift_r<bits-1>(q));
+    }
+    if (d.divisor() < 0)
+        q = sub(V(make_zero()), q);
+    return q;
+}
+
+template<unsigned N, class D> SIMDPP_INL
+uint16<N> i_div(const uint16<N>& a, const D& d) { return i_div_unsigned(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+uint32<N> i_div(const uint32<N>& a, const D& d) { return i_div_unsigned(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+uint64<N> i_div(const uint64<N>& a, const D& d) { return i_div_unsigned(a, d); }
+
+template<unsigned N, class D> SIMDPP_INL
+int16<N> i_div(const int16<N>& a, const D& d)
+{
+    if (d.algorithm() == D::algo_shift)
+        return i_div_signed(a, d);
+    // native signed multiply-high is available
+    int16<N> q = mul_hi(a, int16<N>(splat(int16_t(d.magic()))));
+    if (d.algorithm() == D::algo_mul_add_shift)
+        q = add(q, a);
+    q = shift_r(q, d.shift());
+    q = sub(q, shift_r<15>(q));
+    if (d.divisor() < 0)
+        q = sub(int16<N>(make_zero()), q);
+    return q;
+}
+
+template<unsigned N, class D> SIMDPP_INL
+int32<N> i_div(const int32<N>& a, const D& d) { return i_div_signed(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+int64<N> i_div(const int64<N>& a, const D& d) { return i_div_signed(a, d); }
+
+template<class V, class D> SIMDPP_INL
+V i_rem(const V& a, const D& d)
+{
+    using U = typename remove_sign<V>::type;
+    using T = typename U::element_type;
+    U q = U(i_div(a, d));
+    U p = i_div_mul_lo(q, U(splat(T(d.divisor()))));
+    return V(sub(U(a), p));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -13,6 +13,8 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/blend.h>
 #include <simdpp/core/i_mull.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/permute4.h>
@@ -140,12 +142,223 @@ uint32<16> i_mul_lo(const uint32<16>& a, const uint32<16>& b)
 
 // -----------------------------------------------------------------------------
 
+static SIMDPP_INL
+uint64<2> i_mul_lo(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    return detail::null::mul(a, b);
+#elif SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm_mullo_epi64(a.native(), b.native());
+#elif SIMDPP_USE_SSE2
+    // low(a * b) = al*bl + ((ah*bl + al*bh) << 32)
+    __m128i ah = _mm_srli_epi64(a.native(), 32);
+    __m128i bh = _mm_srli_epi64(b.native(), 32);
+    __m128i r = _mm_mul_epu32(a.native(), b.native());
+    __m128i c = _mm_add_epi64(_mm_mul_epu32(ah, b.native()),
+                              _mm_mul_epu32(a.native(), bh));
+    return _mm_add_epi64(r, _mm_slli_epi64(c, 32));
+#elif SIMDPP_USE_NEON
+    uint32x2_t al = vmovn_u64(a.native());
+    uint32x2_t bl = vmovn_u64(b.native());
+    uint32x4_t c = vmulq_u32(vreinterpretq_u32_u64(b.native()),
+                             vrev64q_u32(vreinterpretq_u32_u64(a.native())));
+    uint64x2_t r = vshlq_n_u64(vpaddlq_u32(c), 32);
+    return vmlal_u32(r, al, bl);
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_mulv_d((v2i64) a.native(), (v2i64) b.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_lo(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm256_mullo_epi64(a.native(), b.native());
+#else
+    __m256i ah = _mm256_srli_epi64(a.native(), 32);
+    __m256i bh = _mm256_srli_epi64(b.native(), 32);
+    __m256i r = _mm256_mul_epu32(a.native(), b.native());
+    __m256i c = _mm256_add_epi64(_mm256_mul_epu32(ah, b.native()),
+                                 _mm256_mul_epu32(a.native(), bh));
+    return _mm256_add_epi64(r, _mm256_slli_epi64(c, 32));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_lo(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_mullo_epi64(a.native(), b.native());
+#else
+    __m512i ah = _mm512_srli_epi64(a.native(), 32);
+    __m512i bh = _mm512_srli_epi64(b.native(), 32);
+    __m512i r = _mm512_mul_epu32(a.native(), b.native());
+    __m512i c = _mm512_add_epi64(_mm512_mul_epu32(ah, b.native()),
+                                 _mm512_mul_epu32(a.native(), bh));
+    return _mm512_add_epi64(r, _mm512_slli_epi64(c, 32));
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 V i_mul_lo(const V& a, const V& b)
 {
     SIMDPP_VEC_ARRAY_IMPL2(V, i_mul_lo, a, b)
 }
 
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint16<8> i_mul_lo_mask(const uint16<8>& a, const uint16<8>& b,
+                        const mask_int16<8>& mask, const uint16<8>& src)
+{
+    return _mm_mask_mullo_epi16(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_mul_lo_mask(const uint16<16>& a, const uint16<16>& b,
+                         const mask_int16<16>& mask, const uint16<16>& src)
+{
+    return _mm256_mask_mullo_epi16(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_mul_lo_mask(const uint16<32>& a, const uint16<32>& b,
+                         const mask_int16<32>& mask, const uint16<32>& src)
+{
+    return _mm512_mask_mullo_epi16(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_mul_lo_mask(const uint16<N>& a, const uint16<N>& b,
+                        const mask_int16<N>& mask, const uint16<N>& src)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(uint16<N>, i_mul_lo_mask, a, b, mask, src)
+#else
+    return blend(i_mul_lo(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint16<8> i_mul_lo_maskz(const uint16<8>& a, const uint16<8>& b,
+                         const mask_int16<8>& mask)
+{
+    return _mm_maskz_mullo_epi16(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_mul_lo_maskz(const uint16<16>& a, const uint16<16>& b,
+                          const mask_int16<16>& mask)
+{
+    return _mm256_maskz_mullo_epi16(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_mul_lo_maskz(const uint16<32>& a, const uint16<32>& b,
+                          const mask_int16<32>& mask)
+{
+    return _mm512_maskz_mullo_epi16(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_mul_lo_maskz(const uint16<N>& a, const uint16<N>& b,
+                         const mask_int16<N>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(uint16<N>, i_mul_lo_maskz, a, b, mask)
+#else
+    return bit_and(i_mul_lo(a, b), mask);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint32<4> i_mul_lo_mask(const uint32<4>& a, const uint32<4>& b,
+                        const mask_int32<4>& mask, const uint32<4>& src)
+{
+    return _mm_mask_mullo_epi32(src.native(), mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint32<8> i_mul_lo_mask(const uint32<8>& a, const uint32<8>& b,
+                        const mask_int32<8>& mask, const uint32<8>& src)
+{
+    return _mm256_mask_mullo_epi32(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_mul_lo_mask(const uint32<16>& a, const uint32<16>& b,
+                         const mask_int32<16>& mask, const uint32<16>& src)
+{
+    return _mm512_mask_mullo_epi32(src.native(), mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_mul_lo_mask(const uint32<N>& a, const uint32<N>& b,
+                        const mask_int32<N>& mask, const uint32<N>& src)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL4(uint32<N>, i_mul_lo_mask, a, b, mask, src)
+#else
+    return blend(i_mul_lo(a, b), src, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint32<4> i_mul_lo_maskz(const uint32<4>& a, const uint32<4>& b,
+                         const mask_int32<4>& mask)
+{
+    return _mm_maskz_mullo_epi32(mask.native(), a.native(), b.native());
+}
+
+static SIMDPP_INL
+uint32<8> i_mul_lo_maskz(const uint32<8>& a, const uint32<8>& b,
+                         const mask_int32<8>& mask)
+{
+    return _mm256_maskz_mullo_epi32(mask.native(), a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_mul_lo_maskz(const uint32<16>& a, const uint32<16>& b,
+                          const mask_int32<16>& mask)
+{
+    return _mm512_maskz_mullo_epi32(mask.native(), a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_mul_lo_maskz(const uint32<N>& a, const uint32<N>& b,
+                         const mask_int32<N>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    SIMDPP_VEC_ARRAY_IMPL3(uint32<N>, i_mul_lo_maskz, a, b, mask)
+#else
+    return bit_and(i_mul_lo(a, b), mask);
+#endif
+}
+
 } // namespace insn
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
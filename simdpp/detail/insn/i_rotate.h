@@ -0,0 +1,131 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ROTATE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ROTATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<unsigned count, class V> SIMDPP_INL
+V v_emul_rotate_l(const V& a)
+{
+    return bit_or(shift_l<count>(a), shift_r<V::num_bits - count>(a));
+}
+
+template<unsigned count> SIMDPP_INL
+uint32<4> i_rotate_l(const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_rol_epi32(a.native(), count);
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi32(a.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u32(vshlq_n_u32(a.native(), count), a.native(), 32 - count);
+#elif SIMDPP_USE_ALTIVEC
+    uint32<4> c = make_uint(count);
+    return vec_rl(a.native(), c.native());
+#else
+    return v_emul_rotate_l<count>(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint32<8> i_rotate_l(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rol_epi32(a.native(), count);
+#else
+    return v_emul_rotate_l<count>(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint32<16> i_rotate_l(const uint32<16>& a)
+{
+    return _mm512_rol_epi32(a.native(), count);
+}
+#endif
+
+template<unsigned count> SIMDPP_INL
+uint64<2> i_rotate_l(const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_rol_epi64(a.native(), count);
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi64(a.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u64(vshlq_n_u64(a.native(), count), a.native(), 64 - count);
+#elif SIMDPP_USE_VSX_207
+    uint64<2> c = make_uint(count);
+    return vec_rl(a.native(), c.native());
+#else
+    return v_emul_rotate_l<count>(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint64<4> i_rotate_l(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rol_epi64(a.native(), count);
+#else
+    return v_emul_rotate_l<count>(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint64<8> i_rotate_l(const uint64<8>& a)
+{
+    return _mm512_rol_epi64(a.native(), count);
+}
+#endif
+
+template<unsigned count, class V> SIMDPP_INL
+V i_rotate_l(const V& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, i_rotate_l<count>, a)
+}
+
+// Rotation by zero bits is handled separately as the emulation would need
+// to shift by the full width of the element
+template<bool is_zero>
+struct i_rotate_l_wrapper {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& arg) { return i_rotate_l<count>(arg); }
+};
+template<>
+struct i_rotate_l_wrapper<true> {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& arg) { return arg; }
+};
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
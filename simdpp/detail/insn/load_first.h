@@ -0,0 +1,74 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_FIRST_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_FIRST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/to_mask.h>
+#include <simdpp/detail/insn/load_masked.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Returns a mask selecting the bytes in range [begin, begin + 64) of a
+    vector of type V. @a begin must be in range [-64, 64].
+*/
+template<class V> SIMDPP_INL
+typename V::mask_vector_type i_make_byte_range_mask(int begin)
+{
+    using U8 = uint8<V::length_bytes>;
+
+    static const uint8_t mask_d[192] = {
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+    };
+    U8 m = load_u(mask_d + 64 - begin);
+    return to_mask(bit_cast<V>(m));
+}
+
+template<class V> SIMDPP_INL
+V i_load_first_any(const char* p, unsigned n)
+{
+    using R = typename detail::remove_sign<V>::type;
+    using T = typename R::element_type;
+
+    if (n > R::length)
+        n = R::length;
+    R r;
+    i_load_masked_u(r, p, i_make_byte_range_mask<R>(int(n * sizeof(T)) - 64));
+    return V(r);
+}
+
+} // namespace insn
+
+template<class V> SIMDPP_INL
+void construct_eval(V& v, const expr_vec_load_first& e)
+{
+    v = insn::i_load_first_any<V>(e.a, e.n);
+}
+
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
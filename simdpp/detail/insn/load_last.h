@@ -0,0 +1,49 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_LAST_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_LAST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_first.h>
+#include <simdpp/detail/insn/load_masked.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<class V> SIMDPP_INL
+V i_load_last_any(const char* p, unsigned n)
+{
+    using R = typename detail::remove_sign<V>::type;
+    using T = typename R::element_type;
+
+    if (n > R::length)
+        n = R::length;
+    R r;
+    i_load_masked_u(r, p, i_make_byte_range_mask<R>(R::length_bytes - n * sizeof(T)));
+    return V(r);
+}
+
+} // namespace insn
+
+template<class V> SIMDPP_INL
+void construct_eval(V& v, const expr_vec_load_last& e)
+{
+    v = insn::i_load_last_any<V>(e.a, e.n);
+}
+
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
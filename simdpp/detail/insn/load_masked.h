@@ -0,0 +1,531 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/null/memory.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// The smallest page size of all supported architectures. A memory access that
+// does not cross a boundary of a block of this size can not fault if any of the
+// accessed bytes is accessible.
+static const std::uintptr_t min_page_size = 4096;
+
+/*  Loads the elements selected by @a mask from an aligned location. Aligned
+    vector blocks never cross page boundaries, thus the whole block can be
+    loaded if any of the elements is selected.
+*/
+template<class V, class M> SIMDPP_INL
+void i_load_masked_emul(V& a, const char* p, const M& mask)
+{
+    if (test_bits_any(mask.unmask())) {
+        a = load(p);
+        a = bit_and(a, mask);
+    } else {
+        a = make_zero();
+    }
+}
+
+/*  Loads the elements selected by @a mask from an unaligned location. The whole
+    vector is loaded if it does not cross a page boundary and at least one
+    element is selected, otherwise the elements are loaded one by one.
+*/
+template<class V, class M> SIMDPP_INL
+void i_load_masked_u_emul(V& a, const char* p, const M& mask)
+{
+    using T = typename V::element_type;
+    using U = typename V::uint_vector_type;
+
+    std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(p) & (min_page_size - 1);
+    if (offset <= min_page_size - V::length_bytes &&
+        test_bits_any(mask.unmask())) {
+        a = load_u(p);
+        a = bit_and(a, mask);
+        return;
+    }
+
+    mem_block<U> m = bit_cast<U>(mask.unmask());
+    mem_block<V> r;
+    const T* pt = reinterpret_cast<const T*>(p);
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = m[i] ? pt[i] : T(0);
+    }
+    a = r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint8<16>& a, const char* p, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi8(mask.native(), p);
+#else
+    i_load_masked_emul(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint8<16>& a, const char* p, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi8(mask.native(), p);
+#else
+    i_load_masked_u_emul(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint8<32>& a, const char* p, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi8(mask.native(), p);
+#else
+    i_load_masked_emul(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint8<32>& a, const char* p, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi8(mask.native(), p);
+#else
+    i_load_masked_u_emul(a, p, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_masked(uint8<64>& a, const char* p, const mask_int8<64>& mask)
+{
+    a = _mm512_maskz_loadu_epi8(mask.native(), p);
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint8<64>& a, const char* p, const mask_int8<64>& mask)
+{
+    a = _mm512_maskz_loadu_epi8(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint16<8>& a, const char* p, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi16(mask.native(), p);
+#else
+    i_load_masked_emul(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint16<8>& a, const char* p, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi16(mask.native(), p);
+#else
+    i_load_masked_u_emul(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint16<16>& a, const char* p, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi16(mask.native(), p);
+#else
+    i_load_masked_emul(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint16<16>& a, const char* p, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi16(mask.native(), p);
+#else
+    i_load_masked_u_emul(a, p, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_masked(uint16<32>& a, const char* p, const mask_int16<32>& mask)
+{
+    a = _mm512_maskz_loadu_epi16(mask.native(), p);
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint16<32>& a, const char* p, const mask_int16<32>& mask)
+{
+    a = _mm512_maskz_loadu_epi16(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint32<4>& a, const char* p, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    a = _mm_maskz_load_epi32(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+    a = _mm_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#elif SIMDPP_USE_AVX
+    a = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p),
+                                         mask.native()));
+#else
+    i_load_masked_emul(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint32<4>& a, const char* p, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi32(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+    a = _mm_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#elif SIMDPP_USE_AVX
+    a = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p),
+                                         mask.native()));
+#else
+    i_load_masked_u_emul(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint32<8>& a, const char* p, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_load_epi32(mask.native(), p);
+#else
+    a = _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint32<8>& a, const char* p, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi32(mask.native(), p);
+#else
+    a = _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(uint32<16>& a, const char* p, const mask_int32<16>& mask)
+{
+    a = _mm512_maskz_load_epi32(mask.native(), p);
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint32<16>& a, const char* p, const mask_int32<16>& mask)
+{
+    a = _mm512_maskz_loadu_epi32(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint64<2>& a, const char* p, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    a = _mm_maskz_load_epi64(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    a = _mm_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    a = _mm_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+#elif SIMDPP_USE_AVX
+    a = _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p),
+                                         mask.native()));
+#else
+    i_load_masked_emul(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint64<2>& a, const char* p, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi64(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    a = _mm_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    a = _mm_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+#elif SIMDPP_USE_AVX
+    a = _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p),
+                                         mask.native()));
+#else
+    i_load_masked_u_emul(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint64<4>& a, const char* p, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_load_epi64(mask.native(), p);
+#elif __INTEL_COMPILER
+    a = _mm256_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    a = _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint64<4>& a, const char* p, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi64(mask.native(), p);
+#elif __INTEL_COMPILER
+    a = _mm256_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    a = _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(uint64<8>& a, const char* p, const mask_int64<8>& mask)
+{
+    a = _mm512_maskz_load_epi64(mask.native(), p);
+}
+
+static SIMDPP_INL
+void i_load_masked_u(uint64<8>& a, const char* p, const mask_int64<8>& mask)
+{
+    a = _mm512_maskz_loadu_epi64(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(float32<4>& a, const char* p, const mask_float32<4>& mask)
+{
+    const float* q = reinterpret_cast<const float*>(p);
+    (void) q;
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    a = _mm_maskz_load_ps(mask.native(), q);
+#elif SIMDPP_USE_AVX
+    a = _mm_maskload_ps(q, _mm_castps_si128(mask.native()));
+#else
+    i_load_masked_emul(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(float32<4>& a, const char* p, const mask_float32<4>& mask)
+{
+    const float* q = reinterpret_cast<const float*>(p);
+    (void) q;
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    null::load_masked(a, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_ps(mask.native(), q);
+#elif SIMDPP_USE_AVX
+    a = _mm_maskload_ps(q, _mm_castps_si128(mask.native()));
+#else
+    i_load_masked_u_emul(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_masked(float32<8>& a, const char* p, const mask_float32<8>& mask)
+{
+    const float* q = reinterpret_cast<const float*>(p);
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_load_ps(mask.native(), q);
+#else
+    a = _mm256_maskload_ps(q, _mm256_castps_si256(mask.native()));
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(float32<8>& a, const char* p, const mask_float32<8>& mask)
+{
+    const float* q = reinterpret_cast<const float*>(p);
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_ps(mask.native(), q);
+#else
+    a = _mm256_maskload_ps(q, _mm256_castps_si256(mask.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(float32<16>& a, const char* p, const mask_float32<16>& mask)
+{
+    a = _mm512_maskz_load_ps(mask.native(), reinterpret_cast<const float*>(p));
+}
+
+static SIMDPP_INL
+void i_load_masked_u(float32<16>& a, const char* p, const mask_float32<16>& mask)
+{
+    a = _mm512_maskz_loadu_ps(mask.native(), reinterpret_cast<const float*>(p));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(float64<2>& a, const char* p, const mask_float64<2>& mask)
+{
+    const double* q = reinterpret_cast<const double*>(p);
+    (void) q;
+#if SIMDPP_USE_AVX512VL
+    a = _mm_maskz_load_pd(mask.native(), q);
+#elif SIMDPP_USE_AVX
+    a = _mm_maskload_pd(q, _mm_castpd_si128(mask.native()));
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_206 || SIMDPP_USE_MSA
+    i_load_masked_emul(a, p, mask);
+#else
+    null::load_masked(a, p, mask);
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(float64<2>& a, const char* p, const mask_float64<2>& mask)
+{
+    const double* q = reinterpret_cast<const double*>(p);
+    (void) q;
+#if SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_pd(mask.native(), q);
+#elif SIMDPP_USE_AVX
+    a = _mm_maskload_pd(q, _mm_castpd_si128(mask.native()));
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_206 || SIMDPP_USE_MSA
+    i_load_masked_u_emul(a, p, mask);
+#else
+    null::load_masked(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_masked(float64<4>& a, const char* p, const mask_float64<4>& mask)
+{
+    const double* q = reinterpret_cast<const double*>(p);
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_load_pd(mask.native(), q);
+#else
+    a = _mm256_maskload_pd(q, _mm256_castpd_si256(mask.native()));
+#endif
+}
+
+static SIMDPP_INL
+void i_load_masked_u(float64<4>& a, const char* p, const mask_float64<4>& mask)
+{
+    const double* q = reinterpret_cast<const double*>(p);
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_pd(mask.native(), q);
+#else
+    a = _mm256_maskload_pd(q, _mm256_castpd_si256(mask.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(float64<8>& a, const char* p, const mask_float64<8>& mask)
+{
+    a = _mm512_maskz_load_pd(mask.native(), reinterpret_cast<const double*>(p));
+}
+
+static SIMDPP_INL
+void i_load_masked_u(float64<8>& a, const char* p, const mask_float64<8>& mask)
+{
+    a = _mm512_maskz_loadu_pd(mask.native(), reinterpret_cast<const double*>(p));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+void i_load_masked(V& a, const char* p, const M& mask)
+{
+    const unsigned veclen = V::base_vector_type::length_bytes;
+
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_load_masked(a.vec(i), p, mask.vec(i));
+        p += veclen;
+    }
+}
+
+template<class V, class M> SIMDPP_INL
+void i_load_masked_u(V& a, const char* p, const M& mask)
+{
+    const unsigned veclen = V::base_vector_type::length_bytes;
+
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_load_masked_u(a.vec(i), p, mask.vec(i));
+        p += veclen;
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,171 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SCAN_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SCAN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/align.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/traits.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+struct scan_op_add {
+    template<class V> static V apply(const V& a, const V& b) { return add(a, b); }
+    // -0.0 is the identity of floating-point addition and converts to 0 for
+    // integers
+    template<class T> static T identity() { return T(-0.0); }
+};
+
+struct scan_op_max {
+    template<class V> static V apply(const V& a, const V& b) { return max(a, b); }
+    template<class T> static T identity()
+    {
+        return std::numeric_limits<T>::is_integer ? std::numeric_limits<T>::min()
+                                                  : -std::numeric_limits<T>::infinity();
+    }
+};
+
+struct scan_op_min {
+    template<class V> static V apply(const V& a, const V& b) { return min(a, b); }
+    template<class T> static T identity()
+    {
+        return std::numeric_limits<T>::is_integer ? std::numeric_limits<T>::max()
+                                                  : std::numeric_limits<T>::infinity();
+    }
+};
+
+/*  Log-step scan of a 128-bit vector: at step k each element is combined with
+    the element k positions below it, the positions below zero being filled
+    with the identity of the operation. align16 shifts the elements in from the
+    identity vector. Vectors of more than 16 bytes are handled by splitting them
+    in halves, scanning each of them and combining the upper half with a
+    broadcast of the last element of the lower half.
+*/
+template<unsigned K, unsigned E>
+struct i_scan_steps {
+    template<class Op, class V>
+    static SIMDPP_INL V run(const V& a, const V& id)
+    {
+        using T = typename V::element_type;
+        using U8 = uint8<16>;
+        V s = V(align16<16 - K * sizeof(T)>(U8(id), U8(a)));
+        V r = Op::apply(a, s);
+        return i_scan_steps<K * 2, E>::template run<Op>(r, id);
+    }
+};
+
+template<unsigned E>
+struct i_scan_steps<E, E> {
+    template<class Op, class V>
+    static SIMDPP_INL V run(const V& a, const V&) { return a; }
+};
+
+// Broadcasts the last element. i_splat is implemented only for unsigned and
+// floating-point vectors
+template<class V> SIMDPP_INL
+V i_scan_splat_last(const V& a)
+{
+    using U = typename remove_sign<V>::type;
+    return V(splat<V::length-1>(U(a)));
+}
+
+template<class Op, template<unsigned, class> class VT, unsigned N> SIMDPP_INL
+VT<N,void> i_scan(const VT<N,void>& a);
+
+template<class Op, template<unsigned, class> class VT, unsigned N> SIMDPP_INL
+VT<N,void> i_scan(const VT<N,void>& a, std::false_type /*split*/)
+{
+    using V = VT<N,void>;
+    using T = typename V::element_type;
+    V id = splat(Op::template identity<T>());
+    return i_scan_steps<1, N>::template run<Op>(a, id);
+}
+
+template<class Op, template<unsigned, class> class VT, unsigned N> SIMDPP_INL
+VT<N,void> i_scan(const VT<N,void>& a, std::true_type /*split*/)
+{
+    using H = VT<N/2,void>;
+    H lo, hi;
+    split(a, lo, hi);
+    lo = i_scan<Op>(lo);
+    hi = i_scan<Op>(hi);
+    hi = Op::apply(hi, i_scan_splat_last(lo));
+    return combine(lo, hi);
+}
+
+template<class Op, template<unsigned, class> class VT, unsigned N> SIMDPP_INL
+VT<N,void> i_scan(const VT<N,void>& a)
+{
+    using T = typename VT<N,void>::element_type;
+    using split_tag = std::integral_constant<bool, (N * sizeof(T) > 16)>;
+    return i_scan<Op>(a, split_tag());
+}
+
+// -----------------------------------------------------------------------------
+
+/*  Scans an array. Each vector is scanned and combined with the carry, which
+    is the broadcast of the last element of the previous result. The remaining
+    elements are processed one by one.
+*/
+template<class V, bool Exclusive, class T> SIMDPP_INL
+T i_scan_add_array(T* dst, const T* src, std::size_t n, T init)
+{
+    const unsigned W = V::length;
+    V carry = splat(init);
+    std::size_t i = 0;
+    for (; i + W <= n; i += W) {
+        V a = load_u(src + i);
+        V s = add(i_scan<scan_op_add>(a), carry);
+        if (Exclusive) {
+            store_u(dst + i, V(sub(s, a)));
+        } else {
+            store_u(dst + i, s);
+        }
+        carry = i_scan_splat_last(s);
+    }
+
+    T sum = extract<0>(carry);
+    for (; i < n; ++i) {
+        T a = src[i];
+        T s = T(sum + a);
+        dst[i] = Exclusive ? sum : s;
+        sum = s;
+    }
+    return sum;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,385 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Stores the elements one by one, starting from the first one. If several
+    indices are equal, the element that is stored last wins, same as with the
+    AVX-512 scatter instructions.
+*/
+template<class V, class I> SIMDPP_INL
+void i_scatter_emul(char* base, const I& idx, const V& a)
+{
+    using T = typename V::element_type;
+    using S = typename std::make_signed<typename I::element_type>::type;
+
+    mem_block<I> mi = idx;
+    mem_block<V> ma = a;
+    T* pt = reinterpret_cast<T*>(base);
+    for (unsigned i = 0; i < V::length; ++i) {
+        pt[static_cast<S>(mi[i])] = ma[i];
+    }
+}
+
+/*  Stores the elements selected by the mask one by one. The memory that the
+    rest of the elements point to is not accessed.
+*/
+template<class V, class I, class M> SIMDPP_INL
+void i_scatter_masked_emul(char* base, const I& idx, const V& a, const M& mask)
+{
+    using T = typename V::element_type;
+    using U = typename V::uint_vector_type;
+    using S = typename std::make_signed<typename I::element_type>::type;
+
+    mem_block<I> mi = idx;
+    mem_block<U> m = bit_cast<U>(mask.unmask());
+    mem_block<V> ma = a;
+    T* pt = reinterpret_cast<T*>(base);
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (m[i])
+            pt[static_cast<S>(mi[i])] = ma[i];
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<4>& idx, const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_i32scatter_epi32(base, idx.native(), a.native(), 4);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<8>& idx, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_epi32(base, idx.native(), a.native(), 4);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<16>& idx, const uint32<16>& a)
+{
+    _mm512_i32scatter_epi32(base, idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint64<2>& idx, const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_i64scatter_epi64(base, idx.native(), a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* base, const uint64<4>& idx, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i64scatter_epi64(base, idx.native(), a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint64<8>& idx, const uint64<8>& a)
+{
+    _mm512_i64scatter_epi64(base, idx.native(), a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<4>& idx, const float32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_i32scatter_ps(base, idx.native(), a.native(), 4);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<8>& idx, const float32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_ps(base, idx.native(), a.native(), 4);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<16>& idx, const float32<16>& a)
+{
+    _mm512_i32scatter_ps(base, idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint64<2>& idx, const float64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_i64scatter_pd(base, idx.native(), a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter(char* base, const uint64<4>& idx, const float64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i64scatter_pd(base, idx.native(), a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint64<8>& idx, const float64<8>& a)
+{
+    _mm512_i64scatter_pd(base, idx.native(), a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class I, class V> SIMDPP_INL
+void i_scatter_vec(char* base, const I& idx, const V& a, std::true_type)
+{
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_scatter(base, idx.vec(i), a.vec(i));
+    }
+}
+
+// On AVX floating-point vectors are wider than integer vectors
+template<class I, class V> SIMDPP_INL
+void i_scatter_vec(char* base, const I& idx, const V& a, std::false_type)
+{
+    i_scatter_emul(base, idx, a);
+}
+
+template<class I, class V> SIMDPP_INL
+void i_scatter(char* base, const I& idx, const V& a)
+{
+    i_scatter_vec(base, idx, a, std::integral_constant<bool,
+                  V::vec_length == I::vec_length>());
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<4>& idx, const uint32<4>& a,
+                      const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<8>& idx, const uint32<8>& a,
+                      const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<16>& idx, const uint32<16>& a,
+                      const mask_int32<16>& mask)
+{
+    _mm512_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint64<2>& idx, const uint64<2>& a,
+                      const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_i64scatter_epi64(base, mask.native(), idx.native(), a.native(), 8);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint64<4>& idx, const uint64<4>& a,
+                      const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i64scatter_epi64(base, mask.native(), idx.native(), a.native(), 8);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint64<8>& idx, const uint64<8>& a,
+                      const mask_int64<8>& mask)
+{
+    _mm512_mask_i64scatter_epi64(base, mask.native(), idx.native(), a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<4>& idx, const float32<4>& a,
+                      const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_i32scatter_ps(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<8>& idx, const float32<8>& a,
+                      const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_ps(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<16>& idx, const float32<16>& a,
+                      const mask_float32<16>& mask)
+{
+    _mm512_mask_i32scatter_ps(base, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint64<2>& idx, const float64<2>& a,
+                      const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_i64scatter_pd(base, mask.native(), idx.native(), a.native(), 8);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint64<4>& idx, const float64<4>& a,
+                      const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i64scatter_pd(base, mask.native(), idx.native(), a.native(), 8);
+#else
+    i_scatter_masked_emul(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint64<8>& idx, const float64<8>& a,
+                      const mask_float64<8>& mask)
+{
+    _mm512_mask_i64scatter_pd(base, mask.native(), idx.native(), a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class I, class V, class M> SIMDPP_INL
+void i_scatter_masked_vec(char* base, const I& idx, const V& a, const M& mask,
+                          std::true_type)
+{
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_scatter_masked(base, idx.vec(i), a.vec(i), mask.vec(i));
+    }
+}
+
+template<class I, class V, class M> SIMDPP_INL
+void i_scatter_masked_vec(char* base, const I& idx, const V& a, const M& mask,
+                          std::false_type)
+{
+    i_scatter_masked_emul(base, idx, a, mask);
+}
+
+template<class I, class V, class M> SIMDPP_INL
+void i_scatter_masked(char* base, const I& idx, const V& a, const M& mask)
+{
+    i_scatter_masked_vec(base, idx, a, mask, std::integral_constant<bool,
+                         V::vec_length == I::vec_length>());
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,475 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SORT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SORT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include <simdpp/types.h>
+#include <simdpp/core/aligned_allocator.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute2.h>
+#include <simdpp/core/permute4.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store.h>
+
+// The array sort uses sorting networks only when the 64-bit min and max are
+// available. The null architecture always uses std::sort as the networks
+// would be much slower than it.
+#if SIMDPP_USE_NULL
+#define SIMDPP_DETAIL_SORT_USE_NETWORKS32 0
+#define SIMDPP_DETAIL_SORT_USE_NETWORKS64 0
+#elif SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+#define SIMDPP_DETAIL_SORT_USE_NETWORKS32 1
+#define SIMDPP_DETAIL_SORT_USE_NETWORKS64 1
+#else
+#define SIMDPP_DETAIL_SORT_USE_NETWORKS32 1
+#define SIMDPP_DETAIL_SORT_USE_NETWORKS64 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<class V> struct sort_half_vector;
+
+template<template<unsigned, class> class VT, unsigned N>
+struct sort_half_vector<VT<N,void>> {
+    using type = VT<N/2,void>;
+};
+
+// Unsigned integer vector type with the same element size as V. Used for the
+// blend masks and permutations
+template<class V> struct sort_uint_vector {
+    using type = typename std::conditional<sizeof(typename V::element_type) == 4,
+                                           uint32<V::length>,
+                                           uint64<V::length>>::type;
+};
+
+/*  Compare-exchange of each element i with the element i+D within each block
+    of 2*D elements. The smaller element ends up in the lower position.
+
+    When the two halves of the vector are compared, they are compared directly.
+    Otherwise the distance is either 1 or 2 elements and the partners are
+    brought together by permuting within 128-bit lanes. The minimum and
+    maximum are then blended by position. The permutations are done on
+    unsigned vectors as they are not implemented for all types.
+*/
+template<unsigned D, class V> SIMDPP_INL
+V i_sort_cmpx(const V& a);
+
+template<unsigned D, class V> SIMDPP_INL
+V i_sort_cmpx(const V& a, std::integral_constant<int, 0> /*halves*/)
+{
+    typename sort_half_vector<V>::type lo, hi;
+    split(a, lo, hi);
+    return combine(min(lo, hi), max(lo, hi));
+}
+
+template<unsigned D, class V> SIMDPP_INL
+V i_sort_cmpx(const V& a, std::integral_constant<int, 1> /*split*/)
+{
+    typename sort_half_vector<V>::type lo, hi;
+    split(a, lo, hi);
+    return combine(i_sort_cmpx<D>(lo), i_sort_cmpx<D>(hi));
+}
+
+template<unsigned D, class V> SIMDPP_INL
+V i_sort_cmpx(const V& a, std::integral_constant<int, 2> /*adjacent*/)
+{
+    using U = typename sort_uint_vector<V>::type;
+    V b = V(permute2<1,0>(U(a)));
+    V mask = V(make_uint<U>(0, ~uint64_t(0)));
+    return blend(max(a, b), min(a, b), mask);
+}
+
+template<unsigned D, class V> SIMDPP_INL
+V i_sort_cmpx(const V& a, std::integral_constant<int, 3> /*by two*/)
+{
+    using U = typename sort_uint_vector<V>::type;
+    V b = V(permute4<2,3,0,1>(U(a)));
+    V mask = V(make_uint<U>(0, 0, ~uint64_t(0), ~uint64_t(0)));
+    return blend(max(a, b), min(a, b), mask);
+}
+
+template<unsigned D, class V> SIMDPP_INL
+V i_sort_cmpx(const V& a)
+{
+    const unsigned size = sizeof(typename V::element_type);
+    const int kind = (D * 2 == V::length && V::length * size > 16) ? 0 :
+                     (D * size >= 16) ? 1 : (D == 1) ? 2 : 3;
+    return i_sort_cmpx<D>(a, std::integral_constant<int, kind>());
+}
+
+// Sorts a bitonic sequence in ascending order using compare-exchanges at
+// distances D, D/2, ..., 1
+template<unsigned D>
+struct i_sort_bitonic_clean {
+    template<class V>
+    static SIMDPP_INL V run(const V& a)
+    {
+        return i_sort_bitonic_clean<D/2>::run(i_sort_cmpx<D>(a));
+    }
+};
+
+template<>
+struct i_sort_bitonic_clean<0> {
+    template<class V>
+    static SIMDPP_INL V run(const V& a) { return a; }
+};
+
+// Reverses the order of the elements
+template<class V> SIMDPP_INL
+V i_sort_reverse(const V& a);
+
+template<class V> SIMDPP_INL
+V i_sort_reverse(const V& a, std::true_type /*split*/)
+{
+    typename sort_half_vector<V>::type lo, hi;
+    split(a, lo, hi);
+    return combine(i_sort_reverse(hi), i_sort_reverse(lo));
+}
+
+template<class V> SIMDPP_INL
+V i_sort_reverse(const V& a, std::integral_constant<int, 4> /*element size*/)
+{
+    using U = typename sort_uint_vector<V>::type;
+    return V(permute4<3,2,1,0>(U(a)));
+}
+
+template<class V> SIMDPP_INL
+V i_sort_reverse(const V& a, std::integral_constant<int, 8> /*element size*/)
+{
+    using U = typename sort_uint_vector<V>::type;
+    return V(permute2<1,0>(U(a)));
+}
+
+template<class V> SIMDPP_INL
+V i_sort_reverse(const V& a, std::false_type /*split*/)
+{
+    const int size = sizeof(typename V::element_type);
+    return i_sort_reverse(a, std::integral_constant<int, size>());
+}
+
+template<class V> SIMDPP_INL
+V i_sort_reverse(const V& a)
+{
+    using T = typename V::element_type;
+    using split_tag = std::integral_constant<bool, (V::length * sizeof(T) > 16)>;
+    return i_sort_reverse(a, split_tag());
+}
+
+/*  Merges two sorted vectors. The first vector of the result contains the
+    smaller half of the elements. The second vector is reversed so that the
+    concatenation of the inputs is a bitonic sequence, whose halves are
+    separated with a single min/max step and then sorted.
+*/
+template<class V> SIMDPP_INL
+void i_sort_merge(V& a, V& b)
+{
+    V br = i_sort_reverse(b);
+    V lo = min(a, br);
+    V hi = max(a, br);
+    a = i_sort_bitonic_clean<V::length/2>::run(lo);
+    b = i_sort_bitonic_clean<V::length/2>::run(hi);
+}
+
+template<class V> SIMDPP_INL
+V i_sort_vector(const V& a);
+
+template<class V> SIMDPP_INL
+V i_sort_vector(const V& a, std::true_type /*split*/)
+{
+    typename sort_half_vector<V>::type lo, hi;
+    split(a, lo, hi);
+    lo = i_sort_vector(lo);
+    hi = i_sort_vector(hi);
+    i_sort_merge(lo, hi);
+    return combine(lo, hi);
+}
+
+template<class V> SIMDPP_INL
+V i_sort_vector(const V& a, std::false_type /*split*/)
+{
+    using U = typename sort_uint_vector<V>::type;
+    V r = i_sort_cmpx<1>(a);
+    if (V::length == 4) {
+        // compare each element with the mirrored one of the other pair
+        V b = i_sort_reverse(r);
+        V mask = V(make_uint<U>(0, 0, ~uint64_t(0), ~uint64_t(0)));
+        r = blend(max(r, b), min(r, b), mask);
+        r = i_sort_cmpx<1>(r);
+    }
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V i_sort_vector(const V& a)
+{
+    using T = typename V::element_type;
+    using split_tag = std::integral_constant<bool, (V::length * sizeof(T) > 16)>;
+    return i_sort_vector(a, split_tag());
+}
+
+template<class V> SIMDPP_INL
+void i_sort_cmpx2(V& a, V& b)
+{
+    V t = min(a, b);
+    b = max(a, b);
+    a = t;
+}
+
+// Odd-even merge sorting network for four inputs
+template<class V> SIMDPP_INL
+void i_sort_columns(V& a0, V& a1, V& a2, V& a3)
+{
+    i_sort_cmpx2(a0, a1);
+    i_sort_cmpx2(a2, a3);
+    i_sort_cmpx2(a0, a2);
+    i_sort_cmpx2(a1, a3);
+    i_sort_cmpx2(a1, a2);
+}
+
+// -----------------------------------------------------------------------------
+// Array sort. The keys are mapped to unsigned integers whose order is the
+// same as the order of the original values, which also makes the order of
+// floating-point values total: -0.0 sorts before 0.0 and NaNs sort before
+// negative infinity or after positive infinity depending on their sign.
+
+template<class T> struct sort_key_map;
+
+template<> struct sort_key_map<uint32_t> {
+    using key = uint32_t;
+    static key to_key(uint32_t x) { return x; }
+    static uint32_t from_key(key k) { return k; }
+};
+
+template<> struct sort_key_map<int32_t> {
+    using key = uint32_t;
+    static key to_key(int32_t x) { return key(x) ^ 0x80000000; }
+    static int32_t from_key(key k) { return int32_t(k ^ 0x80000000); }
+};
+
+template<> struct sort_key_map<float> {
+    using key = uint32_t;
+    static key to_key(float x)
+    {
+        key b;
+        std::memcpy(&b, &x, sizeof(b));
+        return b ^ ((b >> 31) ? 0xffffffff : 0x80000000);
+    }
+    static float from_key(key k)
+    {
+        key b = k ^ ((k >> 31) ? 0x80000000 : 0xffffffff);
+        float x;
+        std::memcpy(&x, &b, sizeof(x));
+        return x;
+    }
+};
+
+template<> struct sort_key_map<uint64_t> {
+    using key = uint64_t;
+    static key to_key(uint64_t x) { return x; }
+    static uint64_t from_key(key k) { return k; }
+};
+
+template<> struct sort_key_map<int64_t> {
+    using key = uint64_t;
+    static key to_key(int64_t x) { return key(x) ^ 0x8000000000000000; }
+    static int64_t from_key(key k) { return int64_t(k ^ 0x8000000000000000); }
+};
+
+template<> struct sort_key_map<double> {
+    using key = uint64_t;
+    static key to_key(double x)
+    {
+        key b;
+        std::memcpy(&b, &x, sizeof(b));
+        return b ^ ((b >> 63) ? 0xffffffffffffffff : 0x8000000000000000);
+    }
+    static double from_key(key k)
+    {
+        key b = k ^ ((k >> 63) ? 0x8000000000000000 : 0xffffffffffffffff);
+        double x;
+        std::memcpy(&x, &b, sizeof(x));
+        return x;
+    }
+};
+
+/*  Merges the sorted runs [a, a+na) and [b, b+nb) into out. The lengths must
+    be nonzero multiples of the vector length. The vector v holds the largest
+    elements seen so far. At each step the input vector whose first element is
+    smaller is merged with it, the lower half of the result being stored.
+*/
+template<class V, class K> SIMDPP_INL
+void i_sort_merge_runs(K* out, const K* a, std::size_t na,
+                       const K* b, std::size_t nb)
+{
+    const unsigned W = V::length;
+    V v = load(a);
+    V w = load(b);
+    std::size_t ia = W, ib = W;
+    i_sort_merge(v, w);
+    store(out, v);
+    out += W;
+    v = w;
+
+    while (ia < na || ib < nb) {
+        bool take_a = ib >= nb || (ia < na && a[ia] <= b[ib]);
+        const K* p = take_a ? a + ia : b + ib;
+        ia += take_a ? W : 0;
+        ib += take_a ? 0 : W;
+        w = load(p);
+        i_sort_merge(v, w);
+        store(out, v);
+        out += W;
+        v = w;
+    }
+    store(out, v);
+}
+
+/*  Sorts n keys stored in an aligned buffer of n_pad elements, n_pad being a
+    multiple of twice the vector length. The padding is filled with the
+    maximum key. tmp must have the same size. Returns the buffer containing
+    the result. Runs of two vectors are sorted in registers and then merged
+    pairwise until a single run remains.
+*/
+template<class V, class K> SIMDPP_INL
+K* i_sort_keys_networks(K* data, K* tmp, std::size_t n, std::size_t n_pad)
+{
+    const unsigned W = V::length;
+    std::fill(data + n, data + n_pad, K(~K(0)));
+
+    for (std::size_t i = 0; i < n_pad; i += 2 * W) {
+        V a = load(data + i);
+        V b = load(data + i + W);
+        a = i_sort_vector(a);
+        b = i_sort_vector(b);
+        i_sort_merge(a, b);
+        store(data + i, a);
+        store(data + i + W, b);
+    }
+
+    for (std::size_t run = 2 * W; run < n_pad; run *= 2) {
+        for (std::size_t i = 0; i < n_pad; i += 2 * run) {
+            std::size_t na = std::min(run, n_pad - i);
+            std::size_t nb = std::min(run, n_pad - i - na);
+            if (nb == 0) {
+                std::copy(data + i, data + i + na, tmp + i);
+            } else {
+                i_sort_merge_runs<V>(tmp + i, data + i, na, data + i + na, nb);
+            }
+        }
+        std::swap(data, tmp);
+    }
+    return data;
+}
+
+template<class V, class K> SIMDPP_INL
+K* i_sort_keys(K* data, K* tmp, std::size_t n, std::size_t n_pad,
+               std::true_type /*networks*/)
+{
+    return i_sort_keys_networks<V>(data, tmp, n, n_pad);
+}
+
+template<class V, class K> SIMDPP_INL
+K* i_sort_keys(K* data, K*, std::size_t n, std::size_t,
+               std::false_type /*networks*/)
+{
+    std::sort(data, data + n);
+    return data;
+}
+
+template<class K>
+using sort_buffer = std::vector<K, aligned_allocator<K, 64>>;
+
+template<class K>
+struct sort_vector_type {
+    using type = typename std::conditional<sizeof(K) == 4, uint32v, uint64v>::type;
+    static const bool use_networks = sizeof(K) == 4 ? SIMDPP_DETAIL_SORT_USE_NETWORKS32
+                                                    : SIMDPP_DETAIL_SORT_USE_NETWORKS64;
+};
+
+template<class T> SIMDPP_INL
+void i_sort(T* first, T* last)
+{
+    using M = sort_key_map<T>;
+    using K = typename M::key;
+    using V = typename sort_vector_type<K>::type;
+    using use_networks = std::integral_constant<bool, sort_vector_type<K>::use_networks>;
+
+    std::size_t n = last - first;
+    if (n < 2)
+        return;
+    std::size_t block = 2 * V::length;
+    std::size_t n_pad = (n + block - 1) / block * block;
+    sort_buffer<K> data(n_pad), tmp(use_networks::value ? n_pad : 0);
+    for (std::size_t i = 0; i < n; ++i)
+        data[i] = M::to_key(first[i]);
+
+    K* r = i_sort_keys<V>(data.data(), tmp.data(), n, n_pad, use_networks());
+    for (std::size_t i = 0; i < n; ++i)
+        first[i] = M::from_key(r[i]);
+}
+
+/*  Key-value pairs with 32-bit keys and values are sorted as 64-bit integers
+    with the key in the upper half. Pairs with equal keys are thus ordered by
+    the bit patterns of their values.
+*/
+template<class T, class P> SIMDPP_INL
+void i_sort_pairs(T* first, T* last, P* values)
+{
+    static_assert(sizeof(P) == 4 && std::is_trivially_copyable<P>::value,
+                  "Values must be trivially copyable 32-bit types");
+    using M = sort_key_map<T>;
+    using K = uint64_t;
+    using V = uint64v;
+    using use_networks = std::integral_constant<bool, SIMDPP_DETAIL_SORT_USE_NETWORKS64>;
+
+    std::size_t n = last - first;
+    if (n < 2)
+        return;
+    std::size_t block = 2 * V::length;
+    std::size_t n_pad = (n + block - 1) / block * block;
+    sort_buffer<K> data(n_pad), tmp(use_networks::value ? n_pad : 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        uint32_t v;
+        std::memcpy(&v, values + i, sizeof(v));
+        data[i] = (K(M::to_key(first[i])) << 32) | v;
+    }
+
+    K* r = i_sort_keys<V>(data.data(), tmp.data(), n, n_pad, use_networks());
+    for (std::size_t i = 0; i < n; ++i) {
+        uint32_t v = uint32_t(r[i]);
+        first[i] = M::from_key(uint32_t(r[i] >> 32));
+        std::memcpy(values + i, &v, sizeof(v));
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -15,14 +15,92 @@
 #include <simdpp/types.h>
 #include <simdpp/core/load.h>
 #include <simdpp/core/store.h>
+#include <simdpp/core/cast.h>
 #include <simdpp/detail/null/memory.h>
 #include <simdpp/detail/align.h>
+#include <simdpp/detail/mem_block.h>
 
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
 namespace detail {
 namespace insn {
 
+static SIMDPP_INL
+void i_store_masked(char* p, const uint8<16>& a, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_epi8(p, mask.native(), a.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    uint8<16> b = load(p);
+    b = blend(a, b, mask);
+    store(p, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_masked(char* p, const uint8<32>& a, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_epi8(p, mask.native(), a.native());
+#else
+    uint8<32> b = load(p);
+    b = blend(a, b, mask);
+    store(p, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_store_masked(char* p, const uint8<64>& a, const mask_int8<64>& mask)
+{
+    _mm512_mask_storeu_epi8(p, mask.native(), a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_masked(char* p, const uint16<8>& a, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_epi16(p, mask.native(), a.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    uint16<8> b = load(p);
+    b = blend(a, b, mask);
+    store(p, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_masked(char* p, const uint16<16>& a, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_epi16(p, mask.native(), a.native());
+#else
+    uint16<16> b = load(p);
+    b = blend(a, b, mask);
+    store(p, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_store_masked(char* p, const uint16<32>& a, const mask_int16<32>& mask)
+{
+    _mm512_mask_storeu_epi16(p, mask.native(), a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 static SIMDPP_INL
 void i_store_masked(char* p, const uint32<4>& a, const mask_int32<4>& mask)
 {
@@ -210,6 +288,242 @@ void i_store_masked(char* p, const float64<8>& a, const mask_float64<8>& mask)
 
 // -----------------------------------------------------------------------------
 
+// Stores the elements selected by @a mask one by one. Memory of the elements
+// that are not selected is never accessed.
+template<class V, class M> SIMDPP_INL
+void i_store_masked_u_emul(char* p, const V& a, const M& mask)
+{
+    using T = typename V::element_type;
+    using U = typename V::uint_vector_type;
+
+    mem_block<U> m = bit_cast<U>(mask.unmask());
+    mem_block<V> v = a;
+    T* pt = reinterpret_cast<T*>(p);
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (m[i])
+            pt[i] = v[i];
+    }
+}
+
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint8<16>& a, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_epi8(p, mask.native(), a.native());
+#else
+    i_store_masked_u_emul(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint8<32>& a, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_epi8(p, mask.native(), a.native());
+#else
+    i_store_masked_u_emul(p, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint8<64>& a, const mask_int8<64>& mask)
+{
+    _mm512_mask_storeu_epi8(p, mask.native(), a.native());
+}
+#endif
+
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint16<8>& a, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_epi16(p, mask.native(), a.native());
+#else
+    i_store_masked_u_emul(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint16<16>& a, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_epi16(p, mask.native(), a.native());
+#else
+    i_store_masked_u_emul(p, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint16<32>& a, const mask_int16<32>& mask)
+{
+    _mm512_mask_storeu_epi16(p, mask.native(), a.native());
+}
+#endif
+
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint32<4>& a, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_epi32(p, mask.native(), a.native());
+#elif SIMDPP_USE_AVX2
+    _mm_maskstore_epi32(reinterpret_cast<int*>(p), mask.native(), a.native());
+#elif SIMDPP_USE_AVX
+    _mm_maskstore_ps(reinterpret_cast<float*>(p), mask.native(),
+                     _mm_castsi128_ps(a.native()));
+#else
+    i_store_masked_u_emul(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint32<8>& a, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_epi32(p, mask.native(), a.native());
+#else
+    _mm256_maskstore_epi32(reinterpret_cast<int*>(p), mask.native(), a.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint32<16>& a, const mask_int32<16>& mask)
+{
+    _mm512_mask_storeu_epi32(p, mask.native(), a.native());
+}
+#endif
+
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint64<2>& a, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_epi64(p, mask.native(), a.native());
+#elif SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    _mm_maskstore_epi64(reinterpret_cast<__int64*>(p), mask.native(), a.native());
+#else
+    _mm_maskstore_epi64(reinterpret_cast<long long*>(p), mask.native(), a.native());
+#endif
+#elif SIMDPP_USE_AVX
+    _mm_maskstore_pd(reinterpret_cast<double*>(p), mask.native(), _mm_castsi128_pd(a.native()));
+#else
+    i_store_masked_u_emul(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint64<4>& a, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_epi64(p, mask.native(), a.native());
+#elif __INTEL_COMPILER
+    _mm256_maskstore_epi64(reinterpret_cast<__int64*>(p), mask.native(), a.native());
+#else
+    _mm256_maskstore_epi64(reinterpret_cast<long long*>(p), mask.native(), a.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_masked_u(char* p, const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_storeu_epi64(p, mask.native(), a.native());
+}
+#endif
+
+static SIMDPP_INL
+void i_store_masked_u(char* p, const float32<4>& a, const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_ps(reinterpret_cast<float*>(p), mask.native(), a.native());
+#elif SIMDPP_USE_AVX
+    _mm_maskstore_ps(reinterpret_cast<float*>(p),
+                     _mm_castps_si128(mask.native()), a.native());
+#else
+    i_store_masked_u_emul(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_store_masked_u(char* p, const float32<8>& a, const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_ps(reinterpret_cast<float*>(p), mask.native(),
+                          a.native());
+#else
+    _mm256_maskstore_ps(reinterpret_cast<float*>(p),
+                        _mm256_castps_si256(mask.native()), a.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_masked_u(char* p, const float32<16>& a, const mask_float32<16>& mask)
+{
+    _mm512_mask_storeu_ps(reinterpret_cast<float*>(p), mask.native(), a.native());
+}
+#endif
+
+static SIMDPP_INL
+void i_store_masked_u(char* p, const float64<2>& a, const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_storeu_pd(reinterpret_cast<double*>(p), mask.native(), a.native());
+#elif SIMDPP_USE_AVX
+    _mm_maskstore_pd(reinterpret_cast<double*>(p),
+                     _mm_castpd_si128(mask.native()), a.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_206 || SIMDPP_USE_MSA
+    i_store_masked_u_emul(p, a, mask);
+#elif SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    null::store_masked(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_store_masked_u(char* p, const float64<4>& a, const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_storeu_pd(reinterpret_cast<double*>(p), mask.native(),
+                          a.native());
+#else
+    _mm256_maskstore_pd(reinterpret_cast<double*>(p),
+                        _mm256_castpd_si256(mask.native()), a.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_masked_u(char* p, const float64<8>& a, const mask_float64<8>& mask)
+{
+    _mm512_mask_storeu_pd(reinterpret_cast<double*>(p), mask.native(), a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 template<class V, class M>
 void i_store_masked(char* p, const V& a, const M& mask)
 {
@@ -221,6 +535,17 @@ void i_store_masked(char* p, const V& a, const M& mask)
     }
 }
 
+template<class V, class M>
+void i_store_masked_u(char* p, const V& a, const M& mask)
+{
+    const unsigned veclen = V::base_vector_type::length_bytes;
+
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_masked_u(p, a.vec(i), mask.vec(i));
+        p += veclen;
+    }
+}
+
 } // namespace insn
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
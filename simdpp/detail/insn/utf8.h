@@ -0,0 +1,553 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_UTF8_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_UTF8_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_not.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/compress.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/core/to_int8.h>
+#include <simdpp/core/to_int16.h>
+#include <simdpp/core/to_int32.h>
+#include <simdpp/core/zip_hi.h>
+#include <simdpp/core/zip_lo.h>
+
+// The lookup based validation needs permute_bytes16 which is not available
+// on SSE2
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || \
+    SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+#define SIMDPP_DETAIL_UTF8_USE_LOOKUP 1
+#else
+#define SIMDPP_DETAIL_UTF8_USE_LOOKUP 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+static const std::size_t utf_invalid_result = ~std::size_t(0);
+
+/*  Decodes the UTF-8 sequence at the beginning of the @a n bytes at @a p.
+    Returns the length of the sequence or zero if it is invalid.
+*/
+static SIMDPP_INL
+unsigned i_utf8_decode(const uint8_t* p, std::size_t n, uint32_t& cp)
+{
+    uint32_t b0 = p[0];
+    if (b0 < 0x80) {
+        cp = b0;
+        return 1;
+    }
+    unsigned len;
+    uint32_t min;
+    if (b0 < 0xc2) {
+        return 0; // continuation byte or overlong 2-byte sequence
+    } else if (b0 < 0xe0) {
+        len = 2; cp = b0 & 0x1f; min = 0x80;
+    } else if (b0 < 0xf0) {
+        len = 3; cp = b0 & 0x0f; min = 0x800;
+    } else if (b0 < 0xf5) {
+        len = 4; cp = b0 & 0x07; min = 0x10000;
+    } else {
+        return 0;
+    }
+    if (n < len)
+        return 0;
+    for (unsigned k = 1; k < len; ++k) {
+        uint32_t b = p[k];
+        if ((b & 0xc0) != 0x80)
+            return 0;
+        cp = (cp << 6) | (b & 0x3f);
+    }
+    if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+        return 0;
+    return len;
+}
+
+// Encodes a valid code point as UTF-8. Returns the number of bytes written
+static SIMDPP_INL
+unsigned i_utf8_encode(char* out, uint32_t cp)
+{
+    if (cp < 0x80) {
+        out[0] = char(cp);
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = char(0xc0 | (cp >> 6));
+        out[1] = char(0x80 | (cp & 0x3f));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = char(0xe0 | (cp >> 12));
+        out[1] = char(0x80 | ((cp >> 6) & 0x3f));
+        out[2] = char(0x80 | (cp & 0x3f));
+        return 3;
+    }
+    out[0] = char(0xf0 | (cp >> 18));
+    out[1] = char(0x80 | ((cp >> 12) & 0x3f));
+    out[2] = char(0x80 | ((cp >> 6) & 0x3f));
+    out[3] = char(0x80 | (cp & 0x3f));
+    return 4;
+}
+
+/*  Reads a code point from the beginning of the @a n units at @a s. Returns
+    the number of the units or zero if they don't form a valid code point.
+*/
+static SIMDPP_INL
+unsigned i_utf_read(const char16_t* s, std::size_t n, uint32_t& cp)
+{
+    uint32_t u = s[0];
+    if (u < 0xd800 || u > 0xdfff) {
+        cp = u;
+        return 1;
+    }
+    if (u > 0xdbff || n < 2)
+        return 0;
+    uint32_t l = s[1];
+    if (l < 0xdc00 || l > 0xdfff)
+        return 0;
+    cp = 0x10000 + ((u - 0xd800) << 10) + (l - 0xdc00);
+    return 2;
+}
+
+static SIMDPP_INL
+unsigned i_utf_read(const char32_t* s, std::size_t, uint32_t& cp)
+{
+    cp = s[0];
+    if (cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+        return 0;
+    return 1;
+}
+
+// Writes a code point to the output. Returns the number of the units written
+static SIMDPP_INL
+unsigned i_utf_write(char16_t* out, uint32_t cp)
+{
+    if (cp < 0x10000) {
+        out[0] = char16_t(cp);
+        return 1;
+    }
+    cp -= 0x10000;
+    out[0] = char16_t(0xd800 + (cp >> 10));
+    out[1] = char16_t(0xdc00 + (cp & 0x3ff));
+    return 2;
+}
+
+static SIMDPP_INL
+unsigned i_utf_write(char32_t* out, uint32_t cp)
+{
+    out[0] = char32_t(cp);
+    return 1;
+}
+
+#if SIMDPP_DETAIL_UTF8_USE_LOOKUP
+/*  Validation using lookup tables as described in "Validating UTF-8 In Less
+    Than One Instruction Per Byte" by John Keiser and Daniel Lemire. Each
+    error kind that can be detected from two consecutive bytes is assigned a
+    bit. Three tables indexed by the high and low nibbles of the previous byte
+    and the high nibble of the current byte give the set of errors that each
+    nibble is compatible with; an error is present if it's in all three sets.
+    The second and third continuation bytes of 3 and 4-byte sequences are
+    checked separately by looking two and three bytes back.
+*/
+enum {
+    UTF8_TOO_SHORT = 1 << 0,
+    UTF8_TOO_LONG = 1 << 1,
+    UTF8_OVERLONG_3 = 1 << 2,
+    UTF8_TOO_LARGE = 1 << 3,
+    UTF8_SURROGATE = 1 << 4,
+    UTF8_OVERLONG_2 = 1 << 5,
+    UTF8_TOO_LARGE_1000 = 1 << 6,
+    UTF8_OVERLONG_4 = 1 << 6,
+    UTF8_TWO_CONTS = 1 << 7,
+    UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS
+};
+
+// Returns non-zero bytes for each error in the block
+template<class V> SIMDPP_INL
+V i_utf8_check_block(const V& in, const V& prev1, const V& prev2, const V& prev3)
+{
+    const unsigned TS = UTF8_TOO_SHORT, TL = UTF8_TOO_LONG,
+        O3 = UTF8_OVERLONG_3, LG = UTF8_TOO_LARGE, SR = UTF8_SURROGATE,
+        O2 = UTF8_OVERLONG_2, L1 = UTF8_TOO_LARGE_1000, O4 = UTF8_OVERLONG_4,
+        TC = UTF8_TWO_CONTS, CA = UTF8_CARRY;
+
+    V byte1_high_table = make_uint(TL, TL, TL, TL, TL, TL, TL, TL,
+                                   TC, TC, TC, TC,
+                                   TS | O2, TS, TS | O3 | SR, TS | LG | L1 | O4);
+    V byte1_low_table = make_uint(CA | O3 | O2 | O4, CA | O2, CA, CA,
+                                  CA | LG, CA | LG | L1, CA | LG | L1, CA | LG | L1,
+                                  CA | LG | L1, CA | LG | L1, CA | LG | L1, CA | LG | L1,
+                                  CA | LG | L1, CA | LG | L1 | SR, CA | LG | L1, CA | LG | L1);
+    V byte2_high_table = make_uint(TS, TS, TS, TS, TS, TS, TS, TS,
+                                   TL | O2 | TC | O3 | L1 | O4,
+                                   TL | O2 | TC | O3 | LG,
+                                   TL | O2 | TC | SR | LG,
+                                   TL | O2 | TC | SR | LG,
+                                   TS, TS, TS, TS);
+
+    V prev1_high = shift_r<4>(prev1);
+    V prev1_low = bit_and(prev1, 0x0f);
+    V in_high = shift_r<4>(in);
+    V byte1_high = permute_bytes16(byte1_high_table, prev1_high);
+    V byte1_low = permute_bytes16(byte1_low_table, prev1_low);
+    V byte2_high = permute_bytes16(byte2_high_table, in_high);
+    V special = bit_and(bit_and(byte1_high, byte1_low), byte2_high);
+
+    // bit 7 is set in the bytes that must be the second or third continuation
+    // byte of a sequence
+    V is_third = sub_sat(prev2, 0xe0 - 0x80);
+    V is_fourth = sub_sat(prev3, 0xf0 - 0x80);
+    V must23 = bit_and(bit_or(is_third, is_fourth), 0x80);
+    return bit_xor(must23, special);
+}
+
+/*  Checks the block at @a p. The three bytes before @a p must be readable.
+    Blocks for which the bytes from p-3 to the end of the block are ASCII are
+    skipped.
+*/
+template<class V> SIMDPP_INL
+void i_utf8_check_at(V& err, const uint8_t* p)
+{
+    V in = load_u(p);
+    V prev3 = load_u(p - 3);
+    V high = bit_and(bit_or(in, prev3), 0x80);
+    if (!test_bits_any(high))
+        return;
+    V prev1 = load_u(p - 1);
+    V prev2 = load_u(p - 2);
+    err = bit_or(err, i_utf8_check_block(in, prev1, prev2, prev3));
+}
+
+/*  The first block and the remainder are copied to a buffer with three bytes
+    of preceding context. The remainder is padded with zeros which makes
+    sequences truncated at the end of the input invalid. The remainder is
+    checked even if empty, for this reason.
+*/
+static SIMDPP_INL
+bool i_utf8_validate(const char* s, std::size_t n)
+{
+    using V = uint8v;
+    const unsigned W = V::length;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+    uint8_t buf[W + 3];
+    V err = make_zero();
+
+    std::size_t i = 0;
+    if (n >= W) {
+        std::memset(buf, 0, 3);
+        std::memcpy(buf + 3, p, W);
+        i_utf8_check_at(err, buf + 3);
+        i = W;
+    }
+    for (; i + W <= n; i += W) {
+        i_utf8_check_at(err, p + i);
+    }
+    for (unsigned k = 0; k < 3; ++k) {
+        buf[k] = i + k >= 3 ? p[i + k - 3] : 0;
+    }
+    std::memset(buf + 3, 0, W);
+    std::memcpy(buf + 3, p + i, n - i);
+    i_utf8_check_at(err, buf + 3);
+    return !test_bits_any(err);
+}
+#else
+// Validates the sequences one by one, skipping over ASCII blocks
+static SIMDPP_INL
+bool i_utf8_validate(const char* s, std::size_t n)
+{
+    using V = uint8v;
+    const unsigned W = V::length;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+
+    std::size_t i = 0;
+    while (i < n) {
+        if (i + W <= n) {
+            V v = load_u(p + i);
+            V high = bit_and(v, 0x80);
+            if (!test_bits_any(high)) {
+                i += W;
+                continue;
+            }
+        }
+        uint32_t cp;
+        unsigned len = i_utf8_decode(p + i, n - i, cp);
+        if (len == 0)
+            return false;
+        i += len;
+    }
+    return true;
+}
+#endif
+
+/*  Decodes the code points starting within [p + i, p + end), then continues
+    with the sequence that the next byte belongs to. Continuation bytes are
+    skipped: they belong to the sequences that have already been decoded.
+    The input must be valid.
+*/
+template<class C> SIMDPP_INL
+void i_utf8_decode_until(const uint8_t* p, std::size_t n, std::size_t end,
+                         std::size_t& i, C* out, std::size_t& o)
+{
+    while (i < end) {
+        if ((p[i] & 0xc0) == 0x80) {
+            ++i;
+            continue;
+        }
+        uint32_t cp;
+        i += i_utf8_decode(p + i, n - i, cp);
+        o += i_utf_write(out + o, cp);
+    }
+}
+
+/*  The 16 bytes of a chunk are widened to the output element size. If the
+    chunk is not ASCII, the code point starting at each byte is computed from
+    it and the following bytes, the code points starting at continuation
+    bytes are then dropped using compress_store_u. When transcoding to UTF-16,
+    the code points of chunks that contain 4-byte sequences are computed as
+    32-bit values and then written one at a time as they may produce
+    surrogate pairs.
+*/
+static SIMDPP_INL
+uint16<16> i_utf8_decode_chunk3(const uint8_t* p)
+{
+    uint8<16> c0 = load_u(p), c1 = load_u(p + 1), c2 = load_u(p + 2);
+    uint16<16> b0 = to_uint16(c0), t1 = to_uint16(c1), t2 = to_uint16(c2);
+    t1 = bit_and(t1, 0x3f);
+    t2 = bit_and(t2, 0x3f);
+    uint16<16> cp2 = bit_or(shift_l<6>(bit_and(b0, 0x1f)), t1);
+    uint16<16> cp3 = bit_or(shift_l<12>(bit_and(b0, 0x0f)), bit_or(shift_l<6>(t1), t2));
+    int16<16> s0 = int16<16>(b0);
+    uint16<16> cp = blend(cp2, b0, cmp_gt(s0, 0xbf));
+    return blend(cp3, cp, cmp_gt(s0, 0xdf));
+}
+
+static SIMDPP_INL
+uint32<16> i_utf8_decode_chunk4(const uint8_t* p)
+{
+    uint8<16> c0 = load_u(p), c1 = load_u(p + 1), c2 = load_u(p + 2),
+              c3 = load_u(p + 3);
+    uint32<16> b0 = to_uint32(c0), t1 = to_uint32(c1), t2 = to_uint32(c2),
+               t3 = to_uint32(c3);
+    t1 = bit_and(t1, 0x3f);
+    t2 = bit_and(t2, 0x3f);
+    t3 = bit_and(t3, 0x3f);
+    uint32<16> cp2 = bit_or(shift_l<6>(bit_and(b0, 0x1f)), t1);
+    uint32<16> cp3 = bit_or(shift_l<12>(bit_and(b0, 0x0f)), bit_or(shift_l<6>(t1), t2));
+    uint32<16> cp4 = bit_or(bit_or(shift_l<18>(bit_and(b0, 0x07)), shift_l<12>(t1)),
+                            bit_or(shift_l<6>(t2), t3));
+    int32<16> s0 = int32<16>(b0);
+    uint32<16> cp = blend(cp2, b0, cmp_gt(s0, 0xbf));
+    cp = blend(cp3, cp, cmp_gt(s0, 0xdf));
+    return blend(cp4, cp, cmp_gt(s0, 0xef));
+}
+
+static SIMDPP_INL
+std::size_t i_utf8_to_utf16(const char* s, std::size_t n, char16_t* out)
+{
+    if (!i_utf8_validate(s, n))
+        return utf_invalid_result;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+    std::size_t i = 0, o = 0;
+
+    while (i + 16 + 3 <= n) {
+        uint8<16> c0 = load_u(p + i);
+        uint8<16> high = bit_and(c0, 0x80);
+        if (!test_bits_any(high)) {
+            store_u(out + o, to_uint16(c0));
+            i += 16;
+            o += 16;
+            continue;
+        }
+        uint8<16> four = sub_sat(c0, 0xef);
+        if (test_bits_any(four)) {
+            // 4-byte sequences produce surrogate pairs
+            SIMDPP_ALIGN(64) uint32_t cps[16];
+            uint32<16> cp = i_utf8_decode_chunk4(p + i);
+            uint32<16> b0 = to_uint32(c0);
+            mask_int32<16> lead = cmp_neq(bit_and(b0, 0xc0), 0x80);
+            unsigned count = compress_store_u(cps, cp, lead);
+            for (unsigned k = 0; k < count; ++k)
+                o += i_utf_write(out + o, cps[k]);
+            i += 16;
+            continue;
+        }
+        uint16<16> cp = i_utf8_decode_chunk3(p + i);
+        uint16<16> b0 = to_uint16(c0);
+        mask_int16<16> lead = cmp_neq(bit_and(b0, 0xc0), 0x80);
+        o += compress_store_u(out + o, cp, lead);
+        i += 16;
+    }
+    i_utf8_decode_until(p, n, n, i, out, o);
+    return o;
+}
+
+static SIMDPP_INL
+std::size_t i_utf8_to_utf32(const char* s, std::size_t n, char32_t* out)
+{
+    if (!i_utf8_validate(s, n))
+        return utf_invalid_result;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+    std::size_t i = 0, o = 0;
+
+    for (; i + 16 + 3 <= n; i += 16) {
+        uint8<16> c0 = load_u(p + i);
+        uint8<16> high = bit_and(c0, 0x80);
+        if (!test_bits_any(high)) {
+            store_u(out + o, to_uint32(c0));
+            o += 16;
+            continue;
+        }
+        uint32<16> cp = i_utf8_decode_chunk4(p + i);
+        uint32<16> b0 = to_uint32(c0);
+        mask_int32<16> lead = cmp_neq(bit_and(b0, 0xc0), 0x80);
+        o += compress_store_u(out + o, cp, lead);
+    }
+    i_utf8_decode_until(p, n, n, i, out, o);
+    return o;
+}
+
+/*  Encodes 16 code points below 0x800. The first and the second byte of the
+    sequence of each code point are computed separately, interleaved and the
+    second bytes of the ASCII characters are dropped using compress_store_u.
+*/
+template<class U> SIMDPP_INL
+unsigned i_utf8_encode2_chunk(char* out, const U& u)
+{
+    U ascii_hi = shift_r<7>(u);
+    mask_int8<16> ascii = cmp_eq(to_uint8(ascii_hi), 0);
+    uint8<16> lead = bit_or(to_uint8(shift_r<6>(u)), 0xc0);
+    uint8<16> cont = bit_or(bit_and(to_uint8(u), 0x3f), 0x80);
+    lead = blend(to_uint8(u), lead, ascii);
+
+    uint8<16> keep2 = bit_not(uint8<16>(ascii));
+    uint8<16> ones = make_ones();
+    uint8<16> d0 = zip16_lo(lead, cont), d1 = zip16_hi(lead, cont);
+    uint8<16> k0 = zip16_lo(ones, keep2), k1 = zip16_hi(ones, keep2);
+    unsigned o = compress_store_u(out, d0, cmp_neq(k0, 0));
+    return o + compress_store_u(out + o, d1, cmp_neq(k1, 0));
+}
+
+/*  Encodes 16 code points below 0x10000 that are not surrogates. The three
+    bytes of the sequence of each code point are computed as if it was
+    encoded as 3 bytes, except for the bytes that are different in the
+    shorter sequences. The bytes are interleaved into groups of four and the
+    unused ones are dropped using compress_store_u.
+*/
+template<class U> SIMDPP_INL
+unsigned i_utf8_encode3_chunk(char* out, const U& u)
+{
+    U is_len1 = U(cmp_eq(shift_r<7>(u), 0));
+    U is_len3 = U(cmp_neq(shift_r<11>(u), 0));
+    uint8<16> len1 = to_uint8(is_len1), len3 = to_uint8(is_len3);
+    uint8<16> lo = bit_or(bit_and(to_uint8(u), 0x3f), 0x80);
+    uint8<16> mid = bit_or(bit_and(to_uint8(shift_r<6>(u)), 0x3f), 0x80);
+    uint8<16> lead3 = bit_or(to_uint8(shift_r<12>(u)), 0xe0);
+    uint8<16> lead2 = bit_or(to_uint8(shift_r<6>(u)), 0xc0);
+
+    uint8<16> b0 = blend(lead3, blend(to_uint8(u), lead2, len1), len3);
+    uint8<16> b1 = blend(mid, lo, len3);
+    uint8<16> b2 = lo;
+    uint8<16> zero = make_zero();
+    uint8<16> ones = make_ones();
+    uint8<16> k1 = bit_not(len1);
+
+    using U16 = uint16<8>;
+    U16 d01_lo = U16(zip16_lo(b0, b1)), d01_hi = U16(zip16_hi(b0, b1));
+    U16 d2_lo = U16(zip16_lo(b2, zero)), d2_hi = U16(zip16_hi(b2, zero));
+    U16 k01_lo = U16(zip16_lo(ones, k1)), k01_hi = U16(zip16_hi(ones, k1));
+    U16 k2_lo = U16(zip16_lo(len3, zero)), k2_hi = U16(zip16_hi(len3, zero));
+
+    uint8<16> d[4] = { uint8<16>(zip8_lo(d01_lo, d2_lo)), uint8<16>(zip8_hi(d01_lo, d2_lo)),
+                       uint8<16>(zip8_lo(d01_hi, d2_hi)), uint8<16>(zip8_hi(d01_hi, d2_hi)) };
+    uint8<16> k[4] = { uint8<16>(zip8_lo(k01_lo, k2_lo)), uint8<16>(zip8_hi(k01_lo, k2_lo)),
+                       uint8<16>(zip8_lo(k01_hi, k2_hi)), uint8<16>(zip8_hi(k01_hi, k2_hi)) };
+    unsigned o = 0;
+    for (unsigned j = 0; j < 4; ++j)
+        o += compress_store_u(out + o, d[j], cmp_neq(k[j], 0));
+    return o;
+}
+
+/*  Converts UTF-16 or UTF-32 to UTF-8. ASCII chunks of 16 code units are
+    narrowed, chunks of code points below 0x800 are encoded by
+    i_utf8_encode2_chunk and chunks of code points below 0x10000 that don't
+    contain surrogates by i_utf8_encode3_chunk. Others are encoded one code
+    point at a time.
+*/
+template<class U, class C> SIMDPP_INL
+std::size_t i_utf_to_utf8(const C* s, std::size_t n, char* out)
+{
+    std::size_t i = 0, o = 0;
+    for (;;) {
+        if (i + 16 <= n) {
+            U u = load_u(s + i);
+            U not_ascii = shift_r<7>(u);
+            if (!test_bits_any(not_ascii)) {
+                store_u(out + o, to_uint8(u));
+                i += 16;
+                o += 16;
+                continue;
+            }
+            U not_2byte = shift_r<11>(u);
+            if (!test_bits_any(not_2byte)) {
+                o += i_utf8_encode2_chunk(out + o, u);
+                i += 16;
+                continue;
+            }
+            U surrogate = U(cmp_eq(not_2byte, 0x1b));
+            U not_bmp = shift_r<5>(not_2byte);
+            U not_3byte = bit_or(surrogate, not_bmp);
+            if (!test_bits_any(not_3byte)) {
+                o += i_utf8_encode3_chunk(out + o, u);
+                i += 16;
+                continue;
+            }
+        }
+        std::size_t end = i + 16 < n ? i + 16 : n;
+        if (i == end)
+            return o;
+        while (i < end) {
+            uint32_t cp;
+            unsigned len = i_utf_read(s + i, n - i, cp);
+            if (len == 0)
+                return utf_invalid_result;
+            i += len;
+            o += i_utf8_encode(out + o, cp);
+        }
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
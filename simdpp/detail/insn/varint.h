@@ -0,0 +1,532 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_VARINT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_VARINT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/align.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/core/to_int8.h>
+#include <simdpp/core/to_int32.h>
+#include <simdpp/core/to_int64.h>
+#include <simdpp/detail/insn/compress.h>
+#include <simdpp/detail/insn/scan.h>
+#include <simdpp/detail/insn/varint_tables.h>
+
+// The vector implementation needs permute_zbytes16, which is not available on
+// SSE2, and assumes little-endian layout of the elements within the vectors
+#if (SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || \
+     SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA) && !SIMDPP_BIG_ENDIAN
+#define SIMDPP_DETAIL_VARINT_USE_VECTOR 1
+#else
+#define SIMDPP_DETAIL_VARINT_USE_VECTOR 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+static const std::size_t varint_invalid_result = ~std::size_t(0);
+
+// -----------------------------------------------------------------------------
+// Transformations of the values. The scalar encode() and decode() update the
+// state. The vector variants don't, they must be followed by advance() with
+// the last original value of the vector.
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_zigzag_encode(const uint32<N>& a)
+{
+    return bit_xor(shift_l<1>(a), uint32<N>(shift_r<31>(int32<N>(a))));
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_zigzag_encode(const uint64<N>& a)
+{
+    return bit_xor(shift_l<1>(a), uint64<N>(shift_r<63>(int64<N>(a))));
+}
+
+template<class V> SIMDPP_INL
+V i_zigzag_decode(const V& a)
+{
+    V sign = sub(V(make_zero()), V(bit_and(a, V(splat(1)))));
+    return bit_xor(shift_r<1>(a), sign);
+}
+
+// Returns [x, a0, a1, ...]
+static SIMDPP_INL
+uint32<4> i_varint_shift_in(const uint32<4>& a, uint32_t x)
+{
+    return align4<3>(uint32<4>(splat(x)), a);
+}
+
+static SIMDPP_INL
+uint64<2> i_varint_shift_in(const uint64<2>& a, uint64_t x)
+{
+    return align2<1>(uint64<2>(splat(x)), a);
+}
+
+template<class T>
+struct i_varint_plain {
+    SIMDPP_INL explicit i_varint_plain(T) {}
+
+    SIMDPP_INL T encode(T x) { return x; }
+    SIMDPP_INL T decode(T x) { return x; }
+    template<class V> SIMDPP_INL V encode(const V& a) const { return a; }
+    template<class V> SIMDPP_INL V decode(const V& a) const { return a; }
+    SIMDPP_INL void advance(T) {}
+};
+
+template<class T>
+struct i_varint_zigzag {
+    SIMDPP_INL explicit i_varint_zigzag(T) {}
+
+    SIMDPP_INL T encode(T x) { return T(x << 1) ^ T(T(0) - (x >> (sizeof(T) * 8 - 1))); }
+    SIMDPP_INL T decode(T x) { return T(x >> 1) ^ T(T(0) - (x & 1)); }
+    template<class V> SIMDPP_INL V encode(const V& a) const { return i_zigzag_encode(a); }
+    template<class V> SIMDPP_INL V decode(const V& a) const { return i_zigzag_decode(a); }
+    SIMDPP_INL void advance(T) {}
+};
+
+template<class T>
+struct i_varint_delta {
+    T prev;
+
+    SIMDPP_INL explicit i_varint_delta(T init) : prev(init) {}
+
+    SIMDPP_INL T encode(T x) { T d = x - prev; prev = x; return d; }
+    SIMDPP_INL T decode(T d) { prev += d; return prev; }
+
+    template<class V> SIMDPP_INL V encode(const V& a) const
+    {
+        return sub(a, i_varint_shift_in(a, prev));
+    }
+
+    template<class V> SIMDPP_INL V decode(const V& a) const
+    {
+        return add(i_scan<scan_op_add>(a), V(splat(prev)));
+    }
+
+    SIMDPP_INL void advance(T last) { prev = last; }
+};
+
+// -----------------------------------------------------------------------------
+// Common helpers
+
+// Moves bit i of a 4-bit number to bit 2*i
+static SIMDPP_INL unsigned i_varint_spread4(uint64_t b)
+{
+    unsigned r = unsigned(b);
+    r = (r | (r << 2)) & 0x33;
+    return (r | (r << 1)) & 0x55;
+}
+
+/*  Computes the Stream VByte control byte of four values. The length minus one
+    of the value i is stored in the bits 2*i and 2*i+1. It is the number of
+    thresholds the value exceeds.
+*/
+static SIMDPP_INL
+unsigned i_varint_control(const mask_int32<4>& m1, const mask_int32<4>& m2,
+                          const mask_int32<4>& m3)
+{
+    return i_varint_spread4(i_mask_bits(m1)) + i_varint_spread4(i_mask_bits(m2)) +
+           i_varint_spread4(i_mask_bits(m3));
+}
+
+// -----------------------------------------------------------------------------
+// Stream VByte
+
+/*  The values are stored as 1 to 4 little-endian bytes. The lengths of each
+    group of four values are stored in a control byte. The control bytes of
+    all groups precede the data bytes. The vector implementation shuffles the
+    bytes of each group using tables indexed by the control byte.
+*/
+
+static SIMDPP_INL unsigned i_streamvbyte_code(uint32_t x)
+{
+    return (x > 0xff) + (x > 0xffff) + (x > 0xffffff);
+}
+
+#if SIMDPP_DETAIL_VARINT_USE_VECTOR
+static SIMDPP_INL
+void i_streamvbyte_load_lanes(uint8<16>& d, uint8<16>& idx,
+                              const uint8_t*& ctrl, const uint8_t*& data)
+{
+    unsigned c = *ctrl++;
+    d = load_u(data);
+    idx = load_u(i_streamvbyte_decode_table() + c * 16);
+    data += i_streamvbyte_length_table()[c];
+}
+
+template<unsigned N> SIMDPP_INL
+void i_streamvbyte_load_lanes(uint8<N>& d, uint8<N>& idx,
+                              const uint8_t*& ctrl, const uint8_t*& data)
+{
+    uint8<N/2> d_lo, d_hi, idx_lo, idx_hi;
+    i_streamvbyte_load_lanes(d_lo, idx_lo, ctrl, data);
+    i_streamvbyte_load_lanes(d_hi, idx_hi, ctrl, data);
+    d = combine(d_lo, d_hi);
+    idx = combine(idx_lo, idx_hi);
+}
+
+/*  Decodes N/16 groups per iteration. Each group needs a 16-byte load, thus
+    the loop stops when less than N bytes of data are left.
+*/
+template<unsigned N, class Tr> SIMDPP_INL
+void i_streamvbyte_decode_vec(const uint8_t*& ctrl, const uint8_t*& data,
+                              const uint8_t* end, uint32_t* out,
+                              std::size_t& i, std::size_t n, Tr& tr)
+{
+    const unsigned L = N / 16;
+    for (; i + 4 * L <= n && std::size_t(end - data) >= N; i += 4 * L) {
+        uint8<N> d, idx;
+        i_streamvbyte_load_lanes(d, idx, ctrl, data);
+        uint32<N/4> r = uint32<N/4>(permute_zbytes16(d, idx));
+        store_u(out + i, tr.decode(r));
+        tr.advance(out[i + 4 * L - 1]);
+    }
+}
+#endif
+
+template<class Tr> SIMDPP_INL
+std::size_t i_streamvbyte_encode(const uint32_t* in, std::size_t n, uint8_t* out, Tr tr)
+{
+    uint8_t* ctrl = out;
+    uint8_t* data = out + (n + 3) / 4;
+    std::size_t i = 0;
+#if SIMDPP_DETAIL_VARINT_USE_VECTOR
+    // Each group writes 16 bytes of which at most 4 per value are used. This
+    // fits into the space reserved for the data of the remaining values.
+    for (; i + 4 <= n; i += 4) {
+        uint32<4> a = load_u(in + i);
+        a = tr.encode(a);
+        tr.advance(in[i + 3]);
+
+        unsigned c = i_varint_control(cmp_gt(a, uint32<4>(splat(0xff))),
+                                      cmp_gt(a, uint32<4>(splat(0xffff))),
+                                      cmp_gt(a, uint32<4>(splat(0xffffff))));
+        uint8<16> idx = load_u(i_streamvbyte_encode_table() + c * 16);
+        store_u(data, permute_zbytes16(uint8<16>(a), idx));
+        *ctrl++ = uint8_t(c);
+        data += i_streamvbyte_length_table()[c];
+    }
+#endif
+    for (; i < n; i += 4) {
+        unsigned c = 0;
+        for (unsigned k = 0; k < 4 && i + k < n; ++k) {
+            uint32_t x = tr.encode(in[i + k]);
+            unsigned code = i_streamvbyte_code(x);
+            for (unsigned b = 0; b <= code; ++b)
+                *data++ = uint8_t(x >> (8 * b));
+            c |= code << (2 * k);
+        }
+        *ctrl++ = uint8_t(c);
+    }
+    return data - out;
+}
+
+template<class Tr> SIMDPP_INL
+std::size_t i_streamvbyte_decode(const uint8_t* in, std::size_t size,
+                                 uint32_t* out, std::size_t n, Tr tr)
+{
+    std::size_t ctrl_size = (n + 3) / 4;
+    if (ctrl_size > size)
+        return varint_invalid_result;
+
+    const uint8_t* ctrl = in;
+    const uint8_t* data = in + ctrl_size;
+    const uint8_t* end = in + size;
+    std::size_t i = 0;
+#if SIMDPP_DETAIL_VARINT_USE_VECTOR
+    i_streamvbyte_decode_vec<SIMDPP_FAST_INT8_SIZE>(ctrl, data, end, out, i, n, tr);
+    i_streamvbyte_decode_vec<16>(ctrl, data, end, out, i, n, tr);
+#endif
+    for (; i < n; i += 4) {
+        unsigned c = *ctrl++;
+        for (unsigned k = 0; k < 4 && i + k < n; ++k) {
+            unsigned len = ((c >> (2 * k)) & 3) + 1;
+            if (std::size_t(end - data) < len)
+                return varint_invalid_result;
+            uint32_t x = 0;
+            for (unsigned b = 0; b < len; ++b)
+                x |= uint32_t(data[b]) << (8 * b);
+            data += len;
+            out[i + k] = tr.decode(x);
+        }
+    }
+    return data - in;
+}
+
+// -----------------------------------------------------------------------------
+// Varint
+
+/*  The values are stored as LEB128 varints, as in Protocol Buffers: 7 bits per
+    byte starting from the least significant bits. The most significant bit of
+    each byte is set if more bytes follow.
+*/
+
+template<class T> SIMDPP_INL
+std::size_t i_varint_write(uint8_t* out, T x)
+{
+    std::size_t k = 0;
+    while (x >= 0x80) {
+        out[k++] = uint8_t(x) | 0x80;
+        x >>= 7;
+    }
+    out[k++] = uint8_t(x);
+    return k;
+}
+
+/*  Reads a single varint from at most @a n bytes. Returns the number of
+    consumed bytes or zero if the varint is not complete, is longer than the
+    maximum length for T or its value does not fit into T.
+*/
+template<class T> SIMDPP_INL
+std::size_t i_varint_read(const uint8_t* p, std::size_t n, T& r)
+{
+    const unsigned bits = sizeof(T) * 8;
+    const unsigned max_len = (bits + 6) / 7;
+    T x = 0;
+    for (unsigned k = 0; k < max_len && k < n; ++k) {
+        uint8_t b = p[k];
+        x |= T(b & 0x7f) << (7 * k);
+        if ((b & 0x80) == 0) {
+            if (k == max_len - 1 && (b >> (bits - 7 * k)) != 0)
+                return 0;
+            r = x;
+            return k + 1;
+        }
+    }
+    return 0;
+}
+
+#if SIMDPP_DETAIL_VARINT_USE_VECTOR
+/*  Encodes four values of at most 28 bits: the groups of 7 bits are moved to
+    separate bytes of the 32-bit elements, the continuation bits are set and
+    the used bytes are packed using the Stream VByte encoding table. Writes 16
+    bytes and returns the number of used ones.
+*/
+static SIMDPP_INL
+std::size_t i_varint_encode_vec(uint8_t* out, const uint32<4>& a)
+{
+    using U = uint32<4>;
+    U x = bit_or(bit_or(bit_and(a, U(splat(0x7f))),
+                        bit_and(shift_l<1>(a), U(splat(0x7f00)))),
+                 bit_or(bit_and(shift_l<2>(a), U(splat(0x7f0000))),
+                        bit_and(shift_l<3>(a), U(splat(0x7f000000)))));
+
+    mask_int32<4> m1 = cmp_gt(a, U(splat(0x7f)));
+    mask_int32<4> m2 = cmp_gt(a, U(splat(0x3fff)));
+    mask_int32<4> m3 = cmp_gt(a, U(splat(0x1fffff)));
+    x = bit_or(x, bit_or(bit_and(U(splat(0x80)), m1),
+                         bit_or(bit_and(U(splat(0x8000)), m2),
+                                bit_and(U(splat(0x800000)), m3))));
+
+    unsigned c = i_varint_control(m1, m2, m3);
+    uint8<16> idx = load_u(i_streamvbyte_encode_table() + c * 16);
+    store_u(out, permute_zbytes16(uint8<16>(x), idx));
+    return i_streamvbyte_length_table()[c];
+}
+
+/*  Loads and transforms four values. Returns true and the values in @a r if
+    all of them fit into 28 bits, otherwise stores them to @a buf.
+*/
+template<class Tr> SIMDPP_INL
+bool i_varint_load4(const uint32_t* p, Tr& tr, uint32<4>& r, uint32_t* buf)
+{
+    uint32<4> a = load_u(p);
+    a = tr.encode(a);
+    tr.advance(p[3]);
+    if (test_bits_any(bit_and(a, uint32<4>(splat(0xf0000000))))) {
+        store_u(buf, a);
+        return false;
+    }
+    r = a;
+    return true;
+}
+
+template<class Tr> SIMDPP_INL
+bool i_varint_load4(const uint64_t* p, Tr& tr, uint32<4>& r, uint64_t* buf)
+{
+    uint64<2> a0 = load_u(p);
+    uint64<2> a1 = load_u(p + 2);
+    a0 = tr.encode(a0);
+    tr.advance(p[1]);
+    a1 = tr.encode(a1);
+    tr.advance(p[3]);
+    uint64<2> hi_bits = splat(0xfffffffff0000000);
+    if (test_bits_any(bit_and(bit_or(a0, a1), hi_bits))) {
+        store_u(buf, a0);
+        store_u(buf + 2, a1);
+        return false;
+    }
+    r = to_uint32(combine(a0, a1));
+    return true;
+}
+
+template<class Tr, unsigned N> SIMDPP_INL
+void i_varint_store(uint32_t* out, Tr& tr, const uint32<N>& a)
+{
+    store_u(out, tr.decode(a));
+}
+
+template<class Tr, unsigned N> SIMDPP_INL
+void i_varint_store(uint64_t* out, Tr& tr, const uint32<N>& a)
+{
+    uint64<N> r = to_uint64(a);
+    store_u(out, tr.decode(r));
+}
+#endif
+
+template<class T, class Tr> SIMDPP_INL
+std::size_t i_varint_encode(const T* in, std::size_t n, uint8_t* out, Tr tr)
+{
+    std::size_t i = 0, o = 0;
+#if SIMDPP_DETAIL_VARINT_USE_VECTOR
+    // Each group writes 16 bytes, which fits into the space reserved for the
+    // remaining values. Sixteen values that are all a single byte long are
+    // narrowed and stored at once.
+    for (; i + 16 <= n; i += 16) {
+        uint32<4> a[4];
+        T buf[16];
+        unsigned vec = 0;
+        for (unsigned k = 0; k < 4; ++k)
+            vec |= unsigned(i_varint_load4(in + i + 4 * k, tr, a[k], buf + 4 * k)) << k;
+
+        if (vec == 0xf) {
+            uint32<16> all = combine(combine(a[0], a[1]), combine(a[2], a[3]));
+            if (!test_bits_any(bit_and(all, uint32<16>(splat(0xffffff80))))) {
+                store_u(out + o, to_uint8(all));
+                o += 16;
+                continue;
+            }
+        }
+        for (unsigned k = 0; k < 4; ++k) {
+            if (vec & (1 << k)) {
+                o += i_varint_encode_vec(out + o, a[k]);
+            } else {
+                for (unsigned j = 0; j < 4; ++j)
+                    o += i_varint_write(out + o, buf[4 * k + j]);
+            }
+        }
+    }
+    for (; i + 4 <= n; i += 4) {
+        uint32<4> a;
+        T buf[4];
+        if (i_varint_load4(in + i, tr, a, buf)) {
+            o += i_varint_encode_vec(out + o, a);
+        } else {
+            for (unsigned k = 0; k < 4; ++k)
+                o += i_varint_write(out + o, buf[k]);
+        }
+    }
+#endif
+    for (; i < n; ++i)
+        o += i_varint_write(out + o, tr.encode(in[i]));
+    return o;
+}
+
+/*  The vector implementation decodes 16 bytes of values that are a single byte
+    long at once. Otherwise the leading varints within the first 8 bytes are
+    decoded using the tables described in i_varint_decode_info_table(). The
+    bytes of each varint are moved into separate 16-bit or 32-bit elements and
+    the groups of 7 bits are merged using shifts.
+
+    As each value takes at least one byte, the output can hold at least 16
+    values while at least 16 bytes of input are left.
+*/
+template<class T, class Tr> SIMDPP_INL
+std::size_t i_varint_decode(const uint8_t* in, std::size_t size, T* out, Tr tr)
+{
+    std::size_t i = 0, o = 0;
+#if SIMDPP_DETAIL_VARINT_USE_VECTOR
+    while (size - i >= 16) {
+        uint8<16> a = load_u(in + i);
+        unsigned m = extract_bits<7>(a);
+        if (m == 0) {
+            uint32<16> r = to_uint32(a);
+            i_varint_store(out + o, tr, r);
+            i += 16;
+            o += 16;
+            tr.advance(out[o - 1]);
+            continue;
+        }
+
+        const uint8_t* info = i_varint_decode_info_table() + (m & 0xff) * 2;
+        unsigned count = info[0] & 0x7f;
+        if (count == 0) {
+            T x;
+            std::size_t len = i_varint_read(in + i, size - i, x);
+            if (len == 0)
+                return varint_invalid_result;
+            out[o++] = tr.decode(x);
+            i += len;
+            continue;
+        }
+
+        uint8<16> idx = load_u(i_varint_decode_table() + (m & 0xff) * 16);
+        uint8<16> b = permute_zbytes16(a, idx);
+        if (info[0] & 0x80) {
+            using U = uint32<4>;
+            U x = U(b);
+            x = bit_or(bit_or(bit_and(x, U(splat(0x7f))),
+                              bit_and(shift_r<1>(x), U(splat(0x3f80)))),
+                       bit_or(bit_and(shift_r<2>(x), U(splat(0x1fc000))),
+                              bit_and(shift_r<3>(x), U(splat(0xfe00000)))));
+            i_varint_store(out + o, tr, x);
+        } else {
+            using U = uint16<8>;
+            U x = U(b);
+            x = bit_or(bit_and(x, U(splat(0x7f))),
+                       bit_and(shift_r<1>(x), U(splat(0x3f80))));
+            uint32<8> r = to_uint32(x);
+            i_varint_store(out + o, tr, r);
+        }
+        i += info[1];
+        o += count;
+        tr.advance(out[o - 1]);
+    }
+#endif
+    while (i < size) {
+        T x;
+        std::size_t len = i_varint_read(in + i, size - i, x);
+        if (len == 0)
+            return varint_invalid_result;
+        out[o++] = tr.decode(x);
+        i += len;
+    }
+    return o;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,165 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_COMMON_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_COMMON_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <cstdint>
+#include <simdpp/simd.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Computes a * b + c. The fused instruction is used only when it is native,
+    since the emulated version would be much slower than separate operations.
+    The results may thus differ in the last bit between instruction sets.
+*/
+template<class V> SIMDPP_INL
+V m_fma(const V& a, const V& b, const V& c)
+{
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+template<class V, class T> SIMDPP_INL
+V m_fma(const V& a, const V& b, T c)
+{
+    return m_fma(a, b, V(splat(c)));
+}
+
+template<class V, class T> SIMDPP_INL
+V m_fma(const V& a, T b, const V& c)
+{
+    return m_fma(a, V(splat(b)), c);
+}
+
+/*  Evaluates the polynomial with coefficients @a c at @a x using Horner's
+    scheme. The coefficient of the highest degree comes first.
+*/
+template<class V, class T, unsigned K> SIMDPP_INL
+V m_poly(const V& x, const T (&c)[K])
+{
+    V r = splat(c[0]);
+    for (unsigned i = 1; i < K; ++i) {
+        r = m_fma(r, x, c[i]);
+    }
+    return r;
+}
+
+/*  Rounds @a x to the nearest integer by adding and subtracting a magic
+    number. Valid for |x| < 2^22 (float32) or |x| < 2^51 (float64). The
+    magic sum is returned in @a t: the low bits of its representation contain
+    the integer in two's complement form.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> m_round_magic(const float32<N>& x, float32<N>& t)
+{
+    float32<N> magic = splat(12582912.0f); // 1.5 * 2^23
+    t = add(x, magic);
+    return sub(t, magic);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> m_round_magic(const float64<N>& x, float64<N>& t)
+{
+    float64<N> magic = splat(6755399441055744.0); // 1.5 * 2^52
+    t = add(x, magic);
+    return sub(t, magic);
+}
+
+template<class V> SIMDPP_INL
+V m_round_magic(const V& x)
+{
+    V t;
+    return m_round_magic(x, t);
+}
+
+/*  Computes 2^n for a magic sum @a t as produced by m_round_magic. The
+    integer n must be within the normal exponent range of the type.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> m_pow2_magic(const float32<N>& t)
+{
+    // the magic number has zeros in the bits that end up in the exponent
+    uint32<N> e = add(bit_cast<uint32<N>>(t), 127);
+    return bit_cast<float32<N>>(shift_l<23>(e));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> m_pow2_magic(const float64<N>& t)
+{
+    uint64<N> e = add(bit_cast<uint64<N>>(t), 1023);
+    return bit_cast<float64<N>>(shift_l<52>(e));
+}
+
+/*  Computes x * 2^n for integral @a n. The scaling is done in two steps so
+    that the result may overflow to infinity or underflow to a subnormal
+    number as long as both halves of n are within the normal exponent range.
+*/
+template<class V> SIMDPP_INL
+V m_ldexp(const V& x, const V& n)
+{
+    V t1, t2;
+    V h = mul(n, 0.5);
+    V n1 = m_round_magic(h, t1);
+    V n2 = sub(n, n1);
+    m_round_magic(n2, t2);
+    V r = mul(x, m_pow2_magic(t1));
+    return mul(r, m_pow2_magic(t2));
+}
+
+/*  Splits a positive normal number into a mantissa @a m in range [0.5, 1) and
+    an exponent. Returns the exponent as a floating-point number.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> m_frexp(const float32<N>& x, float32<N>& m)
+{
+    uint32<N> bits = bit_cast<uint32<N>>(x);
+    uint32<N> mbits = bit_or(bit_and(bits, 0x007fffff), 0x3f000000);
+    m = bit_cast<float32<N>>(mbits);
+
+    // the biased exponent is placed into the mantissa of 2^23
+    uint32<N> ebits = bit_or(shift_r<23>(bits), 0x4b000000);
+    float32<N> e = bit_cast<float32<N>>(ebits);
+    return sub(e, 8388608.0f + 126.0f);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> m_frexp(const float64<N>& x, float64<N>& m)
+{
+    uint64<N> bits = bit_cast<uint64<N>>(x);
+    uint64<N> mbits = bit_or(bit_and(bits, uint64_t(0x000fffffffffffff)),
+                             uint64_t(0x3fe0000000000000));
+    m = bit_cast<float64<N>>(mbits);
+
+    uint64<N> ebits = bit_or(shift_r<52>(bits), uint64_t(0x4330000000000000));
+    float64<N> e = bit_cast<float64<N>>(ebits);
+    return sub(e, 4503599627370496.0 + 1022.0);
+}
+
+// Returns @a a with the sign of @a s.
+template<class V> SIMDPP_INL
+V m_copysign(const V& a, const V& s)
+{
+    return bit_or(abs(a), sign(s));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
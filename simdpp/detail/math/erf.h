@@ -0,0 +1,126 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_ERF_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_ERF_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/detail/math/common.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  For |x| < 1 erf(x) is approximated by x + x * P(x^2). Otherwise
+    erf(|x|) = 1 - exp(-x^2) * Q(|x| - c) and the sign is restored. |x| is
+    clamped to the value above which the result rounds to 1.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_erf(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        -5.631422391e-04f, 4.917551298e-03f, -2.671131119e-02f,
+        1.128017977e-01f, -3.761232495e-01f, 1.28379107e-01f
+    };
+    static const float Q[] = {
+        -3.937903093e-04f, -7.566139684e-04f, -1.891680877e-03f,
+        2.170931315e-03f, -8.016665466e-03f, 2.575803921e-02f,
+        -7.556949556e-02f, 2.126800716e-01f
+    };
+
+    V ax = abs(a);
+    V z = mul(a, a);
+    V rs = m_fma(a, m_poly(z, P), a);
+
+    V x = min(ax, 3.95f);
+    V nz = mul(x, x);
+    nz = neg(nz);
+    V rl = mul(i_exp(nz), m_poly(V(sub(x, 2.475f)), Q));
+    rl = sub(1.0f, rl);
+    rl = bit_or(rl, sign(a));
+
+    V r = blend(rs, rl, cmp_lt(ax, 1.0f));
+    return blend(a, r, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_erf(const float64<N>& a)
+{
+    using V = float64<N>;
+    static const double P[] = {
+        -7.77946844123455000e-10, 1.37109803702622381e-08,
+        -1.62063137514715539e-07, 1.64471315702676696e-06,
+        -1.49247123019185522e-05, 1.20552935768952676e-04,
+        -8.54832592931428488e-04, 5.22397760611846822e-03,
+        -2.68661706431114651e-02, 1.12837916709441849e-01,
+        -3.76126389031835207e-01, 1.2837916709551256e-01
+    };
+    static const double Q[] = {
+        1.18694462271079829e-12, 1.90704498367456728e-11,
+        1.39844373996543196e-10, 5.73185330203899652e-10,
+        1.34464675397827997e-09, 1.16409651796136825e-09,
+        -2.29564729107930542e-09, -1.03486140472125841e-08,
+        -8.14793226938971109e-09, -2.09026816664711882e-08,
+        1.07240684160380175e-07, -4.03301218031857746e-07,
+        1.93731607684310604e-06, -8.62159988020263670e-06,
+        3.76476760353520209e-05, -1.61008545427179605e-04,
+        6.72464320811961419e-04, -2.73932557999513040e-03,
+        1.08640859622789361e-02, -4.18616876104695862e-02,
+        1.56333450284567882e-01
+    };
+
+    V ax = abs(a);
+    V z = mul(a, a);
+    V rs = m_fma(a, m_poly(z, P), a);
+
+    V x = min(ax, 5.95);
+    V nz = mul(x, x);
+    nz = neg(nz);
+    V rl = mul(i_exp(nz), m_poly(V(sub(x, 3.475)), Q));
+    rl = sub(1.0, rl);
+    rl = bit_or(rl, sign(a));
+
+    V r = blend(rs, rl, cmp_lt(ax, 1.0));
+    return blend(a, r, isnan(a));
+}
+
+/*  Computes erf(x) as x * P(x^2) / Q(x^2) with x clamped to [-4, 4]. The
+    maximum absolute error is 5e-7.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_erf_fast(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        -2.72614225801306e-10f, 2.77068142495902e-08f, -2.10102402082508e-06f,
+        -5.69250639462346e-05f, -7.34990630326855e-04f, -2.95459980854025e-03f,
+        -1.60960333262415e-02f
+    };
+    static const float Q[] = {
+        -1.45660718464996e-05f, -2.13374055278905e-04f, -1.68282697438203e-03f,
+        -7.37332916720468e-03f, -1.42647390514189e-02f
+    };
+
+    V x = max(a, -4.0f);
+    x = min(x, 4.0f);
+    V z = mul(x, x);
+    V p = mul(x, m_poly(z, P));
+    return div(p, m_poly(z, Q));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,101 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_EXP_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_EXP_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  exp(x) = 2^n * exp(r), where n = round(x / ln2) and r = x - n * ln2 is in
+    range [-ln2/2, ln2/2]. ln2 is split into two parts so that n * ln2_hi is
+    exact. exp(r) is approximated by 1 + r + r^2 * P(r).
+
+    The argument is clamped so that n stays within the range supported by
+    m_ldexp. Outside this range the result is zero or infinity anyway.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        1.9875691500E-4f, 1.3981999507E-3f, 8.3334519073E-3f,
+        4.1665795894E-2f, 1.6666665459E-1f, 5.0000001201E-1f
+    };
+
+    V x = min(max(a, -104.0f), 89.0f);
+    V t = mul(x, 1.44269504088896341f);
+    V n = m_round_magic(t);
+    V r = m_fma(n, -0.693359375f, x);
+    r = m_fma(n, 2.12194440e-4f, r);
+
+    V r2 = mul(r, r);
+    V y = m_fma(m_poly(r, P), r2, r);
+    y = add(y, 1.0f);
+    y = m_ldexp(y, n);
+    return blend(a, y, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp(const float64<N>& a)
+{
+    using V = float64<N>;
+    static const double P[] = {
+        2.49997607969689807e-08, 2.76306518635385022e-07,
+        2.75575893873162075e-06, 2.48014920557022226e-05,
+        1.98412695009315233e-04, 1.38888889445397271e-03,
+        8.33333333349808511e-03, 4.16666666665271371e-02,
+        1.66666666666664048e-01, 5.00000000000001110e-01
+    };
+
+    V x = min(max(a, -746.0), 710.0);
+    V t = mul(x, 1.44269504088896340736);
+    V n = m_round_magic(t);
+    V r = m_fma(n, -6.93145751953125E-1, x);
+    r = m_fma(n, -1.42860682030941723212E-6, r);
+
+    V r2 = mul(r, r);
+    V y = m_fma(m_poly(r, P), r2, r);
+    y = add(y, 1.0);
+    y = m_ldexp(y, n);
+    return blend(a, y, isnan(a));
+}
+
+/*  Same as above, but with less accurate reduction and a shorter polynomial
+    that approximates the whole of exp(r). The maximum relative error is 1e-5.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp_fast(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        4.145740718e-02f, 1.679162085e-01f, 5.000441074e-01f,
+        9.999629855e-01f, 9.999992251e-01f
+    };
+
+    V x = min(max(a, -104.0f), 89.0f);
+    V t = mul(x, 1.44269504088896341f);
+    V n = m_round_magic(t);
+    V r = m_fma(n, -0.693147180559945309f, x);
+    V y = m_ldexp(m_poly(r, P), n);
+    return blend(a, y, isnan(a));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
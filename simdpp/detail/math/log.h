@@ -0,0 +1,139 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_LOG_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_LOG_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <limits>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Sets the result for the special arguments: NaN for negative @a a, -inf
+    for zero and @a a itself for +inf and NaN.
+*/
+template<class V> SIMDPP_INL
+V m_log_special(const V& a, const V& r)
+{
+    using T = typename V::element_type;
+    V res = blend(V(splat(std::numeric_limits<T>::quiet_NaN())), r,
+                  cmp_lt(a, T(0)));
+    res = blend(V(splat(-std::numeric_limits<T>::infinity())), res,
+                cmp_eq(a, T(0)));
+    res = blend(a, res, bit_not(cmp_lt(a, std::numeric_limits<T>::infinity())));
+    return res;
+}
+
+/*  log(x) = e * ln2 + log(m), where m is in range [sqrt(0.5), sqrt(2)).
+    log(1 + f) is approximated by f - f^2/2 + f^3 * P(f) where f = m - 1.
+    Subnormal arguments are scaled to the normal range first.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_log(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        7.0376836292E-2f, -1.1514610310E-1f, 1.1676998740E-1f,
+        -1.2420140846E-1f, 1.4249322787E-1f, -1.6668057665E-1f,
+        2.0000714765E-1f, -2.4999993993E-1f, 3.3333331174E-1f
+    };
+
+    mask_float32<N> subnormal = cmp_lt(a, 1.17549435e-38f);
+    V x = blend(mul(a, 8388608.0f), a, subnormal);
+    V m;
+    V e = m_frexp(x, m);
+    e = sub(e, bit_and(V(splat(23.0f)), subnormal));
+
+    mask_float32<N> small = cmp_lt(m, 0.707106781186547524f);
+    e = sub(e, bit_and(V(splat(1.0f)), small));
+    V f = sub(m, 1.0f);
+    f = add(f, bit_and(m, small));
+
+    V z = mul(f, f);
+    V y = mul(mul(f, z), m_poly(f, P));
+    y = m_fma(e, -2.12194440e-4f, y);
+    y = m_fma(z, -0.5f, y);
+    V r = add(f, y);
+    r = m_fma(e, 0.693359375f, r);
+    return m_log_special(a, r);
+}
+
+/*  Same as above, except that log(1 + f) is computed as
+    f - (hfsq - s * (hfsq + R)), where s = f / (2 + f), hfsq = f^2 / 2 and
+    R = s^2 * P(s^2).
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> i_log(const float64<N>& a)
+{
+    using V = float64<N>;
+    static const double P[] = {
+        1.47977665270682179e-01, 1.53138787584638364e-01,
+        1.81835706404791825e-01, 2.22221984598016425e-01,
+        2.85714287434085279e-01, 3.99999999994104960e-01,
+        6.66666666666673513e-01
+    };
+
+    mask_float64<N> subnormal = cmp_lt(a, 2.2250738585072014e-308);
+    V x = blend(mul(a, 18014398509481984.0), a, subnormal);
+    V m;
+    V e = m_frexp(x, m);
+    e = sub(e, bit_and(V(splat(54.0)), subnormal));
+
+    mask_float64<N> small = cmp_lt(m, 0.707106781186547524);
+    e = sub(e, bit_and(V(splat(1.0)), small));
+    V f = sub(m, 1.0);
+    f = add(f, bit_and(m, small));
+
+    V s = div(f, add(f, 2.0));
+    V z = mul(s, s);
+    V R = mul(z, m_poly(z, P));
+    V hfsq = mul(mul(f, f), 0.5);
+    V y = mul(s, add(hfsq, R));
+    y = m_fma(e, 1.90821492927058770002e-10, y);
+    y = sub(hfsq, y);
+    y = sub(f, y);
+    V r = m_fma(e, 6.93147180369123816490e-01, y);
+    return m_log_special(a, r);
+}
+
+/*  Approximates log(1 + f) by f + f^2 * P(f). Subnormal, negative and
+    special arguments are not handled. The maximum relative error is 2e-6.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_log_fast(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        1.194944605e-01f, -1.858760864e-01f, 2.044911832e-01f,
+        -2.491906285e-01f, 3.331921995e-01f, -5.000084639e-01f
+    };
+
+    V m;
+    V e = m_frexp(a, m);
+    mask_float32<N> small = cmp_lt(m, 0.707106781186547524f);
+    e = sub(e, bit_and(V(splat(1.0f)), small));
+    V f = sub(m, 1.0f);
+    f = add(f, bit_and(m, small));
+
+    V z = mul(f, f);
+    V r = m_fma(m_poly(f, P), z, f);
+    return m_fma(e, 0.693147180559945309f, r);
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,220 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_POW_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_POW_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <cstdint>
+#include <limits>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+// Computes hi + lo = a * b exactly
+template<unsigned N> SIMDPP_INL
+void m_two_prod(float64<N>& hi, float64<N>& lo,
+                const float64<N>& a, const float64<N>& b)
+{
+    hi = mul(a, b);
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    lo = fmsub(a, b, hi);
+#else
+    using V = float64<N>;
+    // Dekker's algorithm. The arguments are split by clearing the low bits
+    // instead of the usual multiplication by 2^27 + 1, so that the result is
+    // not affected by the compiler contracting the operations to fused
+    // multiply-add. The product of the low halves is then inexact, but its
+    // error is negligible.
+    V split = bit_cast<V>(uint64<N>(splat(uint64_t(0xfffffffff8000000))));
+    V ah = bit_and(a, split);
+    V al = sub(a, ah);
+    V bh = bit_and(b, split);
+    V bl = sub(b, bh);
+    lo = sub(mul(ah, bh), hi);
+    lo = add(lo, mul(ah, bl));
+    lo = add(lo, mul(al, bh));
+    lo = add(lo, mul(al, bl));
+#endif
+}
+
+// Computes hi + lo = a + b exactly
+template<unsigned N> SIMDPP_INL
+void m_two_sum(float64<N>& hi, float64<N>& lo,
+               const float64<N>& a, const float64<N>& b)
+{
+    using V = float64<N>;
+    hi = add(a, b);
+    V bb = sub(hi, a);
+    V ab = sub(hi, bb);
+    lo = add(sub(a, ab), sub(b, bb));
+}
+
+/*  Computes log(a) as an unevaluated sum hi + lo with around 64 bits of
+    precision. @a a must be positive and finite. The reduction is the same as
+    in i_log, except that s = f / (2 + f) and the leading term of
+    2s + s^3 * P(s^2) are computed in double-double arithmetic.
+*/
+template<unsigned N> SIMDPP_INL
+void i_log_dd(float64<N>& hi, float64<N>& lo, const float64<N>& a)
+{
+    using V = float64<N>;
+    static const double P[] = {
+        1.47977665270682179e-01, 1.53138787584638364e-01,
+        1.81835706404791825e-01, 2.22221984598016425e-01,
+        2.85714287434085279e-01, 3.99999999994104960e-01
+    };
+    const double P0 = 6.66666666666673513e-01;
+
+    mask_float64<N> subnormal = cmp_lt(a, 2.2250738585072014e-308);
+    V x = blend(mul(a, 18014398509481984.0), a, subnormal);
+    V m;
+    V e = m_frexp(x, m);
+    e = sub(e, bit_and(V(splat(54.0)), subnormal));
+
+    mask_float64<N> small = cmp_lt(m, 0.707106781186547524);
+    e = sub(e, bit_and(V(splat(1.0)), small));
+    V f = sub(m, 1.0);
+    f = add(f, bit_and(m, small));
+
+    // s + s_lo = f / (d + d_lo), d + d_lo = 2 + f
+    V d = add(f, 2.0);
+    V d_lo = sub(f, sub(d, 2.0));
+    V s = div(f, d);
+    V p, p_lo;
+    m_two_prod(p, p_lo, s, d);
+    V s_lo = sub(sub(f, p), p_lo);
+    s_lo = sub(s_lo, mul(s, d_lo));
+    s_lo = div(s_lo, d);
+
+    // c + c_lo = s^3
+    V z, z_lo, c, c_lo;
+    m_two_prod(z, z_lo, s, s);
+    z_lo = add(z_lo, mul(add(s, s), s_lo));
+    m_two_prod(c, c_lo, s, z);
+    c_lo = add(c_lo, mul(s, z_lo));
+    c_lo = add(c_lo, mul(s_lo, z));
+
+    // l + l_lo = P0 * s^3
+    V l, l_lo;
+    m_two_prod(l, l_lo, c, V(splat(P0)));
+    l_lo = m_fma(c_lo, P0, l_lo);
+
+    V w = mul(mul(c, z), m_poly(z, P));
+
+    V h1, e1, h2, e2;
+    m_two_sum(h1, e1, V(add(s, s)), l);
+    m_two_sum(h2, e2, V(mul(e, 6.93147180369123816490e-01)), h1);
+    V r = add(e1, e2);
+    r = add(r, add(s_lo, s_lo));
+    r = add(r, l_lo);
+    r = add(r, w);
+    r = m_fma(e, 1.90821492927058770002e-10, r);
+
+    hi = add(h2, r);
+    lo = sub(r, sub(hi, h2));
+}
+
+/*  Computes exp(a + a_lo). The reduction and polynomial are the same as in
+    i_exp.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp_dd(const float64<N>& a, const float64<N>& a_lo)
+{
+    using V = float64<N>;
+    static const double P[] = {
+        2.49997607969689807e-08, 2.76306518635385022e-07,
+        2.75575893873162075e-06, 2.48014920557022226e-05,
+        1.98412695009315233e-04, 1.38888889445397271e-03,
+        8.33333333349808511e-03, 4.16666666665271371e-02,
+        1.66666666666664048e-01, 5.00000000000001110e-01
+    };
+
+    V x = min(max(a, -746.0), 710.0);
+    V t = mul(x, 1.44269504088896340736);
+    V n = m_round_magic(t);
+    V r = m_fma(n, -6.93145751953125E-1, x);
+    r = m_fma(n, -1.42860682030941723212E-6, r);
+    // a_lo is meaningless if a has been clamped
+    r = add(r, bit_and(a_lo, cmp_eq(x, a)));
+
+    V r2 = mul(r, r);
+    V y = m_fma(m_poly(r, P), r2, r);
+    y = add(y, 1.0);
+    return m_ldexp(y, n);
+}
+
+/*  pow(x, y) = exp(y * log(|x|)), where log(|x|) and the product are computed
+    with extra precision. The special cases follow C99 pow().
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> i_pow(const float64<N>& x, const float64<N>& y)
+{
+    using V = float64<N>;
+    using M = mask_float64<N>;
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    V ax = abs(x);
+    M x_zero = cmp_eq(ax, 0.0);
+    M x_inf = cmp_eq(ax, inf);
+    M x_special = bit_or(bit_or(x_zero, x_inf), isnan(x));
+
+    // If |y| >= 2^64, |y * log(|x|)| is large enough for the result to
+    // overflow or underflow, unless x == 1 which is handled separately
+    V yc = max(min(y, 18446744073709551616.0), -18446744073709551616.0);
+    V lx = blend(V(splat(1.0)), ax, x_special);
+
+    V l, l_lo;
+    i_log_dd(l, l_lo, lx);
+    V p, p_lo;
+    m_two_prod(p, p_lo, yc, l);
+    p_lo = m_fma(yc, l_lo, p_lo);
+    V r = i_exp_dd(p, p_lo);
+
+    // x is zero or infinity
+    V r_special = bit_and(V(splat(inf)), bit_xor(cmp_lt(y, 0.0), x_inf));
+    r = blend(r_special, r, bit_or(x_zero, x_inf));
+
+    // y is infinity
+    M y_inf = cmp_eq(abs(y), inf);
+    r_special = bit_and(V(splat(inf)), bit_xor(cmp_lt(ax, 1.0), cmp_gt(y, 0.0)));
+    r_special = blend(V(splat(1.0)), r_special, cmp_eq(ax, 1.0));
+    r = blend(r_special, r, y_inf);
+
+    // negative x
+    V hy = mul(y, 0.5);
+    M y_int = cmp_eq(trunc(y), y);
+    M y_odd = bit_andnot(y_int, cmp_eq(trunc(hy), hy));
+    r = bit_or(r, bit_and(sign(x), y_odd));
+    M x_neg = bit_and(cmp_lt(x, 0.0), bit_not(x_inf));
+    r = blend(V(splat(nan)), r, bit_andnot(x_neg, y_int));
+
+    r = blend(V(splat(nan)), r, bit_or(isnan(x), isnan(y)));
+    r = blend(V(splat(1.0)), r, bit_or(cmp_eq(y, 0.0), cmp_eq(x, 1.0)));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_pow(const float32<N>& x, const float32<N>& y)
+{
+    float64<N> r = i_pow(float64<N>(to_float64(x)), float64<N>(to_float64(y)));
+    return to_float32(r);
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
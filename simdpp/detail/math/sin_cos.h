@@ -0,0 +1,104 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_SIN_COS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_SIN_COS_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  The argument is reduced to r = x - j * pi/2 in range [-pi/4, pi/4], where
+    pi/2 is split into three parts. Depending on the quadrant q = j + Q the
+    result is one of sin(r), cos(r), -sin(r), -cos(r). Q is 0 for sine and 1
+    for cosine.
+*/
+template<unsigned Q, unsigned N> SIMDPP_INL
+float32<N> i_sin_cos(const float32<N>& a)
+{
+    using V = float32<N>;
+    using U = uint32<N>;
+    static const float PS[] = {
+        -1.9515295891E-4f, 8.3321608736E-3f, -1.6666654611E-1f
+    };
+    static const float PC[] = {
+        2.443315711809948E-5f, -1.388731625493765E-3f, 4.166664568298827E-2f
+    };
+
+    V t = mul(a, 0.636619772367581343f);
+    V tm;
+    V j = m_round_magic(t, tm);
+    U q = add(bit_cast<U>(tm), Q);
+
+    V r = m_fma(j, -1.5703125f, a);
+    r = m_fma(j, -4.837512969970703125e-4f, r);
+    r = m_fma(j, -7.54978995489188216e-8f, r);
+
+    V z = mul(r, r);
+    V s = mul(mul(r, z), m_poly(z, PS));
+    s = add(s, r);
+    V c = mul(mul(z, z), m_poly(z, PC));
+    c = m_fma(z, -0.5f, c);
+    c = add(c, 1.0f);
+
+    U swap = sub(U(make_zero()), bit_and(q, 1));
+    V res = blend(c, s, bit_cast<V>(swap));
+    U sgn = shift_l<30>(bit_and(q, 2));
+    return bit_xor(res, bit_cast<V>(sgn));
+}
+
+template<unsigned Q, unsigned N> SIMDPP_INL
+float64<N> i_sin_cos(const float64<N>& a)
+{
+    using V = float64<N>;
+    using U = uint64<N>;
+    static const double PS[] = {
+        1.58962301576546568060E-10, -2.50507477628578072866E-8,
+        2.75573136213857245213E-6, -1.98412698295895385996E-4,
+        8.33333333332211858878E-3, -1.66666666666666307295E-1
+    };
+    static const double PC[] = {
+        -1.13585365213876817300E-11, 2.08757008419747316778E-9,
+        -2.75573141792967388112E-7, 2.48015872888517045348E-5,
+        -1.38888888888730564116E-3, 4.16666666666665929218E-2
+    };
+
+    V t = mul(a, 0.636619772367581343076);
+    V tm;
+    V j = m_round_magic(t, tm);
+    U q = add(bit_cast<U>(tm), Q);
+
+    V r = m_fma(j, -1.57079625129699707031E0, a);
+    r = m_fma(j, -7.54978941586159635336E-8, r);
+    r = m_fma(j, -5.39030285815811905290E-15, r);
+
+    V z = mul(r, r);
+    V s = mul(mul(r, z), m_poly(z, PS));
+    s = add(s, r);
+    V c = mul(mul(z, z), m_poly(z, PC));
+    c = m_fma(z, -0.5, c);
+    c = add(c, 1.0);
+
+    U swap = sub(U(make_zero()), bit_and(q, 1));
+    V res = blend(c, s, bit_cast<V>(swap));
+    U sgn = shift_l<62>(bit_and(q, 2));
+    return bit_xor(res, bit_cast<V>(sgn));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,101 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_TANH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_TANH_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/detail/math/common.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  tanh(|x|) is approximated by x + x^3 * P(x^2) for |x| < 0.625 and computed
+    as 1 - 2 / (exp(2|x|) + 1) otherwise. The sign is restored afterwards.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_tanh(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        -5.70498872745E-3f, 2.06390887954E-2f, -5.37397155531E-2f,
+        1.33314422036E-1f, -3.33332819422E-1f
+    };
+
+    V ax = abs(a);
+    V z = mul(a, a);
+    V az = mul(ax, z);
+    V rs = m_fma(az, m_poly(z, P), ax);
+
+    V e = i_exp(V(add(ax, ax)));
+    V rl = div(2.0f, add(e, 1.0f));
+    rl = sub(1.0f, rl);
+    V r = blend(rs, rl, cmp_lt(ax, 0.625f));
+    return bit_or(r, sign(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_tanh(const float64<N>& a)
+{
+    using V = float64<N>;
+    static const double P[] = {
+        -9.64399179425052238628E-1, -9.92877231001918586564E1,
+        -1.61468768441708447952E3
+    };
+    static const double Q[] = {
+        1.0, 1.12811678491632931402E2, 2.23548839060100448583E3,
+        4.84406305325125486048E3
+    };
+
+    V ax = abs(a);
+    V z = mul(a, a);
+    V rs = div(mul(z, m_poly(z, P)), m_poly(z, Q));
+    rs = m_fma(ax, rs, ax);
+
+    V e = i_exp(V(add(ax, ax)));
+    V rl = div(2.0, add(e, 1.0));
+    rl = sub(1.0, rl);
+    V r = blend(rs, rl, cmp_lt(ax, 0.625));
+    return bit_or(r, sign(a));
+}
+
+/*  Computes tanh(x) as x * P(x^2) / Q(x^2) with x clamped to [-c, c] where
+    the result rounds to +-1. The maximum absolute error is 5e-7.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_tanh_fast(const float32<N>& a)
+{
+    using V = float32<N>;
+    static const float P[] = {
+        -2.76076847742355e-16f, 2.00018790482477e-13f, -8.60467152213735e-11f,
+        5.12229709037114e-08f, 1.48572235717979e-05f, 6.37261928875436e-04f,
+        4.89352455891786e-03f
+    };
+    static const float Q[] = {
+        1.19825839466702e-06f, 1.18534705686654e-04f, 2.26843463243900e-03f,
+        4.89352518554385e-03f
+    };
+
+    V x = max(a, -7.90531110763549805f);
+    x = min(x, 7.90531110763549805f);
+    V z = mul(x, x);
+    V p = mul(x, m_poly(z, P));
+    return div(p, m_poly(z, Q));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -35,6 +35,20 @@
     }                                                           \
     return r;
 
+#define SIMDPP_VEC_ARRAY_IMPL4(RTYPE, OP, V1, V2, V3, V4)       \
+    RTYPE r; for (unsigned i = 0; i < r.vec_length; ++i) { \
+        r.vec(i) = OP((V1).vec(i), (V2).vec(i), (V3).vec(i),    \
+                      (V4).vec(i));                             \
+    }                                                           \
+    return r;
+
+#define SIMDPP_VEC_ARRAY_IMPL5(RTYPE, OP, V1, V2, V3, V4, V5)   \
+    RTYPE r; for (unsigned i = 0; i < r.vec_length; ++i) { \
+        r.vec(i) = OP((V1).vec(i), (V2).vec(i), (V3).vec(i),    \
+                      (V4).vec(i), (V5).vec(i));                \
+    }                                                           \
+    return r;
+
 #define SIMDPP_VEC_ARRAY_IMPL_REF1(RTYPE, OP, V1)               \
     for (unsigned i = 0; i < RTYPE::vec_length; ++i) {          \
         OP((V1).vec(i)); }
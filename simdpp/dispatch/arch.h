@@ -36,24 +36,50 @@ enum class Arch : std::uint32_t {
     /// Indicates x86 popcnt instruction support (Note: this is not equivalent
     /// to the ABM CPUID flag, Intel includes the instruction into SSE 4.2)
     X86_POPCNT_INSN = 1 << 5,
+    /// Indicates x86 SSE4.2 support
+    X86_SSE4_2 = 1 << 6,
+    /// Indicates x86 carry-less multiplication (PCLMULQDQ) support
+    X86_PCLMULQDQ = 1 << 7,
     /// Indicates x86 AVX support
-    X86_AVX = 1 << 6,
+    X86_AVX = 1 << 8,
     /// Indicates x86 AVX2 support
-    X86_AVX2 = 1 << 7,
+    X86_AVX2 = 1 << 9,
+    /// Indicates x86 BMI1 (bit manipulation) support
+    X86_BMI1 = 1 << 10,
+    /// Indicates x86 BMI2 (bit manipulation) support
+    X86_BMI2 = 1 << 11,
+    /// Indicates x86 lzcnt instruction support (the ABM CPUID flag on AMD)
+    X86_LZCNT = 1 << 12,
     /// Indicates x86 FMA3 (Intel) support
-    X86_FMA3 = 1 << 8,
+    X86_FMA3 = 1 << 13,
     /// Indicates x86 FMA4 (AMD) support
-    X86_FMA4 = 1 << 9,
+    X86_FMA4 = 1 << 14,
     /// Indicates x86 XOP (AMD) support
-    X86_XOP = 1 << 10,
+    X86_XOP = 1 << 15,
     /// Indicates x86 AVX-512F suppotr
-    X86_AVX512F = 1 << 11,
+    X86_AVX512F = 1 << 16,
     /// Indicates x86 AVX-512BW suppotr
-    X86_AVX512BW = 1 << 12,
+    X86_AVX512BW = 1 << 17,
     /// Indicates x86 AVX-512DQ suppotr
-    X86_AVX512DQ = 1 << 13,
+    X86_AVX512DQ = 1 << 18,
     /// Indicates x86 AVX-512VL suppotr
-    X86_AVX512VL = 1 << 14,
+    X86_AVX512VL = 1 << 19,
+    /// Indicates x86 AVX-512VBMI support
+    X86_AVX512VBMI = 1 << 20,
+    /// Indicates x86 AVX-512VBMI2 support
+    X86_AVX512VBMI2 = 1 << 21,
+    /// Indicates x86 AVX-512VNNI support
+    X86_AVX512VNNI = 1 << 22,
+    /// Indicates x86 AVX-512BITALG support
+    X86_AVX512BITALG = 1 << 23,
+    /// Indicates x86 AVX-512VPOPCNTDQ support
+    X86_AVX512VPOPCNTDQ = 1 << 24,
+    /// Indicates x86 AVX-512IFMA support
+    X86_AVX512IFMA = 1 << 25,
+    /// Indicates x86 GFNI (Galois Field New Instructions) support
+    X86_GFNI = 1 << 26,
+    /// Indicates x86 VAES (vector AES) support
+    X86_VAES = 1 << 27,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
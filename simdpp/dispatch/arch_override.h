@@ -0,0 +1,167 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_ARCH_OVERRIDE_H
+#define LIBSIMDPP_DISPATCH_ARCH_OVERRIDE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/get_arch_string_list.h>
+
+namespace simdpp {
+namespace detail {
+
+/*  Parses a list of architecture ids separated by commas or whitespace, e.g.
+    "avx2,popcnt". The ids are the same as those accepted by
+    get_arch_string_list(). Unknown ids are ignored.
+*/
+inline Arch parse_arch_list(const char* list)
+{
+    std::vector<std::string> ids;
+    std::string id;
+    for (const char* p = list; ; ++p) {
+        if (*p == '\0' || *p == ',' || *p == ' ' || *p == '\t') {
+            if (!id.empty())
+                ids.push_back(id);
+            id.clear();
+            if (*p == '\0')
+                break;
+        } else {
+            id.push_back(*p);
+        }
+    }
+
+    std::vector<const char*> strings;
+    for (const auto& s : ids)
+        strings.push_back(s.c_str());
+    return get_arch_string_list(strings.data(), static_cast<int>(strings.size()), "");
+}
+
+struct ArchOverrideState {
+    enum : std::uint32_t {
+        ENV_READ = 1 << 0,
+        PIN = 1 << 1,
+        LIMIT = 1 << 2
+    };
+    std::atomic<std::uint32_t> flags;
+    std::atomic<std::uint32_t> pin;
+    std::atomic<std::uint32_t> limit;
+};
+
+inline ArchOverrideState& arch_override_state()
+{
+    static ArchOverrideState state = { {0}, {0}, {0} };
+    return state;
+}
+
+/*  Reads the overrides from the environment on the first call. The settings
+    made via the API are applied on top of the environment, thus the setters
+    call this function too.
+*/
+inline void read_arch_override_env(ArchOverrideState& state)
+{
+    if (state.flags.load(std::memory_order_acquire) & ArchOverrideState::ENV_READ)
+        return;
+
+    std::uint32_t flags = ArchOverrideState::ENV_READ;
+    const char* pin = std::getenv("SIMDPP_ARCH_OVERRIDE");
+    if (pin != nullptr) {
+        state.pin.store(static_cast<std::uint32_t>(parse_arch_list(pin)),
+                        std::memory_order_relaxed);
+        flags |= ArchOverrideState::PIN;
+    }
+    const char* limit = std::getenv("SIMDPP_ARCH_LIMIT");
+    if (limit != nullptr) {
+        state.limit.store(static_cast<std::uint32_t>(parse_arch_list(limit)),
+                          std::memory_order_relaxed);
+        flags |= ArchOverrideState::LIMIT;
+    }
+    state.flags.fetch_or(flags, std::memory_order_release);
+}
+
+/*  Applies the override set via set_arch_override(), set_arch_limit() or the
+    corresponding environment variables to the architecture @a arch that
+    has been detected.
+*/
+inline Arch apply_arch_override(Arch arch)
+{
+    ArchOverrideState& state = arch_override_state();
+    read_arch_override_env(state);
+    std::uint32_t flags = state.flags.load(std::memory_order_acquire);
+
+    if (flags & ArchOverrideState::PIN) {
+        arch = static_cast<Arch>(state.pin.load(std::memory_order_relaxed));
+    }
+    if (flags & ArchOverrideState::LIMIT) {
+        arch &= static_cast<Arch>(state.limit.load(std::memory_order_relaxed));
+    }
+    return arch;
+}
+
+} // namespace detail
+
+/** Forces the dispatchers to select versions as if the CPU supported exactly
+    the instruction sets in @a arch. The function is intended for testing and
+    benchmarking: if @a arch contains instruction sets that the CPU does not
+    support, the program will likely crash.
+
+    The same effect can be achieved by setting the @c SIMDPP_ARCH_OVERRIDE
+    environment variable to a list of architecture ids, e.g. "avx2,popcnt" (the
+    ids are the same as accepted by get_arch_string_list()). Settings made via
+    this function are applied on top of the environment.
+
+    Only the dispatchers that have not been resolved yet are affected, thus the
+    function should be called early during the startup of the program.
+    Dispatchers in the IFUNC mode (see SIMDPP_DISPATCH_USE_IFUNC) are resolved
+    before the program starts and are never affected.
+*/
+inline void set_arch_override(Arch arch)
+{
+    detail::ArchOverrideState& state = detail::arch_override_state();
+    detail::read_arch_override_env(state);
+    state.pin.store(static_cast<std::uint32_t>(arch), std::memory_order_relaxed);
+    state.flags.fetch_or(detail::ArchOverrideState::PIN,
+                         std::memory_order_release);
+}
+
+/** Limits the instruction sets the dispatchers may select versions for to
+    those in @a arch. Unlike set_arch_override(), instruction sets that are
+    not supported by the CPU are never enabled, thus this is safe to use in
+    production, e.g. to disable a slow AVX-512 code path.
+
+    The same effect can be achieved by setting the @c SIMDPP_ARCH_LIMIT
+    environment variable. See set_arch_override() for details.
+*/
+inline void set_arch_limit(Arch arch)
+{
+    detail::ArchOverrideState& state = detail::arch_override_state();
+    detail::read_arch_override_env(state);
+    state.limit.store(static_cast<std::uint32_t>(arch), std::memory_order_relaxed);
+    state.flags.fetch_or(detail::ArchOverrideState::LIMIT,
+                         std::memory_order_release);
+}
+
+/** Removes the overrides set via set_arch_override() and set_arch_limit() or
+    the corresponding environment variables.
+*/
+inline void reset_arch_override()
+{
+    detail::arch_override_state().flags.store(
+            detail::ArchOverrideState::ENV_READ, std::memory_order_release);
+}
+
+} // namespace simdpp
+
+#endif
@@ -57,11 +57,21 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_1_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_1_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_1_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -72,6 +82,21 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_1_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_1_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -107,6 +132,46 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_1_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_1_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -138,19 +203,32 @@
     #define SIMDPP_DISPATCH_1_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_1_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_1_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_1_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_1_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_1_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_1_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_1_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_1_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_1_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_1_NS_ID_XOP,                                          \
@@ -215,11 +293,21 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_2_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_2_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_2_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -230,6 +318,21 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_2_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_2_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -265,6 +368,46 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_2_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_2_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -296,19 +439,32 @@
     #define SIMDPP_DISPATCH_2_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_2_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_2_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_2_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_2_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_2_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_2_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_2_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_2_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_2_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_2_NS_ID_XOP,                                          \
@@ -373,11 +529,21 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_3_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_3_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_3_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -388,6 +554,21 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_3_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_3_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -423,6 +604,46 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_3_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_3_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -454,19 +675,32 @@
     #define SIMDPP_DISPATCH_3_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_3_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_3_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_3_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_3_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_3_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_3_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_3_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_3_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_3_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_3_NS_ID_XOP,                                          \
@@ -531,11 +765,21 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_4_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_4_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_4_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -546,6 +790,21 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_4_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_4_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -581,6 +840,46 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_4_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_4_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -612,19 +911,32 @@
     #define SIMDPP_DISPATCH_4_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_4_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_4_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_4_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_4_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_4_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_4_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_4_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_4_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_4_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_4_NS_ID_XOP,                                          \
@@ -689,11 +1001,21 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_5_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_5_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_5_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -704,6 +1026,21 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_5_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_5_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -739,6 +1076,46 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_5_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_5_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -770,19 +1147,32 @@
     #define SIMDPP_DISPATCH_5_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_5_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_5_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_5_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_5_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_5_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_5_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_5_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_5_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_5_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_5_NS_ID_XOP,                                          \
@@ -847,11 +1237,21 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_6_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_6_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_6_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -862,6 +1262,21 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_6_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_6_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -897,6 +1312,46 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_6_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_6_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -928,19 +1383,32 @@
     #define SIMDPP_DISPATCH_6_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_6_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_6_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_6_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_6_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_6_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_6_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_6_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_6_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_6_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_6_NS_ID_XOP,                                          \
@@ -1005,11 +1473,21 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_7_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_7_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_7_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -1020,6 +1498,21 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_7_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_7_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1055,6 +1548,46 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_7_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_7_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1086,19 +1619,32 @@
     #define SIMDPP_DISPATCH_7_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_7_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_7_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_7_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_7_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_7_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_7_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_7_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_7_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_7_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_7_NS_ID_XOP,                                          \
@@ -1163,11 +1709,21 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_8_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_8_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_8_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -1178,6 +1734,21 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_8_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_8_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1213,6 +1784,46 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_8_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_8_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1244,19 +1855,32 @@
     #define SIMDPP_DISPATCH_8_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_8_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_8_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_8_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_8_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_8_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_8_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_8_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_8_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_8_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_8_NS_ID_XOP,                                          \
@@ -1321,11 +1945,21 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_9_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_9_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_9_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -1336,6 +1970,21 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_9_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_9_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1371,6 +2020,46 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_9_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_9_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1402,19 +2091,32 @@
     #define SIMDPP_DISPATCH_9_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_9_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_9_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_9_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_9_NS_ID_POPCNT_INSN,                                  \
+        SIMDPP_DISPATCH_9_NS_ID_PCLMULQDQ,                                    \
         SIMDPP_DISPATCH_9_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_9_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_LZCNT,                                        \
         SIMDPP_DISPATCH_9_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_9_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_VAES,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_9_NS_ID_XOP,                                          \
@@ -1479,11 +2181,21 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_10_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_10_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_10_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -1494,6 +2206,21 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_10_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_10_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1529,6 +2256,46 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_10_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_10_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1560,19 +2327,32 @@
     #define SIMDPP_DISPATCH_10_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_10_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_10_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_10_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_10_NS_ID_POPCNT_INSN,                                 \
+        SIMDPP_DISPATCH_10_NS_ID_PCLMULQDQ,                                   \
         SIMDPP_DISPATCH_10_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_10_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_LZCNT,                                       \
         SIMDPP_DISPATCH_10_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_10_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_VAES,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_10_NS_ID_XOP,                                         \
@@ -1637,11 +2417,21 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_11_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_11_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_11_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -1652,6 +2442,21 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_11_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_11_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1687,6 +2492,46 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_11_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_11_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1718,19 +2563,32 @@
     #define SIMDPP_DISPATCH_11_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_11_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_11_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_11_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_11_NS_ID_POPCNT_INSN,                                 \
+        SIMDPP_DISPATCH_11_NS_ID_PCLMULQDQ,                                   \
         SIMDPP_DISPATCH_11_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_11_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_LZCNT,                                       \
         SIMDPP_DISPATCH_11_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_11_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_VAES,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_11_NS_ID_XOP,                                         \
@@ -1795,11 +2653,21 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_12_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_12_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_12_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -1810,6 +2678,21 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_12_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_12_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1845,6 +2728,46 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_12_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_12_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1876,19 +2799,32 @@
     #define SIMDPP_DISPATCH_12_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_12_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_12_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_12_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_12_NS_ID_POPCNT_INSN,                                 \
+        SIMDPP_DISPATCH_12_NS_ID_PCLMULQDQ,                                   \
         SIMDPP_DISPATCH_12_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_12_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_LZCNT,                                       \
         SIMDPP_DISPATCH_12_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_12_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_VAES,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_12_NS_ID_XOP,                                         \
@@ -1953,11 +2889,21 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_13_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_13_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_13_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -1968,6 +2914,21 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_13_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_13_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -2003,6 +2964,46 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_13_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_13_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2034,19 +3035,32 @@
     #define SIMDPP_DISPATCH_13_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_13_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_13_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_13_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_13_NS_ID_POPCNT_INSN,                                 \
+        SIMDPP_DISPATCH_13_NS_ID_PCLMULQDQ,                                   \
         SIMDPP_DISPATCH_13_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_13_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_LZCNT,                                       \
         SIMDPP_DISPATCH_13_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_13_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_VAES,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_13_NS_ID_XOP,                                         \
@@ -2111,11 +3125,21 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_14_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_14_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_14_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -2126,6 +3150,21 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_14_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_14_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -2161,6 +3200,46 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_14_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_14_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2192,19 +3271,32 @@
     #define SIMDPP_DISPATCH_14_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_14_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_14_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_14_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_14_NS_ID_POPCNT_INSN,                                 \
+        SIMDPP_DISPATCH_14_NS_ID_PCLMULQDQ,                                   \
         SIMDPP_DISPATCH_14_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_14_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_LZCNT,                                       \
         SIMDPP_DISPATCH_14_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_14_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_VAES,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_14_NS_ID_XOP,                                         \
@@ -2269,11 +3361,21 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_15_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_15_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_15_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -2284,6 +3386,21 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_15_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_15_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -2319,6 +3436,46 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_15_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_15_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2350,19 +3507,32 @@
     #define SIMDPP_DISPATCH_15_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_15_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_15_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_15_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_15_NS_ID_POPCNT_INSN,                                 \
+        SIMDPP_DISPATCH_15_NS_ID_PCLMULQDQ,                                   \
         SIMDPP_DISPATCH_15_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_15_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_LZCNT,                                       \
         SIMDPP_DISPATCH_15_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_15_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_VAES,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_15_NS_ID_XOP,                                         \
@@ -0,0 +1,93 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_DETECTED_ARCH_H
+#define LIBSIMDPP_DISPATCH_DETECTED_ARCH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/get_arch_gcc_builtin_cpu_supports.h>
+#include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+
+namespace simdpp {
+namespace detail {
+
+/*  Retrieves the supported architecture using the best method available on
+    the current platform. This function is relatively expensive, see
+    detected_arch() for a cached variant.
+
+    Note that the implementation must not depend on the instruction sets that
+    the current translation unit is compiled for, as the function is inline and
+    may be compiled for several architectures within the same program.
+*/
+inline Arch probe_arch()
+{
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    return get_arch_raw_cpuid();
+#elif SIMDPP_HAS_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS
+    return get_arch_gcc_builtin_cpu_supports();
+#elif SIMDPP_HAS_GET_ARCH_LINUX_CPUINFO
+    return get_arch_linux_cpuinfo();
+#elif __aarch64__
+    // NEON is mandatory on AArch64
+    return Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP;
+#else
+    return Arch::NONE_NULL;
+#endif
+}
+
+struct DetectedArchCache {
+    std::atomic<bool> valid;
+    std::atomic<std::uint32_t> arch;
+};
+
+// The cache is constant-initialized, thus it's usable even before the dynamic
+// initialization of the program starts (e.g. from IFUNC resolvers).
+inline DetectedArchCache& detected_arch_cache()
+{
+    static DetectedArchCache cache = { {false}, {0} };
+    return cache;
+}
+
+} // namespace detail
+
+/** Returns the instruction sets supported by the CPU the program is running
+    on. The CPU is probed on the first call using the best method available on
+    the current platform (see the simdpp/dispatch/get_arch_*.h files) and the
+    result is cached for the lifetime of the process, so that all dispatchers
+    share a single probe.
+
+    The function is thread-safe. If it's called concurrently before the result
+    has been cached, the CPU may be probed more than once, but all callers
+    observe the same result.
+
+    This function is used by the dispatchers created by @c
+    SIMDPP_MAKE_DISPATCHER unless @c SIMDPP_USER_ARCH_INFO is defined by the
+    user.
+*/
+inline Arch detected_arch()
+{
+    detail::DetectedArchCache& cache = detail::detected_arch_cache();
+    if (cache.valid.load(std::memory_order_acquire)) {
+        return static_cast<Arch>(cache.arch.load(std::memory_order_relaxed));
+    }
+
+    Arch arch = detail::probe_arch();
+    cache.arch.store(static_cast<std::uint32_t>(arch), std::memory_order_relaxed);
+    cache.valid.store(true, std::memory_order_release);
+    return arch;
+}
+
+} // namespace simdpp
+
+#endif
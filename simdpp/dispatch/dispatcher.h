@@ -13,14 +13,17 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <simdpp/dispatch/arch.h>
 
 namespace simdpp {
 
 /** @def SIMDPP_USER_ARCH_INFO
-    The user must define this macro if he wants to use the dispatcher
-    infrastructure. The macro must evaluate to a constant expression that could
+    Identifies the function that returns the supported instruction sets. If the
+    user does not define this macro before including simd.h, it's defined to
+    @c ::simdpp::detected_arch() which probes the CPU once per process and
+    caches the result. The macro must evaluate to an expression that could
     implicitly initialize an object of type @c std::function<Arch()>.
 
     The macro is used by @c SIMDPP_MAKE_DISPATCHER_* to specify function which
@@ -31,15 +34,25 @@ namespace simdpp {
     @c SIMDPP_MAKE_DISPATCHER_* expansion.
 
     The function identified by the @c SIMDPP_USER_ARCH_INFO is called at the
-    first time the specific dispatcher is invoked. The user must ensure that
-    proper synchronization is used if the dispatcher is called concurrently.
+    first time the specific dispatcher is invoked. If the dispatcher is invoked
+    concurrently from several threads before it has been initialized, the
+    function may be called once by each of these threads, thus it must be safe
+    to call it concurrently. The dispatcher itself does not need any external
+    synchronization.
 
     The user must ensure that the returned information is sensible: e.g. SSE2
     must be supported if SSE3 support is indicated.
 
+    The returned value is adjusted according to the architecture override, if
+    any (see simdpp::set_arch_override() and simdpp::set_arch_limit()).
+
     The @c simdpp/dispatch/get_arch_*.h files provide several ready
-    implementations of CPU features detection.
+    implementations of CPU features detection. Note that using these directly
+    means that the CPU is probed once for each dispatcher.
 */
+#ifndef SIMDPP_USER_ARCH_INFO
+#define SIMDPP_USER_ARCH_INFO ::simdpp::detected_arch()
+#endif
 
 namespace detail {
 
@@ -92,6 +105,26 @@ inline FnVersion select_version_any(FnVersion* versions, unsigned size,
     return versions[i];
 }
 
+/*  Publishes the function pointer selected by a dispatcher to the cache
+    variable @a cache. If another thread has already published a pointer, that
+    pointer is kept and returned instead, so that all threads end up calling
+    the same function. The cache is written at most once.
+
+    The pointers refer to code, not to data that is initialized at runtime,
+    thus the readers of the cache can use relaxed loads.
+*/
+template<class FunPtr>
+FunPtr publish_selected_version(std::atomic<FunPtr>& cache, FunPtr selected)
+{
+    FunPtr expected = nullptr;
+    if (cache.compare_exchange_strong(expected, selected,
+                                      std::memory_order_release,
+                                      std::memory_order_acquire)) {
+        return selected;
+    }
+    return expected;
+}
+
 } // namespace detail
 } // namespace simdpp
 
@@ -27,6 +27,7 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
         arch_info |= Arch::X86_SSE3;
         arch_info |= Arch::X86_SSSE3;
         arch_info |= Arch::X86_SSE4_1;
+        arch_info |= Arch::X86_SSE4_2;
         arch_info |= Arch::X86_AVX;
         arch_info |= Arch::X86_AVX2;
         arch_info |= Arch::X86_FMA3;
@@ -38,6 +39,7 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
         arch_info |= Arch::X86_SSE3;
         arch_info |= Arch::X86_SSSE3;
         arch_info |= Arch::X86_SSE4_1;
+        arch_info |= Arch::X86_SSE4_2;
         arch_info |= Arch::X86_AVX;
         arch_info |= Arch::X86_AVX2;
     } else if (__builtin_cpu_supports("avx")) {
@@ -45,7 +47,14 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
         arch_info |= Arch::X86_SSE3;
         arch_info |= Arch::X86_SSSE3;
         arch_info |= Arch::X86_SSE4_1;
+        arch_info |= Arch::X86_SSE4_2;
         arch_info |= Arch::X86_AVX;
+    } else if (__builtin_cpu_supports("sse4.2")) {
+        arch_info |= Arch::X86_SSE2;
+        arch_info |= Arch::X86_SSE3;
+        arch_info |= Arch::X86_SSSE3;
+        arch_info |= Arch::X86_SSE4_1;
+        arch_info |= Arch::X86_SSE4_2;
     } else if (__builtin_cpu_supports("sse4.1")) {
         arch_info |= Arch::X86_SSE2;
         arch_info |= Arch::X86_SSE3;
@@ -63,6 +72,49 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
     }
     if (__builtin_cpu_supports("popcnt"))
         arch_info |= Arch::X86_POPCNT_INSN;
+#if (__GNUC__ >= 8)
+    // Extensions that are only usable if the base instruction set has been
+    // detected above.
+    if (test_arch_subset(arch_info, Arch::X86_AVX512F)) {
+        if (__builtin_cpu_supports("avx512bw"))
+            arch_info |= Arch::X86_AVX512BW;
+        if (__builtin_cpu_supports("avx512dq"))
+            arch_info |= Arch::X86_AVX512DQ;
+        if (__builtin_cpu_supports("avx512vl"))
+            arch_info |= Arch::X86_AVX512VL;
+        if (__builtin_cpu_supports("avx512vnni"))
+            arch_info |= Arch::X86_AVX512VNNI;
+        if (__builtin_cpu_supports("avx512vpopcntdq"))
+            arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+        if (__builtin_cpu_supports("avx512ifma"))
+            arch_info |= Arch::X86_AVX512IFMA;
+    }
+    if (test_arch_subset(arch_info, Arch::X86_AVX512BW)) {
+        if (__builtin_cpu_supports("avx512vbmi"))
+            arch_info |= Arch::X86_AVX512VBMI;
+        if (__builtin_cpu_supports("avx512vbmi2"))
+            arch_info |= Arch::X86_AVX512VBMI2;
+        if (__builtin_cpu_supports("avx512bitalg"))
+            arch_info |= Arch::X86_AVX512BITALG;
+    }
+    if (__builtin_cpu_supports("pclmul") &&
+        test_arch_subset(arch_info, Arch::X86_SSE2))
+        arch_info |= Arch::X86_PCLMULQDQ;
+    if (__builtin_cpu_supports("bmi"))
+        arch_info |= Arch::X86_BMI1;
+    if (__builtin_cpu_supports("bmi2"))
+        arch_info |= Arch::X86_BMI2;
+    if (__builtin_cpu_supports("gfni") &&
+        test_arch_subset(arch_info, Arch::X86_SSE2))
+        arch_info |= Arch::X86_GFNI;
+#endif
+#if (__GNUC__ >= 11)
+    if (__builtin_cpu_supports("lzcnt"))
+        arch_info |= Arch::X86_LZCNT;
+    if (__builtin_cpu_supports("vaes") &&
+        test_arch_subset(arch_info, Arch::X86_AVX))
+        arch_info |= Arch::X86_VAES;
+#endif
 
     return arch_info;
 }
@@ -46,9 +46,14 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_sse3 = a_sse2 | Arch::X86_SSE3;
     Arch a_ssse3 = a_sse3 | Arch::X86_SSSE3;
     Arch a_sse4_1 = a_ssse3 | Arch::X86_SSE4_1;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
     Arch a_popcnt = Arch::X86_POPCNT_INSN;
-    Arch a_avx = a_sse4_1 | Arch::X86_AVX;
+    Arch a_pclmul = a_sse2 | Arch::X86_PCLMULQDQ;
+    Arch a_avx = a_sse4_2 | Arch::X86_AVX;
     Arch a_avx2 = a_avx | Arch::X86_AVX2;
+    Arch a_bmi1 = Arch::X86_BMI1;
+    Arch a_bmi2 = Arch::X86_BMI2;
+    Arch a_lzcnt = Arch::X86_LZCNT;
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
     Arch a_xop = a_sse3 | Arch::X86_XOP;
@@ -56,15 +61,28 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vbmi2 = a_avx512bw | Arch::X86_AVX512VBMI2;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512bitalg = a_avx512bw | Arch::X86_AVX512BITALG;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512ifma = a_avx512f | Arch::X86_AVX512IFMA;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
+    Arch a_vaes = a_avx | Arch::X86_VAES;
 
     ident = "flags\t";
     features["sse2"] = a_sse2;
     features["pni"] = a_sse3;
     features["ssse3"] = a_ssse3;
     features["sse4_1"] = a_sse4_1;
+    features["sse4_2"] = a_sse4_2;
     features["avx"] = a_avx;
     features["avx2"] = a_avx2;
     features["popcnt"] = a_popcnt;
+    features["pclmulqdq"] = a_pclmul;
+    features["bmi1"] = a_bmi1;
+    features["bmi2"] = a_bmi2;
+    features["abm"] = a_lzcnt;
     features["fma"] = a_fma3;
     features["fma4"] = a_fma4;
     features["xop"] = a_xop;
@@ -72,6 +90,14 @@ inline Arch get_arch_linux_cpuinfo()
     features["avx512bw"] = a_avx512bw;
     features["avx512dq"] = a_avx512dq;
     features["avx512vl"] = a_avx512vl;
+    features["avx512vbmi"] = a_avx512vbmi;
+    features["avx512_vbmi2"] = a_avx512vbmi2;
+    features["avx512_vnni"] = a_avx512vnni;
+    features["avx512_bitalg"] = a_avx512bitalg;
+    features["avx512_vpopcntdq"] = a_avx512vpopcntdq;
+    features["avx512ifma"] = a_avx512ifma;
+    features["gfni"] = a_gfni;
+    features["vaes"] = a_vaes;
 #else
     return res;
 #endif
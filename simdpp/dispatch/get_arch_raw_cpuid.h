@@ -120,6 +120,10 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_SSSE3;
         if (ecx & (1u << 19))
             arch_info |= Arch::X86_SSE4_1;
+        if (ecx & (1u << 20))
+            arch_info |= Arch::X86_SSE4_2;
+        if (ecx & (1u << 1))
+            arch_info |= Arch::X86_PCLMULQDQ;
         if (ecx & (1u << 20) && mfg == simdpp::detail::CPU_INTEL)
             arch_info |= Arch::X86_POPCNT_INSN; // popcnt is included in SSE4.2 on Intel
         if (ecx & (1u << 23))
@@ -142,12 +146,18 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_FMA4;
         if (ecx & (1u << 11))
             arch_info |= Arch::X86_XOP;
+        if (ecx & (1u << 5))
+            arch_info |= Arch::X86_LZCNT;
     }
 
     if (max_cpuid_level >= 0x00000007) {
         simdpp::detail::get_cpuid(0x00000007, 0, &eax, &ebx, &ecx, &edx);
         if (ebx & (1u << 5) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX2;
+        if (ebx & (1u << 3))
+            arch_info |= Arch::X86_BMI1;
+        if (ebx & (1u << 8))
+            arch_info |= Arch::X86_BMI2;
         if (ebx & (1u << 16) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX512F;
         if (ebx & (1u << 30) && xsave_xrstore_avail)
@@ -156,6 +166,22 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_AVX512DQ;
         if (ebx & (1u << 31) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX512VL;
+        if (ebx & (1u << 21) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512IFMA;
+        if (ecx & (1u << 1) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VBMI;
+        if (ecx & (1u << 6) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VBMI2;
+        if (ecx & (1u << 11) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VNNI;
+        if (ecx & (1u << 12) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512BITALG;
+        if (ecx & (1u << 14) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+        if (ecx & (1u << 8))
+            arch_info |= Arch::X86_GFNI;
+        if (ecx & (1u << 9) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_VAES;
     }
 
     return arch_info;
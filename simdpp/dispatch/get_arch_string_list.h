@@ -45,9 +45,14 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     Arch a_sse3 = a_sse2 | Arch::X86_SSE3;
     Arch a_ssse3 = a_sse3 | Arch::X86_SSSE3;
     Arch a_sse4_1 = a_ssse3 | Arch::X86_SSE4_1;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
     Arch a_popcnt = Arch::X86_POPCNT_INSN;
-    Arch a_avx = a_sse4_1 | Arch::X86_AVX;
+    Arch a_pclmul = a_sse2 | Arch::X86_PCLMULQDQ;
+    Arch a_avx = a_sse4_2 | Arch::X86_AVX;
     Arch a_avx2 = a_avx | Arch::X86_AVX2;
+    Arch a_bmi1 = Arch::X86_BMI1;
+    Arch a_bmi2 = Arch::X86_BMI2;
+    Arch a_lzcnt = Arch::X86_LZCNT;
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
     Arch a_xop = a_sse3 | Arch::X86_XOP;
@@ -55,14 +60,27 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vbmi2 = a_avx512bw | Arch::X86_AVX512VBMI2;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512bitalg = a_avx512bw | Arch::X86_AVX512BITALG;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512ifma = a_avx512f | Arch::X86_AVX512IFMA;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
+    Arch a_vaes = a_avx | Arch::X86_VAES;
 
     features.emplace_back("sse2", a_sse2);
     features.emplace_back("sse3", a_sse3);
     features.emplace_back("ssse3", a_ssse3);
     features.emplace_back("sse4p1", a_sse4_1);
+    features.emplace_back("sse4p2", a_sse4_2);
     features.emplace_back("popcnt", a_popcnt);
+    features.emplace_back("pclmul", a_pclmul);
     features.emplace_back("avx", a_avx);
     features.emplace_back("avx2", a_avx2);
+    features.emplace_back("bmi1", a_bmi1);
+    features.emplace_back("bmi2", a_bmi2);
+    features.emplace_back("lzcnt", a_lzcnt);
     features.emplace_back("fma3", a_fma3);
     features.emplace_back("fma4", a_fma4);
     features.emplace_back("xop", a_xop);
@@ -70,6 +88,14 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     features.emplace_back("avx512bw", a_avx512bw);
     features.emplace_back("avx512dq", a_avx512dq);
     features.emplace_back("avx512vl", a_avx512vl);
+    features.emplace_back("avx512vbmi", a_avx512vbmi);
+    features.emplace_back("avx512vbmi2", a_avx512vbmi2);
+    features.emplace_back("avx512vnni", a_avx512vnni);
+    features.emplace_back("avx512bitalg", a_avx512bitalg);
+    features.emplace_back("avx512vpopcntdq", a_avx512vpopcntdq);
+    features.emplace_back("avx512ifma", a_avx512ifma);
+    features.emplace_back("gfni", a_gfni);
+    features.emplace_back("vaes", a_vaes);
 #elif SIMDPP_PPC
     Arch a_altivec = Arch::POWER_ALTIVEC;
     Arch a_vsx_206 = a_altivec | Arch::POWER_VSX_206;
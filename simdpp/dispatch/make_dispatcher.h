@@ -13,12 +13,68 @@
 #include <simdpp/detail/preprocessor/seq/for_each.hpp>
 #include <simdpp/detail/preprocessor/variadic/to_seq.hpp>
 
+/** @def SIMDPP_DISPATCH_HAS_IFUNC
+    Defined to 1 if the current compiler and target support GNU indirect
+    functions (IFUNC) and thus the IFUNC-based dispatch mode can be enabled via
+    SIMDPP_DISPATCH_USE_IFUNC. Defined to 0 otherwise.
+*/
+#ifndef SIMDPP_DISPATCH_HAS_IFUNC
+#if (__GNUC__ || __clang__) && __ELF__ && !__INTEL_COMPILER &&                  \
+    (__linux__ || __FreeBSD__) && (__x86_64__ || __i386__ || __aarch64__ ||     \
+        __arm__ || __powerpc64__)
+#define SIMDPP_DISPATCH_HAS_IFUNC 1
+#else
+#define SIMDPP_DISPATCH_HAS_IFUNC 0
+#endif
+#endif
+
+/** @def SIMDPP_DISPATCH_USE_IFUNC
+    If defined to nonzero before simd.h is included and the target supports
+    GNU indirect functions (see SIMDPP_DISPATCH_HAS_IFUNC), non-template
+    dispatchers created by SIMDPP_MAKE_DISPATCHER are implemented as indirect
+    functions. The version is selected once by the dynamic linker when the
+    program or library is loaded and calls are then bound directly to the
+    selected function. Compared to the default mode this removes the check of
+    the cached function pointer from each call.
+
+    The resolver runs very early, before any static initializers of the
+    program are executed. Consequently, the expression supplied via
+    SIMDPP_USER_ARCH_INFO must not depend on any state set up at runtime and
+    must not use facilities such as iostreams. simdpp::get_arch_raw_cpuid() is
+    suitable, simdpp::get_arch_linux_cpuinfo() is not. The default
+    simdpp::detected_arch() is suitable only on x86, where it uses CPUID.
+    For the same reason the architecture override (see
+    simdpp::set_arch_override()) is not applied.
+
+    Template dispatchers can't be implemented as indirect functions and always
+    use the default mode.
+*/
+#ifndef SIMDPP_DISPATCH_USE_IFUNC
+#define SIMDPP_DISPATCH_USE_IFUNC 0
+#endif
+
+/** @def SIMDPP_DISPATCH_TELEMETRY
+    If defined to nonzero before simd.h is included, the dispatchers created by
+    SIMDPP_MAKE_DISPATCHER count their calls. Each thread increments its own
+    counter, thus the overhead is a thread-local variable access and an
+    increment per call. The counts are reported by simdpp::list_dispatchers()
+    and the functions in simdpp/dispatch/telemetry.h.
+
+    IFUNC dispatchers can't count calls, thus SIMDPP_DISPATCH_USE_IFUNC is
+    ignored when this macro is enabled.
+*/
+#ifndef SIMDPP_DISPATCH_TELEMETRY
+#define SIMDPP_DISPATCH_TELEMETRY 0
+#endif
+
 #if SIMDPP_EMIT_DISPATCHER
 #include <simdpp/detail/preprocessor/punctuation/comma_if.hpp>
+#include <simdpp/detail/preprocessor/stringize.hpp>
 #include <simdpp/detail/preprocessor/seq/elem.hpp>
 #include <simdpp/detail/preprocessor/seq/for_each_i.hpp>
 #include <simdpp/detail/preprocessor/tuple/rem.hpp>
 #include <simdpp/dispatch/collect_macros_generated.h>
+#include <simdpp/dispatch/registry.h>
 
 // When debugging this code, it's a good idea to familiarize yourself with
 // advanced preprocessor techniques first. Several resources follow:
@@ -258,6 +314,33 @@
 
 #define SIMDPP_DETAIL_RETURN_TOKEN() return
 
+// Will expand to a string literal containing the given tokens, e.g.
+// "my_function(int, float)"
+#define SIMDPP_DETAIL_STRINGIZE_ALL(...) SIMDPP_DETAIL_STRINGIZE_ALL_I(__VA_ARGS__)
+#define SIMDPP_DETAIL_STRINGIZE_ALL_I(...) #__VA_ARGS__
+
+// Each dispatcher has a helper struct that holds its state. The state is kept
+// outside the dispatched function, so that the dispatcher can be registered in
+// the global registry (see simdpp/dispatch/registry.h) and resolved before the
+// first call. The line number is appended to the name to support overloaded
+// dispatched functions.
+#define SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)                               \
+    SIMDPP_PP_CAT(SIMDPP_PP_CAT(simdpp_detail_dispatcher_, NAME),               \
+                  SIMDPP_PP_CAT(_, __LINE__))
+
+#define SIMDPP_DETAIL_DISPATCHER_NAME_STRING(TEMPLATE_ARGS, NAME, ARGS)         \
+    SIMDPP_DETAIL_STRINGIZE_ALL(NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)     \
+                                (SIMDPP_DETAIL_TYPES(ARGS)))
+
+#if SIMDPP_DISPATCH_TELEMETRY
+#define SIMDPP_DETAIL_DISPATCHER_COUNT_CALL(State)                              \
+    static thread_local ::simdpp::detail::ThreadCallCounter                     \
+        simdpp_call_counter(State::entry);                                      \
+    simdpp_call_counter.increment();
+#else
+#define SIMDPP_DETAIL_DISPATCHER_COUNT_CALL(State)
+#endif
+
 #define SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(TEMPLATE_PREFIX, TEMPLATE_ARGS, R, NAME, ARGS) \
                                                                                 \
 SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
@@ -265,22 +348,130 @@ SIMDPP_DISPATCH_DECLARE_FUNCTIONS(
      SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
                                                                                 \
 SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
-SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
-{                                                                               \
+struct SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME) {                              \
     using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
-    static FunPtr selected = nullptr;                                           \
-    if (selected == nullptr) {                                                  \
+    static std::atomic<FunPtr> selected_ptr;                                    \
+    static ::simdpp::detail::DispatcherEntry entry;                             \
+    static ::simdpp::detail::DispatcherRegistrar registrar;                     \
+                                                                                \
+    static FunPtr resolve()                                                     \
+    {                                                                           \
         ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
         SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                             \
             (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)              \
-        ::simdpp::detail::FnVersion version =                                   \
-            ::simdpp::detail::select_version_any(versions,                      \
-                SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO);              \
-        selected = reinterpret_cast<FunPtr>(version.fun_ptr);                   \
+        return ::simdpp::detail::resolve_dispatcher(selected_ptr, entry,        \
+            versions, SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO);        \
+    }                                                                           \
+                                                                                \
+    static void resolve_erased() { resolve(); }                                 \
+};                                                                              \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
+std::atomic<SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS))>           \
+    SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)                                   \
+        SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)::selected_ptr(nullptr);          \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
+::simdpp::detail::DispatcherEntry SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)     \
+    SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)::entry = {                           \
+        SIMDPP_DETAIL_DISPATCHER_NAME_STRING(TEMPLATE_ARGS, NAME, ARGS),        \
+        &SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)                              \
+            SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)::resolve_erased,             \
+        {nullptr}, {0}, nullptr, nullptr, 0                                     \
+    };                                                                          \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
+::simdpp::detail::DispatcherRegistrar SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME) \
+    SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)::registrar(                          \
+        SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)                               \
+            SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)::entry);                     \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
+SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    using State = SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)                     \
+        SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS);                                 \
+    /* instantiates the registrar of dispatcher templates */                    \
+    static_cast<void>(State::registrar);                                        \
+    SIMDPP_DETAIL_DISPATCHER_COUNT_CALL(State)                                  \
+    FunPtr selected = State::selected_ptr.load(std::memory_order_relaxed);      \
+    if (selected == nullptr) {                                                  \
+        selected = State::resolve();                                            \
     }                                                                           \
     SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) selected(SIMDPP_DETAIL_FORWARD(ARGS));  \
 }
 
+// The IFUNC variant of the dispatcher. Instead of defining a function that
+// checks a cached pointer on each call, we define a resolver function and
+// declare the dispatched function as an indirect function (GNU IFUNC) that
+// refers to the resolver. The dynamic linker calls the resolver once when
+// processing relocations and binds the symbol directly to the selected
+// version, thus subsequent calls go through the PLT like calls to any other
+// function in a shared library.
+//
+// The resolver must have a known assembler name, so it's given C linkage.
+// Internal linkage is sufficient because the resolver must be defined in the
+// same translation unit. The line number is appended to the name to support
+// overloaded dispatched functions.
+//
+// The resolver runs before the registry is set up, thus the dispatcher is
+// registered separately and the selection is repeated by
+// resolve_all_dispatchers() just to record it.
+#if SIMDPP_DISPATCH_HAS_IFUNC
+#define SIMDPP_DETAIL_IFUNC_RESOLVER_NAME(NAME)                                 \
+    SIMDPP_PP_CAT(SIMDPP_PP_CAT(simdpp_detail_ifunc_resolver_, NAME),           \
+                  SIMDPP_PP_CAT(_, __LINE__))
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(R, NAME, ARGS)                 \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
+                                                                                \
+struct SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME) {                              \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    static ::simdpp::detail::DispatcherEntry entry;                             \
+    static ::simdpp::detail::DispatcherRegistrar registrar;                     \
+                                                                                \
+    static ::simdpp::detail::FnVersion select()                                 \
+    {                                                                           \
+        ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
+        SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, (NAME), FunPtr)             \
+        return ::simdpp::detail::select_version_any(versions,                   \
+            SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO);                  \
+    }                                                                           \
+                                                                                \
+    static void resolve_erased()                                                \
+    {                                                                           \
+        ::simdpp::detail::record_selected_version(entry, select());             \
+    }                                                                           \
+};                                                                              \
+                                                                                \
+::simdpp::detail::DispatcherEntry SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)::entry = { \
+    SIMDPP_DETAIL_DISPATCHER_NAME_STRING((), NAME, ARGS),                       \
+    &SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)::resolve_erased,                 \
+    {nullptr}, {0}, nullptr, nullptr, 0                                         \
+};                                                                              \
+                                                                                \
+::simdpp::detail::DispatcherRegistrar                                           \
+    SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)::registrar(                       \
+        SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)::entry);                      \
+                                                                                \
+extern "C" {                                                                    \
+static auto SIMDPP_DETAIL_IFUNC_RESOLVER_NAME(NAME)()                           \
+    -> SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS))                 \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    return reinterpret_cast<FunPtr>(                                            \
+        SIMDPP_DETAIL_DISPATCHER_STATE_NAME(NAME)::select().fun_ptr);           \
+}                                                                               \
+}                                                                               \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_TYPES(ARGS))                      \
+    __attribute__((ifunc(SIMDPP_PP_STRINGIZE(                                   \
+        SIMDPP_DETAIL_IFUNC_RESOLVER_NAME(NAME)))));
+#endif
+
 #define SIMDPP_DETAIL_IGNORE_PARENS2(x)                                         \
     SIMDPP_DETAIL_IGNORE_PARENS(SIMDPP_DETAIL_IGNORE_PARENS(x))
 
@@ -298,6 +489,13 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
 // so we use a workaround
 #define SIMDPP_DETAIL_MAKE_DISPATCHER1(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER2(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#if SIMDPP_DISPATCH_USE_IFUNC && SIMDPP_DISPATCH_HAS_IFUNC && !SIMDPP_DISPATCH_TELEMETRY
+#define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC)                                    \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(                                   \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
+#else
 #define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC)                                    \
     SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(                                         \
         (),                                                                     \
@@ -305,6 +503,7 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
         SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
+#endif
 
 #define SIMDPP_DETAIL_MAKE_DISPATCHER4(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER5(DESC)                                    \
@@ -362,8 +561,19 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
     implements the dispatch mechanism.
 
     The dispatch functions check the enabled instruction set and select the
-    best function on first call. The initialization does not introduce race
-    conditions when done concurrently.
+    best function on first call. The selected function pointer is stored in an
+    atomic variable, thus the initialization does not introduce race conditions
+    when done concurrently. If several threads call the dispatcher for the
+    first time at the same moment, each of them may select the version, but
+    only the first result is published and used afterwards. Once initialized,
+    each call costs a single relaxed atomic load and an indirect call; no locks
+    are taken.
+
+    Each dispatcher is added to a global registry during the static
+    initialization of the program. simdpp::resolve_all_dispatchers() can be
+    used to resolve all of them up front and simdpp::list_dispatchers() to
+    inspect the selected versions (see simdpp/dispatch/registry.h). The macro
+    defines a helper struct with a reserved name in the namespace it's used in.
 
     The generated dispatching code links to all versions of the dispatched
     function statically, so techniques to prevent linkers from stripping
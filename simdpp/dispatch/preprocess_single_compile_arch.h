@@ -59,15 +59,30 @@ static inline Arch this_compile_arch()
 #if SIMDPP_ARCH_PP_USE_SSE4_1
     res |= Arch::X86_SSE4_1;
 #endif
+#if SIMDPP_ARCH_PP_USE_SSE4_2
+    res |= Arch::X86_SSE4_2;
+#endif
 #if SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN
     res |= Arch::X86_POPCNT_INSN;
 #endif
+#if SIMDPP_ARCH_PP_USE_PCLMULQDQ
+    res |= Arch::X86_PCLMULQDQ;
+#endif
 #if SIMDPP_ARCH_PP_USE_AVX
     res |= Arch::X86_AVX;
 #endif
 #if SIMDPP_ARCH_PP_USE_AVX2
     res |= Arch::X86_AVX2;
 #endif
+#if SIMDPP_ARCH_PP_USE_BMI1
+    res |= Arch::X86_BMI1;
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+    res |= Arch::X86_BMI2;
+#endif
+#if SIMDPP_ARCH_PP_USE_LZCNT
+    res |= Arch::X86_LZCNT;
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
     res |= Arch::X86_FMA3;
 #endif
@@ -89,6 +104,30 @@ static inline Arch this_compile_arch()
 #if SIMDPP_ARCH_PP_USE_AVX512VL
     res |= Arch::X86_AVX512VL;
 #endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+    res |= Arch::X86_AVX512VBMI;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+    res |= Arch::X86_AVX512VBMI2;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    res |= Arch::X86_AVX512VNNI;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+    res |= Arch::X86_AVX512BITALG;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+    res |= Arch::X86_AVX512VPOPCNTDQ;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512IFMA
+    res |= Arch::X86_AVX512IFMA;
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+    res |= Arch::X86_GFNI;
+#endif
+#if SIMDPP_ARCH_PP_USE_VAES
+    res |= Arch::X86_VAES;
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
     res |= Arch::ARM_NEON;
 #endif
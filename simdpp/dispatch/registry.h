@@ -0,0 +1,243 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_REGISTRY_H
+#define LIBSIMDPP_DISPATCH_REGISTRY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <simdpp/dispatch/arch_override.h>
+#include <simdpp/dispatch/dispatcher.h>
+
+namespace simdpp {
+
+/** Describes a dispatcher created by SIMDPP_MAKE_DISPATCHER.
+*/
+struct DispatcherInfo {
+    /** The name and the parameter types of the dispatched function as written
+        in the SIMDPP_MAKE_DISPATCHER invocation, e.g. "my_function(int, float)".
+        The amount of whitespace between the tokens depends on the
+        preprocessor. All instantiations of a dispatched function template
+        share the same name.
+    */
+    const char* name;
+
+    /** The name of the architecture namespace of the selected version, e.g.
+        "arch_sse2". nullptr if the dispatcher has not been resolved yet.
+    */
+    const char* arch_name;
+
+    /** The instruction sets required by the selected version. Arch::NONE_NULL
+        if the dispatcher has fallen back to the non-SIMD version or has not
+        been resolved yet.
+    */
+    Arch arch;
+
+    /** The number of calls to the dispatcher. Calls are counted only if the
+        dispatcher has been compiled with SIMDPP_DISPATCH_TELEMETRY enabled,
+        see simdpp/dispatch/telemetry.h
+    */
+    std::uint64_t calls;
+};
+
+namespace detail {
+
+struct ThreadCallCounter;
+
+/*  Holds the state of a single dispatcher that is shared with the global
+    registry. All instances are constant-initialized, so that the dispatchers
+    can be called at any time during the dynamic initialization of the program.
+*/
+struct DispatcherEntry {
+    const char* name;
+
+    // Selects the version and caches it in the dispatcher
+    void (*resolve)();
+
+    // The arch_name of the selected version, nullptr until resolved
+    std::atomic<const char*> arch_name;
+
+    // The needed_arch of the selected version
+    std::atomic<std::uint32_t> arch;
+
+    // The next entry in the registry
+    DispatcherEntry* next;
+
+    // The call counters of the threads that have called the dispatcher and
+    // the number of calls from the threads that have already exited. Used only
+    // if SIMDPP_DISPATCH_TELEMETRY is enabled. Guarded by
+    // dispatcher_telemetry_mutex().
+    ThreadCallCounter* thread_counters;
+    std::uint64_t exited_thread_calls;
+};
+
+inline std::atomic<DispatcherEntry*>& dispatcher_registry_head()
+{
+    static std::atomic<DispatcherEntry*> head(nullptr);
+    return head;
+}
+
+/*  Adds a dispatcher entry to the global registry on construction. The entries
+    are never removed, thus this must not be used in libraries that may be
+    unloaded.
+*/
+struct DispatcherRegistrar {
+    explicit DispatcherRegistrar(DispatcherEntry& entry)
+    {
+        std::atomic<DispatcherEntry*>& head = dispatcher_registry_head();
+        DispatcherEntry* next = head.load(std::memory_order_relaxed);
+        do {
+            entry.next = next;
+        } while (!head.compare_exchange_weak(next, &entry,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+    }
+};
+
+inline std::mutex& dispatcher_telemetry_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/*  Counts the calls to a dispatcher from a single thread. Each thread gets its
+    own counter, so that counting does not introduce contention between the
+    threads calling the same dispatcher. The counter is only ever incremented
+    by its thread, thus a relaxed load and store are sufficient.
+*/
+struct ThreadCallCounter {
+    explicit ThreadCallCounter(DispatcherEntry& e) :
+        entry(e), count(0)
+    {
+        std::lock_guard<std::mutex> lock(dispatcher_telemetry_mutex());
+        next = entry.thread_counters;
+        entry.thread_counters = this;
+    }
+
+    ~ThreadCallCounter()
+    {
+        std::lock_guard<std::mutex> lock(dispatcher_telemetry_mutex());
+        entry.exited_thread_calls += count.load(std::memory_order_relaxed);
+        ThreadCallCounter** p = &entry.thread_counters;
+        while (*p != this)
+            p = &(*p)->next;
+        *p = next;
+    }
+
+    ThreadCallCounter(const ThreadCallCounter&) = delete;
+    ThreadCallCounter& operator=(const ThreadCallCounter&) = delete;
+
+    void increment()
+    {
+        count.store(count.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+    }
+
+    DispatcherEntry& entry;
+    std::atomic<std::uint64_t> count;
+    ThreadCallCounter* next;
+};
+
+inline std::uint64_t get_dispatcher_calls(DispatcherEntry& entry)
+{
+    std::lock_guard<std::mutex> lock(dispatcher_telemetry_mutex());
+    std::uint64_t res = entry.exited_thread_calls;
+    for (ThreadCallCounter* c = entry.thread_counters; c != nullptr; c = c->next)
+        res += c->count.load(std::memory_order_relaxed);
+    return res;
+}
+
+inline void record_selected_version(DispatcherEntry& entry,
+                                    const FnVersion& version)
+{
+    entry.arch.store(static_cast<std::uint32_t>(version.needed_arch),
+                     std::memory_order_relaxed);
+    entry.arch_name.store(version.arch_name, std::memory_order_release);
+}
+
+/*  Selects the best version out of @a versions for @a arch, adjusted according
+    to the architecture override (see set_arch_override()), publishes it to
+    @a cache and records the selection in @a entry. Returns the function that should be
+    called, which may differ from the selected version if another thread has
+    published a function in the meantime.
+*/
+template<class FunPtr>
+FunPtr resolve_dispatcher(std::atomic<FunPtr>& cache, DispatcherEntry& entry,
+                          FnVersion* versions, unsigned size, Arch arch)
+{
+    FnVersion version = select_version_any(versions, size,
+                                           apply_arch_override(arch));
+    FunPtr selected = reinterpret_cast<FunPtr>(version.fun_ptr);
+    FunPtr published = publish_selected_version(cache, selected);
+    if (published == selected) {
+        record_selected_version(entry, version);
+    }
+    return published;
+}
+
+} // namespace detail
+
+/** Resolves all dispatchers created by SIMDPP_MAKE_DISPATCHER in the program.
+    By default each dispatcher selects the version to call on its first call,
+    which puts the CPU feature detection and version selection on the path of
+    that call. Calling this function during startup moves this work out of the
+    latency-critical paths.
+
+    Dispatchers that have already been resolved are not affected. Dispatcher
+    templates are registered when instantiated, which happens during static
+    initialization of the program as they are instantiated explicitly.
+
+    The function is thread-safe and may be called concurrently with the
+    dispatched functions. It must not be called before the dynamic
+    initialization of the translation units containing the dispatchers has
+    completed, e.g. from constructors of static objects.
+*/
+inline void resolve_all_dispatchers()
+{
+    detail::DispatcherEntry* entry =
+            detail::dispatcher_registry_head().load(std::memory_order_acquire);
+    for (; entry != nullptr; entry = entry->next) {
+        if (entry->arch_name.load(std::memory_order_acquire) == nullptr) {
+            entry->resolve();
+        }
+    }
+}
+
+/** Returns information about all dispatchers created by SIMDPP_MAKE_DISPATCHER
+    in the program, including the architecture of the selected version for
+    dispatchers that have already been resolved. The order of the returned
+    elements is unspecified.
+
+    Dispatchers created in the IFUNC mode (see SIMDPP_DISPATCH_USE_IFUNC) are
+    bound by the dynamic linker, but the selection is reported only after
+    resolve_all_dispatchers() has been called.
+*/
+inline std::vector<DispatcherInfo> list_dispatchers()
+{
+    std::vector<DispatcherInfo> res;
+    detail::DispatcherEntry* entry =
+            detail::dispatcher_registry_head().load(std::memory_order_acquire);
+    for (; entry != nullptr; entry = entry->next) {
+        DispatcherInfo info;
+        info.name = entry->name;
+        info.arch_name = entry->arch_name.load(std::memory_order_acquire);
+        info.arch = static_cast<Arch>(entry->arch.load(std::memory_order_relaxed));
+        info.calls = detail::get_dispatcher_calls(*entry);
+        res.push_back(info);
+    }
+    return res;
+}
+
+} // namespace simdpp
+
+#endif
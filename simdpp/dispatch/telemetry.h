@@ -0,0 +1,130 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_TELEMETRY_H
+#define LIBSIMDPP_DISPATCH_TELEMETRY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <simdpp/dispatch/registry.h>
+
+namespace simdpp {
+
+/** Returns true if the dispatcher described by @a info has been resolved to
+    the version that does not use any SIMD instruction sets.
+*/
+inline bool is_fallback_dispatch(const DispatcherInfo& info)
+{
+    return info.arch_name != nullptr && info.arch == Arch::NONE_NULL;
+}
+
+namespace detail {
+
+// Returns the dispatchers sorted by the number of calls, hottest first
+inline std::vector<DispatcherInfo> get_sorted_dispatchers()
+{
+    std::vector<DispatcherInfo> infos = list_dispatchers();
+    std::sort(infos.begin(), infos.end(),
+              [](const DispatcherInfo& lhs, const DispatcherInfo& rhs) {
+                  if (lhs.calls != rhs.calls)
+                      return lhs.calls > rhs.calls;
+                  return std::strcmp(lhs.name, rhs.name) < 0;
+              });
+    return infos;
+}
+
+inline void print_json_string(std::ostream& out, const char* str)
+{
+    const char* hex = "0123456789abcdef";
+    out << '"';
+    for (; *str != '\0'; ++str) {
+        unsigned char c = *str;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (c < 0x20) {
+            out << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace detail
+
+/** Prints the selected version and the number of calls of each dispatcher
+    created by SIMDPP_MAKE_DISPATCHER as a human-readable table. The hottest
+    dispatchers are listed first. Dispatchers that have fallen back to the
+    non-SIMD version are marked with "fallback".
+
+    The number of calls is available only for dispatchers compiled with
+    SIMDPP_DISPATCH_TELEMETRY enabled.
+*/
+inline void dump_dispatch_telemetry(std::ostream& out)
+{
+    std::vector<DispatcherInfo> infos =
+            ::simdpp::detail::get_sorted_dispatchers();
+
+    std::size_t name_width = 10;
+    for (const auto& info : infos)
+        name_width = std::max(name_width, std::strlen(info.name));
+
+    out << std::string("function") << std::string(name_width - 8 + 2, ' ')
+        << "arch                    calls\n";
+    for (const auto& info : infos) {
+        std::string arch = info.arch_name ? info.arch_name : "(unresolved)";
+        out << info.name << std::string(name_width - std::strlen(info.name) + 2, ' ')
+            << arch << std::string(arch.size() < 24 ? 24 - arch.size() : 1, ' ')
+            << info.calls;
+        if (is_fallback_dispatch(info))
+            out << "  fallback";
+        out << '\n';
+    }
+}
+
+/** Prints the same information as dump_dispatch_telemetry() as a JSON object
+    of the following form:
+
+    {"dispatchers":[{"name":"f(int)","arch":"arch_sse2","calls":10,
+                     "fallback":false}, ...]}
+
+    The "arch" member is null for dispatchers that have not been resolved yet.
+*/
+inline void dump_dispatch_telemetry_json(std::ostream& out)
+{
+    std::vector<DispatcherInfo> infos =
+            ::simdpp::detail::get_sorted_dispatchers();
+
+    out << "{\"dispatchers\":[";
+    for (std::size_t i = 0; i < infos.size(); ++i) {
+        const DispatcherInfo& info = infos[i];
+        if (i != 0)
+            out << ',';
+        out << "{\"name\":";
+        ::simdpp::detail::print_json_string(out, info.name);
+        out << ",\"arch\":";
+        if (info.arch_name)
+            ::simdpp::detail::print_json_string(out, info.arch_name);
+        else
+            out << "null";
+        out << ",\"calls\":" << info.calls
+            << ",\"fallback\":" << (is_fallback_dispatch(info) ? "true" : "false")
+            << '}';
+    }
+    out << "]}\n";
+}
+
+} // namespace simdpp
+
+#endif
@@ -227,6 +227,20 @@ struct expr_vec_load_u : expr_vec_construct<expr_vec_load_u> {
     expr_vec_load_u(const char* x) : a(x) {}
 };
 
+struct expr_vec_load_first : expr_vec_construct<expr_vec_load_first> {
+    const char* a;
+    unsigned n;
+
+    expr_vec_load_first(const char* x, unsigned y) : a(x), n(y) {}
+};
+
+struct expr_vec_load_last : expr_vec_construct<expr_vec_load_last> {
+    const char* a;
+    unsigned n;
+
+    expr_vec_load_last(const char* x, unsigned y) : a(x), n(y) {}
+};
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
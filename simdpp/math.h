@@ -0,0 +1,25 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+#define LIBSIMDPP_SIMDPP_MATH_H
+
+/*  Elementary functions on float32 and float64 vectors. This header is not
+    included by simd.h and must be included separately. The same
+    configuration macros as for simd.h apply.
+*/
+
+#include <simdpp/simd.h>
+
+#include <simdpp/math/erf.h>
+#include <simdpp/math/exp.h>
+#include <simdpp/math/log.h>
+#include <simdpp/math/pow.h>
+#include <simdpp/math/sin_cos.h>
+#include <simdpp/math/tanh.h>
+
+#endif
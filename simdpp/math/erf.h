@@ -0,0 +1,73 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_ERF_H
+#define LIBSIMDPP_SIMDPP_MATH_ERF_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/erf.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the error function.
+
+    @code
+    r0 = erf(a0)
+    ...
+    rN = erf(aN)
+    @endcode
+
+    The maximum error is 2 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> erf(const float32<N,E>& a)
+{
+    return detail::math::i_erf(a.eval());
+}
+
+/** Computes the error function.
+
+    @code
+    r0 = erf(a0)
+    ...
+    rN = erf(aN)
+    @endcode
+
+    The maximum error is 1.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> erf(const float64<N,E>& a)
+{
+    return detail::math::i_erf(a.eval());
+}
+
+/** Computes an approximation of the error function using a rational
+    function.
+
+    @code
+    r0 = erf(a0)
+    ...
+    rN = erf(aN)
+    @endcode
+
+    The maximum absolute error is 5e-7. NaN arguments are not supported.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> erf_fast(const float32<N,E>& a)
+{
+    return detail::math::i_erf_fast(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,72 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_EXP_H
+#define LIBSIMDPP_SIMDPP_MATH_EXP_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the base-e exponential.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 1 ULP. Subnormal results are supported.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> exp(const float32<N,E>& a)
+{
+    return detail::math::i_exp(a.eval());
+}
+
+/** Computes the base-e exponential.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 1 ULP. Subnormal results are supported.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> exp(const float64<N,E>& a)
+{
+    return detail::math::i_exp(a.eval());
+}
+
+/** Computes an approximation of the base-e exponential.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum relative error is 1e-5 for normal results.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> exp_fast(const float32<N,E>& a)
+{
+    return detail::math::i_exp_fast(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
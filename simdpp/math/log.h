@@ -0,0 +1,75 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_LOG_H
+#define LIBSIMDPP_SIMDPP_MATH_LOG_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/log.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the natural logarithm.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 1 ULP. Negative arguments produce NaN and
+    zero produces negative infinity. Subnormal arguments are supported.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> log(const float32<N,E>& a)
+{
+    return detail::math::i_log(a.eval());
+}
+
+/** Computes the natural logarithm.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 1 ULP. Negative arguments produce NaN and
+    zero produces negative infinity. Subnormal arguments are supported.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> log(const float64<N,E>& a)
+{
+    return detail::math::i_log(a.eval());
+}
+
+/** Computes an approximation of the natural logarithm.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum relative error is 2e-6. The arguments must be positive normal
+    numbers; the results for other arguments are unspecified.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> log_fast(const float32<N,E>& a)
+{
+    return detail::math::i_log_fast(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
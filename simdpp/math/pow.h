@@ -0,0 +1,59 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_POW_H
+#define LIBSIMDPP_SIMDPP_MATH_POW_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/pow.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Raises @a a to the power of @a b.
+
+    @code
+    r0 = pow(a0, b0)
+    ...
+    rN = pow(aN, bN)
+    @endcode
+
+    The computation is performed in double precision, so the result is
+    correctly rounded in most cases and the maximum error is 1 ULP.
+    The special cases follow the C99 pow() function.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float32<N,expr_empty> pow(const float32<N,E1>& a, const float32<N,E2>& b)
+{
+    return detail::math::i_pow(a.eval(), b.eval());
+}
+
+/** Raises @a a to the power of @a b.
+
+    @code
+    r0 = pow(a0, b0)
+    ...
+    rN = pow(aN, bN)
+    @endcode
+
+    The logarithm of @a a is computed with extra precision. The maximum error
+    is 1.5 ULP. The special cases follow the C99 pow() function.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float64<N,expr_empty> pow(const float64<N,E1>& a, const float64<N,E2>& b)
+{
+    return detail::math::i_pow(a.eval(), b.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,94 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_SIN_COS_H
+#define LIBSIMDPP_SIMDPP_MATH_SIN_COS_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/sin_cos.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the sine of an angle in radians.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 2 ULP for |a| <= pi. The argument reduction is not
+    exact, so the error grows near the zeros of the function for larger
+    arguments. The absolute error stays below 1e-7 for |a| < 8192. Infinite
+    arguments produce NaN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> sin(const float32<N,E>& a)
+{
+    return detail::math::i_sin_cos<0>(a.eval());
+}
+
+/** Computes the sine of an angle in radians.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 1.5 ULP for |a| < 1e8, except in the immediate
+    vicinity of the nonzero roots where the absolute error is below 5e-23.
+    The argument reduction loses accuracy for larger arguments. Infinite
+    arguments produce NaN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> sin(const float64<N,E>& a)
+{
+    return detail::math::i_sin_cos<0>(a.eval());
+}
+
+/** Computes the cosine of an angle in radians.
+
+    @code
+    r0 = cos(a0)
+    ...
+    rN = cos(aN)
+    @endcode
+
+    The accuracy is the same as of sin().
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> cos(const float32<N,E>& a)
+{
+    return detail::math::i_sin_cos<1>(a.eval());
+}
+
+/** Computes the cosine of an angle in radians.
+
+    @code
+    r0 = cos(a0)
+    ...
+    rN = cos(aN)
+    @endcode
+
+    The accuracy is the same as of sin().
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> cos(const float64<N,E>& a)
+{
+    return detail::math::i_sin_cos<1>(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
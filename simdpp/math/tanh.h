@@ -0,0 +1,73 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_TANH_H
+#define LIBSIMDPP_SIMDPP_MATH_TANH_H
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_H
+    #error "This file must be included through simdpp/math.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/tanh.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the hyperbolic tangent.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 1.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> tanh(const float32<N,E>& a)
+{
+    return detail::math::i_tanh(a.eval());
+}
+
+/** Computes the hyperbolic tangent.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 1.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> tanh(const float64<N,E>& a)
+{
+    return detail::math::i_tanh(a.eval());
+}
+
+/** Computes an approximation of the hyperbolic tangent using a rational
+    function.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum absolute error is 5e-7. NaN arguments are not supported.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> tanh_fast(const float32<N,E>& a)
+{
+    return detail::math::i_tanh_fast(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
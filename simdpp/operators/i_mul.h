@@ -71,6 +71,33 @@ typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(operator*, expr_mul_lo, any_int32, int32)
 
+/** Multiplies 64-bit values and returns the lower part of the multiplication
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, 7}
+    @icost{NEON, 5}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 14}
+    @icost{AVX2, 7}
+    @icost{NEON, 10}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        operator*(const any_int64<N,V1>& a,
+                  const any_int64<N,V2>& b)
+{
+    return { { a.wrapped(), b.wrapped() } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(operator*, expr_mul_lo, any_int64, int64)
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
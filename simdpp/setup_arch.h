@@ -41,11 +41,21 @@
 #else
 #define SIMDPP_USE_SSE4_1 0
 #endif
+#if SIMDPP_ARCH_PP_USE_SSE4_2
+#define SIMDPP_USE_SSE4_2 1
+#else
+#define SIMDPP_USE_SSE4_2 0
+#endif
 #if SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN
 #define SIMDPP_USE_X86_POPCNT_INSN 1
 #else
 #define SIMDPP_USE_X86_POPCNT_INSN 0
 #endif
+#if SIMDPP_ARCH_PP_USE_PCLMULQDQ
+#define SIMDPP_USE_PCLMULQDQ 1
+#else
+#define SIMDPP_USE_PCLMULQDQ 0
+#endif
 #if SIMDPP_ARCH_PP_USE_AVX
 #define SIMDPP_USE_AVX 1
 #else
@@ -56,6 +66,21 @@
 #else
 #define SIMDPP_USE_AVX2 0
 #endif
+#if SIMDPP_ARCH_PP_USE_BMI1
+#define SIMDPP_USE_BMI1 1
+#else
+#define SIMDPP_USE_BMI1 0
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+#define SIMDPP_USE_BMI2 1
+#else
+#define SIMDPP_USE_BMI2 0
+#endif
+#if SIMDPP_ARCH_PP_USE_LZCNT
+#define SIMDPP_USE_LZCNT 1
+#else
+#define SIMDPP_USE_LZCNT 0
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
 #define SIMDPP_USE_FMA3 1
 #else
@@ -91,6 +116,46 @@
 #else
 #define SIMDPP_USE_AVX512VL 0
 #endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+#define SIMDPP_USE_AVX512VBMI 1
+#else
+#define SIMDPP_USE_AVX512VBMI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#define SIMDPP_USE_AVX512VBMI2 1
+#else
+#define SIMDPP_USE_AVX512VBMI2 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_USE_AVX512VNNI 1
+#else
+#define SIMDPP_USE_AVX512VNNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+#define SIMDPP_USE_AVX512BITALG 1
+#else
+#define SIMDPP_USE_AVX512BITALG 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#define SIMDPP_USE_AVX512VPOPCNTDQ 1
+#else
+#define SIMDPP_USE_AVX512VPOPCNTDQ 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512IFMA
+#define SIMDPP_USE_AVX512IFMA 1
+#else
+#define SIMDPP_USE_AVX512IFMA 0
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+#define SIMDPP_USE_GFNI 1
+#else
+#define SIMDPP_USE_GFNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_VAES
+#define SIMDPP_USE_VAES 1
+#else
+#define SIMDPP_USE_VAES 0
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
 #define SIMDPP_USE_NEON 1
 #else
@@ -149,11 +214,21 @@
 #else
 #define SIMDPP_NS_ID_SSE4_1
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+#define SIMDPP_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+#else
+#define SIMDPP_NS_ID_SSE4_2
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
 #define SIMDPP_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
 #else
 #define SIMDPP_NS_ID_POPCNT_INSN
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+#define SIMDPP_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+#else
+#define SIMDPP_NS_ID_PCLMULQDQ
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_AVX
 #define SIMDPP_NS_ID_AVX SIMDPP_INSN_ID_AVX
 #else
@@ -164,6 +239,21 @@
 #else
 #define SIMDPP_NS_ID_AVX2
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_BMI1
+#define SIMDPP_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+#else
+#define SIMDPP_NS_ID_BMI1
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_BMI2
+#define SIMDPP_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+#else
+#define SIMDPP_NS_ID_BMI2
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_LZCNT
+#define SIMDPP_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+#else
+#define SIMDPP_NS_ID_LZCNT
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_FMA3
 #define SIMDPP_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
 #else
@@ -199,6 +289,46 @@
 #else
 #define SIMDPP_NS_ID_AVX512VL
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#define SIMDPP_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+#else
+#define SIMDPP_NS_ID_AVX512VBMI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+#define SIMDPP_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+#else
+#define SIMDPP_NS_ID_AVX512VBMI2
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#define SIMDPP_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+#else
+#define SIMDPP_NS_ID_AVX512VNNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+#define SIMDPP_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+#else
+#define SIMDPP_NS_ID_AVX512BITALG
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+#else
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+#define SIMDPP_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+#else
+#define SIMDPP_NS_ID_AVX512IFMA
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_GFNI
+#define SIMDPP_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+#else
+#define SIMDPP_NS_ID_GFNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_VAES
+#define SIMDPP_NS_ID_VAES SIMDPP_INSN_ID_VAES
+#else
+#define SIMDPP_NS_ID_VAES
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_NEON
 #define SIMDPP_NS_ID_NEON SIMDPP_INSN_ID_NEON
 #else
@@ -230,19 +360,32 @@
 #define SIMDPP_NS_ID_MSA
 #endif
 
-#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE22(arch,                           \
+#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE35(arch,                           \
     SIMDPP_NS_ID_NULL,                                                          \
     SIMDPP_NS_ID_SSE2,                                                          \
     SIMDPP_NS_ID_SSE3,                                                          \
     SIMDPP_NS_ID_SSSE3,                                                         \
     SIMDPP_NS_ID_SSE4_1,                                                        \
+    SIMDPP_NS_ID_SSE4_2,                                                        \
     SIMDPP_NS_ID_POPCNT_INSN,                                                   \
+    SIMDPP_NS_ID_PCLMULQDQ,                                                     \
     SIMDPP_NS_ID_AVX,                                                           \
     SIMDPP_NS_ID_AVX2,                                                          \
+    SIMDPP_NS_ID_BMI1,                                                          \
+    SIMDPP_NS_ID_BMI2,                                                          \
+    SIMDPP_NS_ID_LZCNT,                                                         \
     SIMDPP_NS_ID_AVX512F,                                                       \
     SIMDPP_NS_ID_AVX512BW,                                                      \
     SIMDPP_NS_ID_AVX512DQ,                                                      \
     SIMDPP_NS_ID_AVX512VL,                                                      \
+    SIMDPP_NS_ID_AVX512VBMI,                                                    \
+    SIMDPP_NS_ID_AVX512VBMI2,                                                   \
+    SIMDPP_NS_ID_AVX512VNNI,                                                    \
+    SIMDPP_NS_ID_AVX512BITALG,                                                  \
+    SIMDPP_NS_ID_AVX512VPOPCNTDQ,                                               \
+    SIMDPP_NS_ID_AVX512IFMA,                                                    \
+    SIMDPP_NS_ID_GFNI,                                                          \
+    SIMDPP_NS_ID_VAES,                                                          \
     SIMDPP_NS_ID_FMA3,                                                          \
     SIMDPP_NS_ID_FMA4,                                                          \
     SIMDPP_NS_ID_XOP,                                                           \
@@ -277,6 +420,14 @@
     #include <smmintrin.h>
 #endif
 
+#if SIMDPP_USE_SSE4_2
+    #include <nmmintrin.h>
+#endif
+
+#if SIMDPP_USE_PCLMULQDQ
+    #include <wmmintrin.h>
+#endif
+
 #if SIMDPP_USE_AVX
     #include <immintrin.h>
 #endif
@@ -304,6 +455,14 @@
     #include <immintrin.h>
 #endif
 
+#if SIMDPP_USE_GFNI || SIMDPP_USE_VAES
+    #include <immintrin.h>
+#endif
+
+#if SIMDPP_USE_BMI1 || SIMDPP_USE_BMI2 || SIMDPP_USE_LZCNT
+    #include <immintrin.h>
+#endif
+
 #if SIMDPP_USE_NEON || SIMDPP_USE_NEON_FLT_SP
     #include <arm_neon.h>
 #endif
@@ -18,20 +18,27 @@
 
 #include <simdpp/core/align.h>
 #include <simdpp/core/aligned_allocator.h>
+#include <simdpp/core/base64.h>
 #include <simdpp/core/bit_and.h>
 #include <simdpp/core/bit_andnot.h>
 #include <simdpp/core/bit_not.h>
 #include <simdpp/core/bit_or.h>
 #include <simdpp/core/bit_xor.h>
+#include <simdpp/core/bitpack.h>
 #include <simdpp/core/blend.h>
+#include <simdpp/core/byte_search.h>
 #include <simdpp/core/cache.h>
 #include <simdpp/core/cast.h>
+#include <simdpp/core/clmul.h>
 #include <simdpp/core/cmp_eq.h>
 #include <simdpp/core/cmp_ge.h>
 #include <simdpp/core/cmp_gt.h>
 #include <simdpp/core/cmp_le.h>
 #include <simdpp/core/cmp_lt.h>
 #include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/compress.h>
+#include <simdpp/core/crc.h>
+#include <simdpp/core/divider.h>
 #include <simdpp/core/extract.h>
 #include <simdpp/core/extract_bits.h>
 #include <simdpp/core/f_abs.h>
@@ -60,6 +67,10 @@
 #include <simdpp/core/f_sub.h>
 #include <simdpp/core/f_trunc.h>
 #include <simdpp/core/for_each.h>
+#include <simdpp/core/gather.h>
+#include <simdpp/core/group_match.h>
+#include <simdpp/core/hash.h>
+#include <simdpp/core/hex.h>
 #include <simdpp/core/i_abs.h>
 #include <simdpp/core/i_add.h>
 #include <simdpp/core/i_add_sat.h>
@@ -79,12 +90,16 @@
 #include <simdpp/core/i_reduce_mul.h>
 #include <simdpp/core/i_reduce_or.h>
 #include <simdpp/core/i_reduce_popcnt.h>
+#include <simdpp/core/i_rotate.h>
 #include <simdpp/core/i_shift_l.h>
 #include <simdpp/core/i_shift_r.h>
 #include <simdpp/core/i_sub.h>
 #include <simdpp/core/i_sub_sat.h>
 #include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
+#include <simdpp/core/load_first.h>
+#include <simdpp/core/load_last.h>
+#include <simdpp/core/load_masked.h>
 #include <simdpp/core/load_packed2.h>
 #include <simdpp/core/load_packed3.h>
 #include <simdpp/core/load_packed4.h>
@@ -100,12 +115,15 @@
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/permute_bytes16.h>
 #include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/scan.h>
+#include <simdpp/core/scatter.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/shuffle1.h>
 #include <simdpp/core/shuffle2.h>
 #include <simdpp/core/shuffle4x2.h>
 #include <simdpp/core/shuffle_bytes16.h>
 #include <simdpp/core/shuffle_zbytes16.h>
+#include <simdpp/core/sort.h>
 #include <simdpp/core/splat.h>
 #include <simdpp/core/splat_n.h>
 #include <simdpp/core/store_first.h>
@@ -128,6 +146,8 @@
 #include <simdpp/core/transpose.h>
 #include <simdpp/core/unzip_hi.h>
 #include <simdpp/core/unzip_lo.h>
+#include <simdpp/core/utf8.h>
+#include <simdpp/core/varint.h>
 #include <simdpp/core/zip_hi.h>
 #include <simdpp/core/zip_lo.h>
 #include <simdpp/detail/cast.h>
@@ -201,7 +221,10 @@
     mechanism is not needed, the user can define the @c SIMDPP_NO_DISPATCHER.
 */
 #ifndef SIMDPP_NO_DISPATCHER
+#include <simdpp/dispatch/arch_override.h>
+#include <simdpp/dispatch/detected_arch.h>
 #include <simdpp/dispatch/dispatcher.h>
+#include <simdpp/dispatch/registry.h>
 #include <simdpp/dispatch/make_dispatcher.h>
 #endif
 
@@ -141,6 +141,11 @@ void* test_dispatcher_ret_voidptr(void* x)
     return x;
 }
 
+int test_dispatcher_concurrent(int arg)
+{
+    return arg * 2;
+}
+
 void test_dispatcher_void_pair(const std::pair<int, int>& pair)
 {
     g_test_dispatcher_val = pair.first + pair.second;
@@ -273,6 +278,8 @@ SIMDPP_MAKE_DISPATCHER((void)(test_dispatcher_void4)((int) arg, (int) arg2,
 
 SIMDPP_MAKE_DISPATCHER((void*)(test_dispatcher_ret_voidptr)((void*) x))
 
+SIMDPP_MAKE_DISPATCHER((int)(test_dispatcher_concurrent)((int) arg))
+
 SIMDPP_MAKE_DISPATCHER((void)(test_dispatcher_void_pair)
                        ((const std::pair<int, int>&) pair))
 SIMDPP_MAKE_DISPATCHER((void)(test_dispatcher_void_pair2)
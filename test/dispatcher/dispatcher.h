@@ -38,6 +38,9 @@ void test_dispatcher_void4(int arg, int arg2, int arg3, int arg4);
 
 void* test_dispatcher_ret_voidptr(void* x);
 
+// Called for the first time concurrently from several threads
+int test_dispatcher_concurrent(int arg);
+
 void test_dispatcher_void_pair(const std::pair<int, int>& pair);
 void test_dispatcher_void_pair2(const std::pair<int, int>& pair1,
                                 const std::pair<int, int>& pair2);
@@ -79,3 +82,15 @@ template<class T>
 std::pair<T, T> test_dispatcher_ret_template_nondeductible();
 template<class T, class U>
 std::pair<T, U> test_dispatcher_ret_template2_nondeductible();
+
+// Dispatched using IFUNC mode where supported (in dispatcher_ifunc.cc). The
+// host architecture is used for the selection.
+simdpp::Arch test_dispatcher_ifunc_get_arch();
+int test_dispatcher_ifunc_ret2(int arg, int arg2);
+void test_dispatcher_ifunc_void1(int arg);
+template<class T>
+simdpp::Arch test_dispatcher_ifunc_template_get_arch();
+
+// Dispatched with SIMDPP_DISPATCH_TELEMETRY enabled (in
+// dispatcher_telemetry.cc)
+int test_dispatcher_telemetry_ret1(int arg);
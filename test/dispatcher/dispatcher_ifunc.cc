@@ -0,0 +1,62 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// The IFUNC resolvers run before main(), thus the architecture supplied on the
+// command line can't be used here. The host architecture is used instead.
+#define SIMDPP_DISPATCH_USE_IFUNC 1
+#define SIMDPP_USER_ARCH_INFO test_dispatcher_ifunc_arch_info()
+#include "dispatcher.h"
+#include <simdpp/simd.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+
+#if SIMDPP_EMIT_DISPATCHER
+static simdpp::Arch test_dispatcher_ifunc_arch_info()
+{
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    return simdpp::get_arch_raw_cpuid();
+#else
+    return simdpp::Arch::NONE_NULL;
+#endif
+}
+#endif
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+simdpp::Arch test_dispatcher_ifunc_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+int test_dispatcher_ifunc_ret2(int arg, int arg2)
+{
+    return arg + arg2;
+}
+
+void test_dispatcher_ifunc_void1(int arg)
+{
+    g_test_dispatcher_val = arg;
+}
+
+template<class T>
+simdpp::Arch test_dispatcher_ifunc_template_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((simdpp::Arch)(test_dispatcher_ifunc_get_arch)())
+SIMDPP_MAKE_DISPATCHER((int)(test_dispatcher_ifunc_ret2)((int) arg, (int) arg2))
+SIMDPP_MAKE_DISPATCHER((void)(test_dispatcher_ifunc_void1)((int) arg))
+
+// Template dispatchers fall back to the default mode
+SIMDPP_MAKE_DISPATCHER((template<class T>) (<T>)
+                       (simdpp::Arch) (test_dispatcher_ifunc_template_get_arch) ())
+
+SIMDPP_INSTANTIATE_DISPATCHER(
+    (template simdpp::Arch test_dispatcher_ifunc_template_get_arch<int>())
+)
@@ -0,0 +1,22 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define SIMDPP_DISPATCH_TELEMETRY 1
+#define SIMDPP_USER_ARCH_INFO get_supported_arch()
+#include "dispatcher.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+int test_dispatcher_telemetry_ret1(int arg)
+{
+    return arg + 1;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((int)(test_dispatcher_telemetry_ret1)((int) arg))
@@ -0,0 +1,149 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+struct BitpackRandom {
+    uint32_t x = 0x6b43a9b5;
+
+    uint32_t next()
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x;
+    }
+};
+
+uint32_t bitpack_low_bits(uint32_t x, unsigned b)
+{
+    return b == 32 ? x : x & ((uint32_t(1) << b) - 1);
+}
+
+// Packs the values in the documented layout one bit at a time
+std::vector<uint32_t> ref_bitpack(const std::vector<uint32_t>& in, unsigned b)
+{
+    const unsigned block = in.size();
+    const unsigned lanes = block / 32;
+    std::vector<uint32_t> out(b * lanes, 0);
+    for (unsigned i = 0; i < block; ++i) {
+        unsigned lane = i % lanes;
+        unsigned bit = (i / lanes) * b;
+        for (unsigned k = 0; k < b; ++k, ++bit) {
+            if ((in[i] >> k) & 1)
+                out[(bit / 32) * lanes + lane] |= uint32_t(1) << (bit % 32);
+        }
+    }
+    return out;
+}
+
+template<unsigned Block>
+void test_bitpack_width(TestReporter& tr, BitpackRandom& rnd, unsigned b)
+{
+    using namespace simdpp;
+    const unsigned packed_size = b * Block / 32;
+
+    std::vector<uint32_t> in(Block), low(Block), out(Block);
+    // one sentinel word past the packed data
+    std::vector<uint32_t> packed(packed_size + 1);
+
+    // plain, the bits above b must be ignored
+    for (unsigned i = 0; i < Block; ++i) {
+        in[i] = rnd.next();
+        low[i] = bitpack_low_bits(in[i], b);
+    }
+    std::vector<uint32_t> ref = ref_bitpack(low, b);
+    packed[packed_size] = 0xdeadbeef;
+    uint32_t* pend = bitpack<Block>(packed.data(), in.data(), b);
+    TEST_EQUAL(tr, unsigned(pend - packed.data()), packed_size);
+    TEST_EQUAL(tr, packed[packed_size], uint32_t(0xdeadbeef));
+    TEST_EQUAL_MEMORY(tr, packed.data(), ref.data(), packed_size);
+
+    const uint32_t* uend = bitunpack<Block>(out.data(), packed.data(), b);
+    TEST_EQUAL(tr, unsigned(uend - packed.data()), packed_size);
+    TEST_EQUAL_MEMORY(tr, out.data(), low.data(), Block);
+    TEST_EQUAL(tr, bitpack_max_bits<Block>(low.data()) <= b, true);
+
+    // frame of reference
+    uint32_t base = rnd.next();
+    for (unsigned i = 0; i < Block; ++i)
+        in[i] = base + bitpack_low_bits(rnd.next(), b);
+    bitpack_for<Block>(packed.data(), in.data(), b, base);
+    bitunpack_for<Block>(out.data(), packed.data(), b, base);
+    TEST_EQUAL(tr, packed[packed_size], uint32_t(0xdeadbeef));
+    TEST_EQUAL_MEMORY(tr, out.data(), in.data(), Block);
+
+    // delta, the differences wrap around
+    uint32_t init = rnd.next();
+    uint32_t prev = init;
+    for (unsigned i = 0; i < Block; ++i) {
+        uint32_t d = bitpack_low_bits(rnd.next(), b);
+        low[i] = d;
+        in[i] = prev + d;
+        prev = in[i];
+    }
+    ref = ref_bitpack(low, b);
+    bitpack_delta<Block>(packed.data(), in.data(), b, init);
+    TEST_EQUAL(tr, packed[packed_size], uint32_t(0xdeadbeef));
+    TEST_EQUAL_MEMORY(tr, packed.data(), ref.data(), packed_size);
+    for (unsigned i = 0; i < Block; ++i)
+        out[i] = 0;
+    bitunpack_delta<Block>(out.data(), packed.data(), b, init);
+    TEST_EQUAL_MEMORY(tr, out.data(), in.data(), Block);
+}
+
+template<unsigned B, unsigned Block>
+void test_bitpack_static(TestReporter& tr, BitpackRandom& rnd)
+{
+    using namespace simdpp;
+    std::vector<uint32_t> in(Block), out(Block), packed(B * Block / 32 + 1);
+    for (unsigned i = 0; i < Block; ++i)
+        in[i] = bitpack_low_bits(rnd.next(), B);
+
+    bitpack<B, Block>(packed.data(), in.data());
+    bitunpack<B, Block>(out.data(), packed.data());
+    TEST_EQUAL_MEMORY(tr, out.data(), in.data(), Block);
+
+    bitpack_for<B, Block>(packed.data(), in.data(), 0);
+    bitunpack_for<B, Block>(out.data(), packed.data(), 0);
+    TEST_EQUAL_MEMORY(tr, out.data(), in.data(), Block);
+
+    for (unsigned i = 1; i < Block; ++i)
+        in[i] += in[i - 1];
+    bitpack_delta<B, Block>(packed.data(), in.data(), 0);
+    bitunpack_delta<B, Block>(out.data(), packed.data(), 0);
+    TEST_EQUAL_MEMORY(tr, out.data(), in.data(), Block);
+}
+
+void test_bitpack(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    BitpackRandom rnd;
+    for (unsigned b = 0; b <= 32; ++b) {
+        test_bitpack_width<128>(tr, rnd, b);
+        test_bitpack_width<256>(tr, rnd, b);
+    }
+
+    test_bitpack_static<0, 128>(tr, rnd);
+    test_bitpack_static<3, 128>(tr, rnd);
+    test_bitpack_static<17, 256>(tr, rnd);
+    test_bitpack_static<32, 256>(tr, rnd);
+
+    std::vector<uint32_t> in(256, 0);
+    TEST_EQUAL(tr, simdpp::bitpack_max_bits<256>(in.data()), 0u);
+    in[255] = 1;
+    TEST_EQUAL(tr, simdpp::bitpack_max_bits<256>(in.data()), 1u);
+    in[3] = 0x80000000;
+    TEST_EQUAL(tr, simdpp::bitpack_max_bits<128>(in.data()), 32u);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
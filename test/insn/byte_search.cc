@@ -0,0 +1,111 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <cstring>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+static const char* ref_find_last_byte(const char* s, std::size_t n, char c)
+{
+    while (n > 0) {
+        --n;
+        if (s[n] == c)
+            return s + n;
+    }
+    return nullptr;
+}
+
+static const char* ref_find_first_of(const char* s, std::size_t n,
+                                     const char* set, std::size_t set_n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (std::memchr(set, s[i], set_n))
+            return s + i;
+    }
+    return nullptr;
+}
+
+// Checks the search functions for all offsets within a few vectors and for
+// matches at the first, the last and in-between positions. The bytes around
+// the input contain the searched values so that matches outside the input
+// would be detected.
+void test_byte_search_find(TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned max_n = 300;
+    const unsigned pad = 128;
+    std::vector<char> buf(max_n + 2 * pad + 64);
+    char* base = buf.data();
+    const char set[] = { ',', ';', '\t' };
+
+    for (unsigned offset = 0; offset < 70; offset += (offset < 10 ? 1 : 7)) {
+        for (unsigned n = 0; n < max_n; n += (n < 70 ? 1 : 11)) {
+            for (unsigned pos = 0; pos <= n; pos += (pos < 3 || pos + 3 > n ? 1 : 17)) {
+                std::memset(base, ',', buf.size());
+                char* s = base + pad + offset;
+                for (unsigned i = 0; i < n; ++i)
+                    s[i] = char('a' + i % 26);
+                // pos == n means there's no match within the input
+                if (pos < n) {
+                    s[pos] = ',';
+                    if (pos + 5 < n)
+                        s[pos + 5] = ',';
+                }
+
+                TEST_EQUAL(tr, find_byte(s, n, ','), (const char*) std::memchr(s, ',', n));
+                TEST_EQUAL(tr, find_last_byte(s, n, ','), ref_find_last_byte(s, n, ','));
+                TEST_EQUAL(tr, find_first_of(s, n, set, 3), ref_find_first_of(s, n, set, 3));
+                TEST_EQUAL(tr, find_first_of(s, n, set + 1, 2), ref_find_first_of(s, n, set + 1, 2));
+                TEST_EQUAL(tr, find_first_of(s, n, set, 0), (const char*) nullptr);
+
+                if (pos < n) {
+                    s[pos] = '\0';
+                    TEST_EQUAL(tr, string_length(s), std::size_t(pos));
+                }
+            }
+        }
+    }
+}
+
+void test_byte_search_equal(TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned max_n = 300;
+    std::vector<char> a(max_n + 64), b(max_n + 64);
+    for (unsigned i = 0; i < a.size(); ++i)
+        a[i] = b[i] = char(i * 7);
+
+    for (unsigned offset = 0; offset < 9; ++offset) {
+        for (unsigned n = 0; n < max_n; n += (n < 140 ? 1 : 13)) {
+            const char* pa = a.data() + offset;
+            char* pb = b.data() + offset * 3 % 5;
+            std::memcpy(pb, pa, n);
+            TEST_EQUAL(tr, bytes_equal(pa, pb, n), true);
+            for (unsigned i = 0; i < n; i += (i < 3 || i + 3 > n ? 1 : 9)) {
+                pb[i] ^= 0x10;
+                TEST_EQUAL(tr, bytes_equal(pa, pb, n), false);
+                pb[i] ^= 0x10;
+            }
+            // the byte past the end must not matter
+            pb[n] = char(pa[n] + 1);
+            TEST_EQUAL(tr, bytes_equal(pa, pb, n), true);
+        }
+    }
+}
+
+void test_byte_search(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    test_byte_search_find(tr);
+    test_byte_search_equal(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,110 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <cstring>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Checks compress, compress_store_u and expand against a scalar implementation
+// for a number of mask patterns. Bit i of each pattern selects element i.
+template<class V, class M>
+void test_compress_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+
+    static const uint64_t patterns[] = {
+        0x0000000000000000, 0xffffffffffffffff, 0x0000000000000001,
+        0x8000000000000000, 0x5555555555555555, 0xaaaaaaaaaaaaaaaa,
+        0x0f0f0f0f0f0f0f0f, 0x00ff00ff00ff00ff, 0x3c1a96e4f00d5b27,
+        0xe4c1a07d3b9f5a68, 0x0123456789abcdef, 0xfedcba9876543210,
+    };
+
+    SIMDPP_ALIGN(64) T src[N];
+    SIMDPP_ALIGN(64) T ones[N];
+    for (unsigned i = 0; i < N; ++i) {
+        src[i] = T(i + 1);
+        ones[i] = T(1);
+    }
+    V a = load(src);
+    V one = load(ones);
+
+    for (uint64_t pattern : patterns) {
+        SIMDPP_ALIGN(64) T sel[N];
+        SIMDPP_ALIGN(64) T exp_compress[N];
+        SIMDPP_ALIGN(64) T exp_expand[N];
+        unsigned n = 0;
+        for (unsigned i = 0; i < N; ++i) {
+            bool bit = (pattern >> (i % 64)) & 1;
+            sel[i] = T(bit ? 1 : 0);
+            exp_compress[i] = T(0);
+            exp_expand[i] = bit ? src[n] : T(0);
+            n += bit;
+        }
+        n = 0;
+        for (unsigned i = 0; i < N; ++i) {
+            if (sel[i] != T(0)) {
+                exp_compress[n++] = src[i];
+            }
+        }
+
+        V vsel = load(sel);
+        M mask = cmp_eq(vsel, one);
+
+        V r = compress(a, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, r, V(load(exp_compress)));
+
+        r = expand(a, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, r, V(load(exp_expand)));
+
+        // compress_store_u must not touch the memory past the stored elements
+        T buf[N + 2];
+        for (unsigned i = 0; i < N + 2; ++i) {
+            buf[i] = T(0xaa);
+        }
+        unsigned count = compress_store_u(buf + 1, a, mask);
+        TEST_EQUAL(tr, count, n);
+        TEST_EQUAL(tr, buf[0], T(0xaa));
+        TEST_EQUAL(tr, std::memcmp(buf + 1, exp_compress, n * sizeof(T)), 0);
+        for (unsigned i = n + 1; i < N + 2; ++i) {
+            TEST_EQUAL(tr, buf[i], T(0xaa));
+        }
+    }
+}
+
+template<unsigned B>
+void test_compress_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_compress_type<uint8<B>, mask_int8<B>>(tc, tr);
+    test_compress_type<int8<B>, mask_int8<B>>(tc, tr);
+    test_compress_type<uint16<B/2>, mask_int16<B/2>>(tc, tr);
+    test_compress_type<int16<B/2>, mask_int16<B/2>>(tc, tr);
+    test_compress_type<uint32<B/4>, mask_int32<B/4>>(tc, tr);
+    test_compress_type<int32<B/4>, mask_int32<B/4>>(tc, tr);
+    test_compress_type<uint64<B/8>, mask_int64<B/8>>(tc, tr);
+    test_compress_type<int64<B/8>, mask_int64<B/8>>(tc, tr);
+    test_compress_type<float32<B/4>, mask_float32<B/4>>(tc, tr);
+    test_compress_type<float64<B/8>, mask_float64<B/8>>(tc, tr);
+}
+
+void test_compress(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("compress");
+
+    test_compress_n<16>(tc, tr);
+    test_compress_n<32>(tc, tr);
+    test_compress_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,145 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+struct CrcRandom {
+    uint64_t x = 0x2545f4914f6cdd1d;
+
+    uint64_t next()
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        return x ^ (x >> 29);
+    }
+};
+
+static void ref_clmul(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi)
+{
+    lo = 0; hi = 0;
+    for (unsigned i = 0; i < 64; ++i) {
+        if ((b >> i) & 1) {
+            lo ^= a << i;
+            if (i != 0)
+                hi ^= a >> (64 - i);
+        }
+    }
+}
+
+template<class T>
+T ref_crc(const uint8_t* p, std::size_t n, T rpoly, T crc)
+{
+    crc = ~crc;
+    for (std::size_t i = 0; i < n; ++i) {
+        crc ^= p[i];
+        for (unsigned k = 0; k < 8; ++k)
+            crc = (crc & 1) ? (crc >> 1) ^ rpoly : crc >> 1;
+    }
+    return ~crc;
+}
+
+template<unsigned sa, unsigned sb>
+void test_clmul_sel(TestReporter& tr, CrcRandom& rnd)
+{
+    using namespace simdpp;
+    const unsigned N = uint64v::length;
+    SIMDPP_ALIGN(64) uint64_t a[N], b[N], r[N];
+    for (unsigned k = 0; k < 50; ++k) {
+        for (unsigned i = 0; i < N; ++i) {
+            a[i] = rnd.next();
+            b[i] = rnd.next();
+        }
+        if (k == 0) {
+            a[0] = ~uint64_t(0);
+            b[0] = ~uint64_t(0);
+        }
+        uint64v va = load(a);
+        uint64v vb = load(b);
+        store(r, clmul<sa,sb>(va, vb));
+        for (unsigned i = 0; i < N; i += 2) {
+            uint64_t lo, hi;
+            ref_clmul(a[i + sa], b[i + sb], lo, hi);
+            TEST_EQUAL(tr, r[i], lo);
+            TEST_EQUAL(tr, r[i+1], hi);
+        }
+    }
+}
+
+void test_clmul(TestReporter& tr)
+{
+    CrcRandom rnd;
+    test_clmul_sel<0,0>(tr, rnd);
+    test_clmul_sel<0,1>(tr, rnd);
+    test_clmul_sel<1,0>(tr, rnd);
+    test_clmul_sel<1,1>(tr, rnd);
+}
+
+void test_crc_buffers(TestReporter& tr)
+{
+    using namespace simdpp;
+    const uint8_t* check = reinterpret_cast<const uint8_t*>("123456789");
+    TEST_EQUAL(tr, crc32(check, 9), uint32_t(0xcbf43926));
+    TEST_EQUAL(tr, crc32c(check, 9), uint32_t(0xe3069283));
+    TEST_EQUAL(tr, crc64(check, 9), uint64_t(0x995dc9bbdf1939fa));
+
+    CrcRandom rnd;
+    std::vector<uint8_t> data(1100);
+    for (uint8_t& b : data)
+        b = uint8_t(rnd.next());
+
+    for (std::size_t n = 0; n < 600; n += (n < 300 ? 1 : 17)) {
+        for (std::size_t off : { 0, 1, 7 }) {
+            const uint8_t* p = data.data() + off;
+            TEST_EQUAL(tr, crc32(p, n), ref_crc<uint32_t>(p, n, 0xedb88320, 0));
+            TEST_EQUAL(tr, crc32c(p, n), ref_crc<uint32_t>(p, n, 0x82f63b78, 0));
+            TEST_EQUAL(tr, crc64(p, n), ref_crc<uint64_t>(p, n, 0xc96c5795d7870f42, 0));
+        }
+    }
+
+    // chaining
+    for (std::size_t split : { 0, 5, 64, 100, 1000 }) {
+        const uint8_t* p = data.data();
+        std::size_t n = data.size();
+        TEST_EQUAL(tr, crc32(p + split, n - split, crc32(p, split)), crc32(p, n));
+        TEST_EQUAL(tr, crc32c(p + split, n - split, crc32c(p, split)), crc32c(p, n));
+        TEST_EQUAL(tr, crc64(p + split, n - split, crc64(p, split)), crc64(p, n));
+    }
+}
+
+void test_crc32c_insn(TestReporter& tr)
+{
+    using namespace simdpp;
+    CrcRandom rnd;
+    for (unsigned k = 0; k < 100; ++k) {
+        uint32_t crc = uint32_t(rnd.next());
+        uint64_t v = rnd.next();
+        uint8_t bytes[8];
+        for (unsigned i = 0; i < 8; ++i)
+            bytes[i] = uint8_t(v >> (8 * i));
+        // ref_crc inverts the state before and after the data
+        TEST_EQUAL(tr, crc32c_u8(crc, bytes[0]),
+                   ~ref_crc<uint32_t>(bytes, 1, 0x82f63b78, ~crc));
+        TEST_EQUAL(tr, crc32c_u32(crc, uint32_t(v)),
+                   ~ref_crc<uint32_t>(bytes, 4, 0x82f63b78, ~crc));
+        TEST_EQUAL(tr, crc32c_u64(crc, v),
+                   ~ref_crc<uint32_t>(bytes, 8, 0x82f63b78, ~crc));
+    }
+}
+
+void test_crc(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    test_clmul(tr);
+    test_crc_buffers(tr);
+    test_crc32c_insn(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,185 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+struct EncodingRandom {
+    uint64_t x = 0x2545f4914f6cdd1d;
+
+    unsigned next(unsigned m)
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        return unsigned((x >> 33) % m);
+    }
+};
+
+static std::string ref_base64(const std::vector<uint8_t>& d, bool url)
+{
+    const char* chars = url
+        ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+        : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string r;
+    for (std::size_t i = 0; i < d.size(); i += 3) {
+        uint32_t v = uint32_t(d[i]) << 16;
+        if (i + 1 < d.size()) v |= uint32_t(d[i+1]) << 8;
+        if (i + 2 < d.size()) v |= d[i+2];
+        r += chars[v >> 18];
+        r += chars[(v >> 12) & 0x3f];
+        r += i + 1 < d.size() ? chars[(v >> 6) & 0x3f] : '=';
+        r += i + 2 < d.size() ? chars[v & 0x3f] : '=';
+    }
+    if (url) {
+        while (!r.empty() && r.back() == '=')
+            r.pop_back();
+    }
+    return r;
+}
+
+static std::size_t test_base64_decode(const std::string& s, bool url,
+                                      std::vector<uint8_t>& out)
+{
+    using namespace simdpp;
+    out.assign(s.size(), 0);
+    return url ? base64url_decode(s.data(), s.size(), out.data())
+               : base64_decode(s.data(), s.size(), out.data());
+}
+
+static void test_base64_data(TestReporter& tr, const std::vector<uint8_t>& d,
+                             EncodingRandom& rnd)
+{
+    using namespace simdpp;
+    for (bool url : { false, true }) {
+        std::string ref = ref_base64(d, url);
+        std::vector<char> enc(ref.size() + 1);
+        std::size_t n = url ? base64url_encode(d.data(), d.size(), enc.data())
+                            : base64_encode(d.data(), d.size(), enc.data());
+        TEST_EQUAL(tr, std::string(enc.data(), n) == ref, true);
+
+        std::vector<uint8_t> dec;
+        n = test_base64_decode(ref, url, dec);
+        TEST_EQUAL(tr, n, d.size());
+        TEST_EQUAL(tr, std::memcmp(dec.data(), d.data(), d.size()), 0);
+
+        if (ref.empty())
+            continue;
+
+        // invalid characters, including those of the other alphabet
+        for (char c : { '\0', ' ', '=', '\n', '@', '[', '`', '{', '\x80', '\xff',
+                        url ? '+' : '-', url ? '/' : '_' }) {
+            std::string t = ref;
+            std::size_t p = rnd.next(unsigned(t.size()));
+            if (t[p] == '=')
+                continue;
+            t[p] = c;
+            TEST_EQUAL(tr, test_base64_decode(t, url, dec), base64_invalid);
+        }
+
+        // padding of the unpadded variant is optional
+        if (url && ref.size() % 4 != 0) {
+            std::string t = ref + std::string(4 - ref.size() % 4, '=');
+            TEST_EQUAL(tr, test_base64_decode(t, url, dec), d.size());
+            TEST_EQUAL(tr, std::memcmp(dec.data(), d.data(), d.size()), 0);
+            t += '=';
+            TEST_EQUAL(tr, test_base64_decode(t, url, dec), base64_invalid);
+        }
+        // padding of the padded variant is required
+        if (!url && ref.back() == '=') {
+            std::string t = ref.substr(0, ref.size() - 1);
+            TEST_EQUAL(tr, test_base64_decode(t, url, dec), base64_invalid);
+        }
+        // the unused bits of the last character must be zero
+        std::size_t pad = ref.size() - ref.find_last_not_of('=') - 1;
+        if (d.size() % 3 != 0) {
+            std::string t = ref;
+            char& c = t[t.size() - pad - 1];
+            c = c == 'A' ? 'B' : (c == 'Q' ? 'R' : char(c + 1));
+            TEST_EQUAL(tr, test_base64_decode(t, url, dec), base64_invalid);
+        }
+    }
+}
+
+void test_base64(TestReporter& tr)
+{
+    using namespace simdpp;
+    EncodingRandom rnd;
+    for (unsigned n = 0; n < 400; n += (n < 100 ? 1 : 13)) {
+        std::vector<uint8_t> d(n);
+        for (uint8_t& b : d)
+            b = uint8_t(rnd.next(256));
+        test_base64_data(tr, d, rnd);
+    }
+
+    std::vector<uint8_t> out(64);
+    for (const char* s : { "=", "==", "A===", "AA=A", "====", "AAAAA", "AA==AA==" }) {
+        TEST_EQUAL(tr, base64_decode(s, std::strlen(s), out.data()), base64_invalid);
+        TEST_EQUAL(tr, base64url_decode(s, std::strlen(s), out.data()), base64_invalid);
+    }
+    TEST_EQUAL(tr, base64_decode("Zm9vYmFy", 8, out.data()), std::size_t(6));
+    TEST_EQUAL(tr, std::memcmp(out.data(), "foobar", 6), 0);
+    TEST_EQUAL(tr, base64url_decode("-_-_", 4, out.data()), std::size_t(3));
+    TEST_EQUAL(tr, out[0], uint8_t(0xfb));
+    TEST_EQUAL(tr, out[1], uint8_t(0xff));
+    TEST_EQUAL(tr, out[2], uint8_t(0xbf));
+}
+
+void test_hex(TestReporter& tr)
+{
+    using namespace simdpp;
+    EncodingRandom rnd;
+    for (unsigned n = 0; n < 300; n += (n < 100 ? 1 : 13)) {
+        std::vector<uint8_t> d(n);
+        std::string ref, ref_upper;
+        for (uint8_t& b : d) {
+            b = uint8_t(rnd.next(256));
+            ref += "0123456789abcdef"[b >> 4];
+            ref += "0123456789abcdef"[b & 0x0f];
+            ref_upper += "0123456789ABCDEF"[b >> 4];
+            ref_upper += "0123456789ABCDEF"[b & 0x0f];
+        }
+
+        std::vector<char> enc(2 * n + 1);
+        TEST_EQUAL(tr, hex_encode(d.data(), n, enc.data()), std::size_t(2 * n));
+        TEST_EQUAL(tr, std::string(enc.data(), 2 * n) == ref, true);
+        TEST_EQUAL(tr, hex_encode_upper(d.data(), n, enc.data()), std::size_t(2 * n));
+        TEST_EQUAL(tr, std::string(enc.data(), 2 * n) == ref_upper, true);
+
+        std::vector<uint8_t> dec(n + 1);
+        // mixed case
+        std::string mixed = ref;
+        for (std::size_t i = 0; i < mixed.size(); ++i) {
+            if (rnd.next(2))
+                mixed[i] = ref_upper[i];
+        }
+        TEST_EQUAL(tr, hex_decode(mixed.data(), mixed.size(), dec.data()), std::size_t(n));
+        TEST_EQUAL(tr, std::memcmp(dec.data(), d.data(), n), 0);
+
+        if (n == 0)
+            continue;
+        for (char c : { '\0', '/', ':', '@', 'G', '`', 'g', ' ', '\xb0', '\xe1' }) {
+            std::string t = mixed;
+            t[rnd.next(unsigned(t.size()))] = c;
+            TEST_EQUAL(tr, hex_decode(t.data(), t.size(), dec.data()), hex_invalid);
+        }
+        TEST_EQUAL(tr, hex_decode(mixed.data(), mixed.size() - 1, dec.data()), hex_invalid);
+    }
+}
+
+void test_encoding(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    test_base64(tr);
+    test_hex(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
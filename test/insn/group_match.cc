@@ -0,0 +1,150 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+struct GroupRandom {
+    uint32_t x = 0x2545f491;
+
+    uint32_t next()
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x;
+    }
+};
+
+enum GroupMatchKind {
+    GROUP_MATCH_TAG,
+    GROUP_MATCH_EMPTY,
+    GROUP_MATCH_DELETED,
+    GROUP_MATCH_EMPTY_OR_DELETED,
+    GROUP_MATCH_FULL
+};
+
+bool ref_group_matches(uint8_t c, GroupMatchKind kind, uint8_t tag)
+{
+    switch (kind) {
+    case GROUP_MATCH_TAG: return c == tag;
+    case GROUP_MATCH_EMPTY: return c == simdpp::group_ctrl_empty;
+    case GROUP_MATCH_DELETED: return c == simdpp::group_ctrl_deleted;
+    case GROUP_MATCH_EMPTY_OR_DELETED:
+        return c == simdpp::group_ctrl_empty || c == simdpp::group_ctrl_deleted;
+    case GROUP_MATCH_FULL: return c < 0x80;
+    }
+    return false;
+}
+
+template<unsigned N>
+void check_group_mask(TestReporter& tr, const simdpp::group_mask<N>& m,
+                      const uint8_t* ctrl, GroupMatchKind kind, uint8_t tag)
+{
+    const unsigned shift = simdpp::group_mask<N>::slot_shift;
+    uint64_t expected = 0;
+    unsigned expected_count = 0, expected_lowest = N, expected_highest = 0;
+    for (unsigned i = 0; i < N; ++i) {
+        if (ref_group_matches(ctrl[i], kind, tag)) {
+            expected |= uint64_t(1) << (i << shift);
+            expected_count++;
+            expected_lowest = std::min(expected_lowest, i);
+            expected_highest = i;
+        }
+    }
+    TEST_EQUAL(tr, m.bits(), expected);
+
+    // the iteration yields the slots in increasing order
+    uint64_t iterated = 0;
+    unsigned prev = 0, count = 0;
+    for (unsigned i : m) {
+        if (count > 0)
+            TEST_EQUAL(tr, unsigned(i > prev), 1u);
+        iterated |= uint64_t(1) << (i << shift);
+        prev = i;
+        count++;
+    }
+    TEST_EQUAL(tr, iterated, expected);
+    TEST_EQUAL(tr, count, expected_count);
+
+    TEST_EQUAL(tr, unsigned(bool(m)), unsigned(expected_count != 0));
+    TEST_EQUAL(tr, m.count(), expected_count);
+    if (expected_count != 0) {
+        TEST_EQUAL(tr, m.lowest(), expected_lowest);
+        TEST_EQUAL(tr, m.highest(), expected_highest);
+    }
+}
+
+template<unsigned N>
+void test_group_match_n(TestReporter& tr)
+{
+    using namespace simdpp;
+    GroupRandom rnd;
+
+    const uint8_t special[] = {
+        group_ctrl_empty, group_ctrl_deleted, group_ctrl_sentinel
+    };
+
+    // one extra byte to test unaligned loads
+    SIMDPP_ALIGN(64) uint8_t ctrl[N + 1];
+
+    for (unsigned iter = 0; iter < 200; ++iter) {
+        // the first groups contain only a few distinct tags so that there
+        // are many matches, the later ones also contain special values
+        unsigned tag_range = iter < 50 ? 4 : 128;
+        unsigned special_freq = iter % 4;
+        for (unsigned i = 0; i < N + 1; ++i) {
+            uint32_t r = rnd.next();
+            if ((r >> 16) % 4 < special_freq)
+                ctrl[i] = special[(r >> 8) % 3];
+            else
+                ctrl[i] = r % tag_range;
+        }
+        uint8_t tag = rnd.next() % tag_range;
+
+        for (unsigned offset = 0; offset < 2; ++offset) {
+            const uint8_t* c = ctrl + offset;
+            uint8<N> v = load_u(c);
+
+            check_group_mask(tr, group_match(v, tag), c, GROUP_MATCH_TAG, tag);
+            check_group_mask(tr, group_match<N>(c, tag), c, GROUP_MATCH_TAG, tag);
+            check_group_mask(tr, group_match_empty(v), c, GROUP_MATCH_EMPTY, 0);
+            check_group_mask(tr, group_match_empty<N>(c), c, GROUP_MATCH_EMPTY, 0);
+            check_group_mask(tr, group_match_deleted(v), c, GROUP_MATCH_DELETED, 0);
+            check_group_mask(tr, group_match_deleted<N>(c), c, GROUP_MATCH_DELETED, 0);
+            check_group_mask(tr, group_match_empty_or_deleted(v), c,
+                             GROUP_MATCH_EMPTY_OR_DELETED, 0);
+            check_group_mask(tr, group_match_empty_or_deleted<N>(c), c,
+                             GROUP_MATCH_EMPTY_OR_DELETED, 0);
+            check_group_mask(tr, group_match_full(v), c, GROUP_MATCH_FULL, 0);
+            check_group_mask(tr, group_match_full<N>(c), c, GROUP_MATCH_FULL, 0);
+        }
+    }
+
+    // all slots and no slots
+    for (unsigned i = 0; i < N; ++i)
+        ctrl[i] = 5;
+    TEST_EQUAL(tr, group_match<N>(ctrl, 5).count(), N);
+    TEST_EQUAL(tr, group_match<N>(ctrl, 5).lowest(), 0u);
+    TEST_EQUAL(tr, group_match<N>(ctrl, 5).highest(), N - 1);
+    TEST_EQUAL(tr, group_match<N>(ctrl, 6).bits(), uint64_t(0));
+    TEST_EQUAL(tr, group_match_empty<N>(ctrl).bits(), uint64_t(0));
+}
+
+void test_group_match(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    test_group_match_n<16>(tr);
+    test_group_match_n<32>(tr);
+    test_group_match_n<64>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,263 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+struct HashRandom {
+    uint64_t x = 0x853c49e6748fea9b;
+
+    uint64_t next()
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        return x ^ (x >> 29);
+    }
+};
+
+template<class T>
+T ref_rotl(T x, unsigned c)
+{
+    const unsigned bits = sizeof(T) * 8;
+    return c == 0 ? x : T((x << c) | (x >> (bits - c)));
+}
+
+template<unsigned C>
+void test_rotate_count(TestReporter& tr, const uint32_t* a32, const uint64_t* a64)
+{
+    using namespace simdpp;
+    const unsigned N32 = uint32v::length;
+    const unsigned N64 = uint64v::length;
+    SIMDPP_ALIGN(64) uint32_t r32[N32 * 2];
+    SIMDPP_ALIGN(64) uint64_t r64[N64 * 2];
+
+    uint32<N32 * 2> v32 = load(a32);
+    store(r32, rotate_l<C % 32>(v32));
+    for (unsigned i = 0; i < N32 * 2; ++i)
+        TEST_EQUAL(tr, r32[i], ref_rotl(a32[i], C % 32));
+    store(r32, rotate_r<C % 32>(v32));
+    for (unsigned i = 0; i < N32 * 2; ++i)
+        TEST_EQUAL(tr, r32[i], ref_rotl(a32[i], (32 - C % 32) % 32));
+    store(r32, rotate_l<C % 32>(int32<N32 * 2>(v32)));
+    for (unsigned i = 0; i < N32 * 2; ++i)
+        TEST_EQUAL(tr, r32[i], ref_rotl(a32[i], C % 32));
+
+    uint64<N64 * 2> v64 = load(a64);
+    store(r64, rotate_l<C>(v64));
+    for (unsigned i = 0; i < N64 * 2; ++i)
+        TEST_EQUAL(tr, r64[i], ref_rotl(a64[i], C));
+    store(r64, rotate_r<C>(v64));
+    for (unsigned i = 0; i < N64 * 2; ++i)
+        TEST_EQUAL(tr, r64[i], ref_rotl(a64[i], (64 - C) % 64));
+}
+
+void test_rotate(TestReporter& tr, HashRandom& rnd)
+{
+    using namespace simdpp;
+    SIMDPP_ALIGN(64) uint32_t a32[uint32v::length * 2];
+    SIMDPP_ALIGN(64) uint64_t a64[uint64v::length * 2];
+    for (unsigned i = 0; i < uint32v::length * 2; ++i)
+        a32[i] = uint32_t(rnd.next());
+    for (unsigned i = 0; i < uint64v::length * 2; ++i)
+        a64[i] = rnd.next();
+
+    test_rotate_count<0>(tr, a32, a64);
+    test_rotate_count<1>(tr, a32, a64);
+    test_rotate_count<8>(tr, a32, a64);
+    test_rotate_count<17>(tr, a32, a64);
+    test_rotate_count<31>(tr, a32, a64);
+    test_rotate_count<32>(tr, a32, a64);
+    test_rotate_count<33>(tr, a32, a64);
+    test_rotate_count<63>(tr, a32, a64);
+}
+
+void test_mul_lo64(TestReporter& tr, HashRandom& rnd)
+{
+    using namespace simdpp;
+    const unsigned N = uint64v::length * 2;
+    SIMDPP_ALIGN(64) uint64_t a[N], b[N], r[N];
+    for (unsigned k = 0; k < 20; ++k) {
+        for (unsigned i = 0; i < N; ++i) {
+            a[i] = rnd.next();
+            b[i] = rnd.next();
+        }
+        if (k == 0) {
+            a[0] = ~uint64_t(0); b[0] = ~uint64_t(0);
+            a[1] = uint64_t(1) << 63; b[1] = 3;
+        }
+        uint64<N> va = load(a), vb = load(b);
+        store(r, mul_lo(va, vb));
+        for (unsigned i = 0; i < N; ++i)
+            TEST_EQUAL(tr, r[i], uint64_t(a[i] * b[i]));
+        store(r, int64<N>(int64<N>(va) * int64<N>(vb)));
+        for (unsigned i = 0; i < N; ++i)
+            TEST_EQUAL(tr, r[i], uint64_t(a[i] * b[i]));
+        store(r, mul_lo(va, 0x9e3779b97f4a7c15ull));
+        for (unsigned i = 0; i < N; ++i)
+            TEST_EQUAL(tr, r[i], uint64_t(a[i] * 0x9e3779b97f4a7c15ull));
+    }
+}
+
+// Known answers computed using the reference xxHash implementation
+void test_hash_known(TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned N32 = uint32v::length;
+    const unsigned N64 = uint64v::length;
+    SIMDPP_ALIGN(64) uint32_t r32[N32];
+    SIMDPP_ALIGN(64) uint64_t r64[N64];
+
+    struct { uint32_t key, seed, hash; } k32[] = {
+        { 0, 0, 0x08d6d969 },
+        { 1, 0, 0xf3bb7693 },
+        { 0x12345678, 0, 0xf08a22b0 },
+        { 0xffffffff, 0, 0x04079e5f },
+        { 0, 0x9747b28c, 0x77ce7f10 },
+        { 1, 0x9747b28c, 0xbeb620d3 },
+        { 0x12345678, 0x9747b28c, 0x84519465 },
+        { 0xffffffff, 0x9747b28c, 0xd84d80db },
+    };
+    for (const auto& k : k32) {
+        store(r32, hash_xxh32(uint32v(splat(k.key)), k.seed));
+        for (unsigned i = 0; i < N32; ++i)
+            TEST_EQUAL(tr, r32[i], k.hash);
+    }
+
+    struct { uint64_t key, seed, hash; } k64[] = {
+        { 0, 0, 0x34c96acdcadb1bbb },
+        { 1, 0, 0x9f29cb17a2a49995 },
+        { 0x0123456789abcdef, 0, 0xea3c52081e9843ec },
+        { 0, 0x9747b28c, 0x8369a453b5428277 },
+        { 1, 0x9747b28c, 0xcb7ce79c366a8829 },
+        { 0x0123456789abcdef, 0x9747b28c, 0x5827fc6e4c5947b1 },
+    };
+    for (const auto& k : k64) {
+        store(r64, hash_xxh64(uint64v(splat(k.key)), k.seed));
+        for (unsigned i = 0; i < N64; ++i)
+            TEST_EQUAL(tr, r64[i], k.hash);
+    }
+
+    store(r32, hash_fmix32(uint32v(splat(0x12345678))));
+    TEST_EQUAL(tr, r32[0], uint32_t(0xe37cd1bc));
+    store(r64, hash_fmix64(uint64v(splat(0x0123456789abcdefull))));
+    TEST_EQUAL(tr, r64[0], uint64_t(0x87cbfbfe89022cea));
+}
+
+template<class T, class Vec, class Arr, class Ref>
+void test_hash_array(TestReporter& tr, HashRandom& rnd, T seed,
+                     Vec vec, Arr arr, Ref ref)
+{
+    using namespace simdpp;
+    std::vector<T> keys(300), out(300);
+    for (auto& k : keys)
+        k = T(rnd.next());
+
+    for (std::size_t n : { 0, 1, 3, 15, 16, 17, 64, 299 }) {
+        std::fill(out.begin(), out.end(), T(0));
+        arr(out.data(), keys.data() + 1, n, seed);
+        for (std::size_t i = 0; i < n; ++i)
+            TEST_EQUAL(tr, out[i], ref(keys[i + 1], seed));
+        TEST_EQUAL(tr, out[n], T(0));
+    }
+
+    // in-place
+    std::vector<T> inplace = keys;
+    arr(inplace.data(), inplace.data(), inplace.size(), seed);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        TEST_EQUAL(tr, inplace[i], ref(keys[i], seed));
+
+    // wide vectors
+    const unsigned N = 64 / sizeof(T);
+    typename std::conditional<sizeof(T) == 4, uint32<N>, uint64<N>>::type v;
+    v = load_u(keys.data());
+    SIMDPP_ALIGN(64) T r[N];
+    store(r, vec(v, seed));
+    for (unsigned i = 0; i < N; ++i)
+        TEST_EQUAL(tr, r[i], ref(keys[i], seed));
+}
+
+// Straightforward scalar reference implementations
+uint32_t ref_fmix32(uint32_t h, uint32_t)
+{
+    h ^= h >> 16; h *= 0x85ebca6b; h ^= h >> 13; h *= 0xc2b2ae35; h ^= h >> 16;
+    return h;
+}
+
+uint64_t ref_fmix64(uint64_t h, uint64_t)
+{
+    h ^= h >> 33; h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+uint32_t ref_xxh32(uint32_t key, uint32_t seed)
+{
+    uint32_t h = seed + 0x165667b1u + 4;
+    h += key * 0xc2b2ae3du;
+    h = ref_rotl(h, 17) * 0x27d4eb2fu;
+    h ^= h >> 15; h *= 0x85ebca77u;
+    h ^= h >> 13; h *= 0xc2b2ae3du;
+    h ^= h >> 16;
+    return h;
+}
+
+uint64_t ref_xxh64(uint64_t key, uint64_t seed)
+{
+    uint64_t h = seed + 0x27d4eb2f165667c5ull + 8;
+    uint64_t k = ref_rotl(key * 0xc2b2ae3d27d4eb4full, 31) * 0x9e3779b185ebca87ull;
+    h ^= k;
+    h = ref_rotl(h, 27) * 0x9e3779b185ebca87ull + 0x85ebca77c2b2ae63ull;
+    h ^= h >> 33; h *= 0xc2b2ae3d27d4eb4full;
+    h ^= h >> 29; h *= 0x165667b19e3779f9ull;
+    h ^= h >> 32;
+    return h;
+}
+
+void test_hash(TestResults& res, TestReporter& tr)
+{
+    using namespace simdpp;
+    (void) res;
+    HashRandom rnd;
+
+    test_rotate(tr, rnd);
+    test_mul_lo64(tr, rnd);
+    test_hash_known(tr);
+
+    for (unsigned k = 0; k < 3; ++k) {
+        uint32_t seed32 = k == 0 ? 0 : uint32_t(rnd.next());
+        uint64_t seed64 = k == 0 ? 0 : rnd.next();
+
+        test_hash_array<uint32_t>(tr, rnd, uint32_t(0),
+            [](const uint32<16>& v, uint32_t) { return hash_fmix32(v); },
+            [](uint32_t* o, const uint32_t* i, std::size_t n, uint32_t)
+                { hash_fmix32(o, i, n); },
+            ref_fmix32);
+        test_hash_array<uint64_t>(tr, rnd, uint64_t(0),
+            [](const uint64<8>& v, uint64_t) { return hash_fmix64(v); },
+            [](uint64_t* o, const uint64_t* i, std::size_t n, uint64_t)
+                { hash_fmix64(o, i, n); },
+            ref_fmix64);
+        test_hash_array<uint32_t>(tr, rnd, seed32,
+            [](const uint32<16>& v, uint32_t s) { return hash_xxh32(v, s); },
+            [](uint32_t* o, const uint32_t* i, std::size_t n, uint32_t s)
+                { hash_xxh32(o, i, n, s); },
+            ref_xxh32);
+        test_hash_array<uint64_t>(tr, rnd, seed64,
+            [](const uint64<8>& v, uint64_t s) { return hash_xxh64(v, s); },
+            [](uint64_t* o, const uint64_t* i, std::size_t n, uint64_t s)
+                { hash_xxh64(o, i, n, s); },
+            ref_xxh64);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
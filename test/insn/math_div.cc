@@ -0,0 +1,121 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <limits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T>
+std::vector<T> make_div_values()
+{
+    using U = typename std::make_unsigned<T>::type;
+    const T min = std::numeric_limits<T>::min();
+    const T max = std::numeric_limits<T>::max();
+    std::vector<T> r = { T(1), T(2), T(3), T(5), T(6), T(7), T(10), T(11),
+                         T(25), T(100), T(125), T(641), T(1000), T(1234),
+                         max, T(max - 1), T(max / 2), T(max / 2 + 1), T(max / 3),
+                         min, T(min + 1), T(min / 2), T(min / 3 + 1) };
+    for (unsigned s = 2; s < sizeof(T) * 8; ++s) {
+        U p = U(U(1) << s);
+        r.push_back(T(p));
+        r.push_back(T(p - 1));
+        r.push_back(T(p + 1));
+    }
+    // a simple LCG is sufficient to produce values of varying magnitude
+    uint64_t x = 0x2545f4914f6cdd1d;
+    for (unsigned i = 0; i < 32; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        r.push_back(T(x >> (i % (64 - sizeof(T) * 8 + 1))));
+    }
+    if (std::is_signed<T>::value) {
+        unsigned size = r.size();
+        for (unsigned i = 0; i < size; ++i) {
+            r.push_back(T(U(0) - U(r[i])));
+        }
+    }
+    r.push_back(T(0));
+    return r;
+}
+
+// Checks div and rem against the scalar division for a set of numerators and
+// divisors that covers all division algorithms
+template<class V>
+void test_math_div_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+    const T min = std::numeric_limits<T>::min();
+
+    std::vector<T> values = make_div_values<T>();
+    std::vector<T> nums = values;
+    while (nums.size() % N != 0) {
+        nums.push_back(T(nums.size()));
+    }
+
+    for (T d : values) {
+        if (d == 0) {
+            continue;
+        }
+        divider<T> dv(d);
+
+        for (unsigned i = 0; i < nums.size(); i += N) {
+            SIMDPP_ALIGN(64) T exp_q[N];
+            SIMDPP_ALIGN(64) T exp_r[N];
+            for (unsigned j = 0; j < N; ++j) {
+                T a = nums[i+j];
+                if (std::is_signed<T>::value && a == min && d == T(-1)) {
+                    exp_q[j] = min;
+                    exp_r[j] = 0;
+                } else {
+                    exp_q[j] = T(a / d);
+                    exp_r[j] = T(a % d);
+                }
+            }
+
+            V a = load_u(&nums[i]);
+            V q = div(a, dv);
+            V r = rem(a, dv);
+            TEST_EQUAL(tr, q, V(load(exp_q)));
+            TEST_EQUAL(tr, r, V(load(exp_r)));
+        }
+
+        // only a sample of the results goes to the result set
+        if (d == T(7) || d == T(641)) {
+            V a = load_u(&nums[0]);
+            TEST_PUSH(tc, V, div(a, dv));
+            TEST_PUSH(tc, V, rem(a, dv));
+        }
+    }
+}
+
+template<unsigned B>
+void test_math_div_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_math_div_type<uint16<B/2>>(tc, tr);
+    test_math_div_type<int16<B/2>>(tc, tr);
+    test_math_div_type<uint32<B/4>>(tc, tr);
+    test_math_div_type<int32<B/4>>(tc, tr);
+    test_math_div_type<uint64<B/8>>(tc, tr);
+    test_math_div_type<int64<B/8>>(tc, tr);
+}
+
+void test_math_div(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("math_div");
+
+    test_math_div_n<16>(tc, tr);
+    test_math_div_n<32>(tc, tr);
+    test_math_div_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
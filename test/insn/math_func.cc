@@ -0,0 +1,281 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <simdpp/math.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The functions in simdpp/math.h are compared against the standard library.
+    The reference is computed in long double, so for float64 the precision of
+    the reference is sufficient only where long double is wider than double.
+    Results are not pushed to the result sets, because they legitimately
+    differ between instruction sets depending on fused multiply-add support.
+*/
+namespace math_func {
+
+enum ErrorKind {
+    ERROR_ULP,
+    ERROR_REL,
+    ERROR_ABS
+};
+
+enum GridKind {
+    GRID_LINEAR,
+    GRID_GEOMETRIC
+};
+
+template<class T>
+long double ulp(long double x)
+{
+    int e;
+    std::frexp(double(x), &e);
+    e = std::max(e - std::numeric_limits<T>::digits,
+                 std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits);
+    return std::ldexp(1.0L, e);
+}
+
+template<class T>
+double compute_error(ErrorKind kind, T r, long double ref)
+{
+    if (std::isnan(ref) || std::isnan(r)) {
+        return std::isnan(ref) && std::isnan(r) ? 0 : INFINITY;
+    }
+    // results that overflow in T must be infinite
+    if (std::isinf(T(ref)) || std::isinf(r)) {
+        return T(ref) == r ? 0 : INFINITY;
+    }
+    long double diff = std::fabs(r - ref);
+    switch (kind) {
+    case ERROR_ULP: return double(diff / ulp<T>(ref));
+    case ERROR_REL: return ref == 0 ? double(diff) : double(diff / std::fabs(ref));
+    default:        return double(diff);
+    }
+}
+
+template<class T>
+std::vector<T> make_grid(GridKind grid, double lo, double hi, unsigned count)
+{
+    std::vector<T> r;
+    for (unsigned i = 0; i < count; ++i) {
+        double f = double(i) / (count - 1);
+        double x = grid == GRID_LINEAR ? lo + (hi - lo) * f
+                                       : std::exp(std::log(lo) + (std::log(hi) - std::log(lo)) * f);
+        r.push_back(T(x));
+    }
+    return r;
+}
+
+template<class T>
+double bound_for(double bound)
+{
+    // libm double functions are not accurate enough to be a reference for
+    // 1 ULP bounds
+    if (sizeof(T) == sizeof(double) &&
+        std::numeric_limits<long double>::digits <= std::numeric_limits<double>::digits)
+    {
+        bound += 1;
+    }
+    return bound;
+}
+
+template<class V, class F>
+void test_range(TestReporter& tr, F f, GridKind grid, double lo, double hi,
+                ErrorKind kind, double bound, unsigned line)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    std::vector<T> in = make_grid<T>(grid, lo, hi, 8192);
+    in.resize((in.size() + V::length - 1) / V::length * V::length, T(lo));
+
+    double max_err = 0;
+    T worst = 0;
+    for (unsigned i = 0; i < in.size(); i += V::length) {
+        V a = load_u(&in[i]);
+        T out[V::length];
+        store_u(out, f(a));
+        for (unsigned j = 0; j < V::length; ++j) {
+            double err = compute_error(kind, out[j], f.ref(in[i+j]));
+            if (!(err <= max_err)) {
+                max_err = err;
+                worst = in[i+j];
+            }
+        }
+    }
+
+    bound = bound_for<T>(bound);
+    bool success = max_err <= bound;
+    tr.add_result(success);
+    if (!success) {
+        print_separator(tr.out());
+        print_file_info(tr.out(), __FILE__, line);
+        tr.out() << f.name() << " for " << V::length << " x " << sizeof(T) * 8
+                 << "-bit elements: error " << max_err << " at " << worst
+                 << " exceeds " << bound << "\n";
+    }
+}
+
+template<class V, class F>
+void test_values(TestReporter& tr, F f, const std::vector<typename V::element_type>& values,
+                 unsigned line)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    for (T v : values) {
+        V a = splat(v);
+        T out[V::length];
+        store_u(out, f(a));
+        T ref = T(f.ref(v));
+        bool success;
+        if (std::isnan(ref)) {
+            success = std::isnan(out[0]);
+        } else if (std::isinf(ref) || ref == 0) {
+            success = out[0] == ref && std::signbit(out[0]) == std::signbit(ref);
+        } else {
+            success = std::fabs(out[0] - ref) <= ulp<T>(ref);
+        }
+        tr.add_result(success);
+        if (!success) {
+            print_separator(tr.out());
+            print_file_info(tr.out(), __FILE__, line);
+            tr.out() << f.name() << "(" << v << ") returned " << out[0]
+                     << ", expected " << ref << "\n";
+        }
+    }
+}
+
+#define MATH_FUNC_FUNCTOR(NAME, FUNC, REF)                                      \
+struct NAME {                                                                   \
+    template<class V> V operator()(const V& a) const { return FUNC(a); }       \
+    long double ref(long double x) const { return REF(x); }                    \
+    const char* name() const { return #FUNC; }                                  \
+};
+
+MATH_FUNC_FUNCTOR(Exp, simdpp::exp, std::exp)
+MATH_FUNC_FUNCTOR(Log, simdpp::log, std::log)
+MATH_FUNC_FUNCTOR(Sin, simdpp::sin, std::sin)
+MATH_FUNC_FUNCTOR(Cos, simdpp::cos, std::cos)
+MATH_FUNC_FUNCTOR(Tanh, simdpp::tanh, std::tanh)
+MATH_FUNC_FUNCTOR(Erf, simdpp::erf, std::erf)
+MATH_FUNC_FUNCTOR(ExpFast, simdpp::exp_fast, std::exp)
+MATH_FUNC_FUNCTOR(LogFast, simdpp::log_fast, std::log)
+MATH_FUNC_FUNCTOR(TanhFast, simdpp::tanh_fast, std::tanh)
+MATH_FUNC_FUNCTOR(ErfFast, simdpp::erf_fast, std::erf)
+
+#undef MATH_FUNC_FUNCTOR
+
+// pow(x, y) with y fixed for each test
+struct Pow {
+    long double y;
+    template<class V> V operator()(const V& a) const
+    {
+        return simdpp::pow(a, V(simdpp::splat(typename V::element_type(y))));
+    }
+    long double ref(long double x) const { return std::pow(x, y); }
+    const char* name() const { return "simdpp::pow"; }
+};
+
+template<class T>
+std::vector<T> special_values()
+{
+    T inf = std::numeric_limits<T>::infinity();
+    T nan = std::numeric_limits<T>::quiet_NaN();
+    return { T(0), -T(0), T(1), -T(1), T(0.5), -T(0.5), T(2), -T(2), T(3),
+             -T(3), T(2.5), -T(2.5), inf, -inf, nan };
+}
+
+} // namespace math_func
+
+template<unsigned B>
+void test_math_func_n(TestReporter& tr)
+{
+    using namespace simdpp;
+    using namespace math_func;
+    using float32_n = float32<B/4>;
+    using float64_n = float64<B/8>;
+    const double pi = 3.14159265358979323846;
+
+    test_range<float32_n>(tr, Exp(), GRID_LINEAR, -103.9, 88.7, ERROR_ULP, 1, __LINE__);
+    test_range<float32_n>(tr, Exp(), GRID_LINEAR, -1, 1, ERROR_ULP, 1, __LINE__);
+    test_range<float64_n>(tr, Exp(), GRID_LINEAR, -745, 709.7, ERROR_ULP, 1, __LINE__);
+    test_range<float64_n>(tr, Exp(), GRID_LINEAR, -1, 1, ERROR_ULP, 1, __LINE__);
+
+    test_range<float32_n>(tr, Log(), GRID_GEOMETRIC, 1e-45, 3e38, ERROR_ULP, 1, __LINE__);
+    test_range<float32_n>(tr, Log(), GRID_LINEAR, 0.5, 2, ERROR_ULP, 1, __LINE__);
+    test_range<float64_n>(tr, Log(), GRID_GEOMETRIC, 1e-320, 1e308, ERROR_ULP, 1, __LINE__);
+    test_range<float64_n>(tr, Log(), GRID_LINEAR, 0.5, 2, ERROR_ULP, 1, __LINE__);
+
+    test_range<float32_n>(tr, Sin(), GRID_LINEAR, -pi, pi, ERROR_ULP, 2, __LINE__);
+    test_range<float32_n>(tr, Cos(), GRID_LINEAR, -pi, pi, ERROR_ULP, 2, __LINE__);
+    test_range<float32_n>(tr, Sin(), GRID_LINEAR, -8190, 8190, ERROR_ABS, 1e-7, __LINE__);
+    test_range<float32_n>(tr, Cos(), GRID_LINEAR, -8190, 8190, ERROR_ABS, 1e-7, __LINE__);
+    // the error in ULP is unbounded close to the nonzero roots
+    test_range<float64_n>(tr, Sin(), GRID_LINEAR, -3.1, 3.1, ERROR_ULP, 1.5, __LINE__);
+    test_range<float64_n>(tr, Cos(), GRID_LINEAR, -pi, pi, ERROR_ULP, 1.5, __LINE__);
+    test_range<float64_n>(tr, Sin(), GRID_LINEAR, -1e8, 1e8, ERROR_ULP, 1.5, __LINE__);
+    test_range<float64_n>(tr, Cos(), GRID_LINEAR, -1e8, 1e8, ERROR_ULP, 1.5, __LINE__);
+
+    test_range<float32_n>(tr, Tanh(), GRID_LINEAR, -10, 10, ERROR_ULP, 1.5, __LINE__);
+    test_range<float32_n>(tr, Tanh(), GRID_GEOMETRIC, 1e-40, 2, ERROR_ULP, 1.5, __LINE__);
+    test_range<float64_n>(tr, Tanh(), GRID_LINEAR, -20, 20, ERROR_ULP, 1.5, __LINE__);
+    test_range<float64_n>(tr, Tanh(), GRID_GEOMETRIC, 1e-300, 2, ERROR_ULP, 1.5, __LINE__);
+
+    test_range<float32_n>(tr, Erf(), GRID_LINEAR, -5, 5, ERROR_ULP, 2, __LINE__);
+    test_range<float32_n>(tr, Erf(), GRID_GEOMETRIC, 1e-40, 2, ERROR_ULP, 2, __LINE__);
+    test_range<float64_n>(tr, Erf(), GRID_LINEAR, -7, 7, ERROR_ULP, 1.5, __LINE__);
+    test_range<float64_n>(tr, Erf(), GRID_GEOMETRIC, 1e-300, 2, ERROR_ULP, 1.5, __LINE__);
+
+    test_range<float32_n>(tr, ExpFast(), GRID_LINEAR, -87, 88.7, ERROR_REL, 1e-5, __LINE__);
+    test_range<float32_n>(tr, LogFast(), GRID_GEOMETRIC, 1.2e-38, 3e38, ERROR_REL, 2e-6, __LINE__);
+    test_range<float32_n>(tr, LogFast(), GRID_LINEAR, 0.5, 2, ERROR_REL, 2e-6, __LINE__);
+    test_range<float32_n>(tr, TanhFast(), GRID_LINEAR, -10, 10, ERROR_ABS, 5e-7, __LINE__);
+    test_range<float32_n>(tr, ErfFast(), GRID_LINEAR, -5, 5, ERROR_ABS, 5e-7, __LINE__);
+
+    for (double y : { -30.5, -3.0, -0.5, 0.25, 0.3125, 2.0, 7.0, 29.75 }) {
+        Pow p;
+        p.y = y;
+        test_range<float32_n>(tr, p, GRID_GEOMETRIC, 1e-2, 1e2, ERROR_ULP, 1, __LINE__);
+        test_range<float64_n>(tr, p, GRID_GEOMETRIC, 1e-9, 1e9, ERROR_ULP, 1.5, __LINE__);
+        test_range<float64_n>(tr, p, GRID_LINEAR, 0.99, 1.01, ERROR_ULP, 1.5, __LINE__);
+    }
+    for (double y : { -3.0, 2.0, 7.0 }) {
+        Pow p;
+        p.y = y;
+        test_range<float64_n>(tr, p, GRID_LINEAR, -1e3, -1e-3, ERROR_ULP, 1.5, __LINE__);
+    }
+
+    test_values<float32_n>(tr, Exp(), special_values<float>(), __LINE__);
+    test_values<float64_n>(tr, Exp(), special_values<double>(), __LINE__);
+    test_values<float32_n>(tr, Log(), special_values<float>(), __LINE__);
+    test_values<float64_n>(tr, Log(), special_values<double>(), __LINE__);
+    test_values<float32_n>(tr, Tanh(), special_values<float>(), __LINE__);
+    test_values<float64_n>(tr, Tanh(), special_values<double>(), __LINE__);
+    test_values<float32_n>(tr, Erf(), special_values<float>(), __LINE__);
+    test_values<float64_n>(tr, Erf(), special_values<double>(), __LINE__);
+    for (double y : special_values<double>()) {
+        Pow p;
+        p.y = y;
+        test_values<float32_n>(tr, p, special_values<float>(), __LINE__);
+        test_values<float64_n>(tr, p, special_values<double>(), __LINE__);
+    }
+}
+
+void test_math_func(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    test_math_func_n<16>(tr);
+    test_math_func_n<32>(tr);
+    test_math_func_n<64>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,238 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../common/masks.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// The masked operations must be equivalent to the unmasked operation followed
+// by blend (merge-masking) or bit_and (zero-masking) on all architectures.
+
+template<class V, class M>
+void test_masked_add_sub(TestResultsSet& tc, TestReporter& tr,
+                         const V& a, const V& b, const M& mask, const V& src)
+{
+    using namespace simdpp;
+    V r;
+
+    r = add(a, b, mask, src);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(blend(add(a, b), src, mask)));
+    r = add_z(a, b, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(bit_and(add(a, b), mask)));
+
+    r = sub(a, b, mask, src);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(blend(sub(a, b), src, mask)));
+    r = sub_z(a, b, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(bit_and(sub(a, b), mask)));
+}
+
+template<class V, class M>
+void test_masked_min_max(TestResultsSet& tc, TestReporter& tr,
+                         const V& a, const V& b, const M& mask, const V& src)
+{
+    using namespace simdpp;
+    V r;
+
+    r = min(a, b, mask, src);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(blend(min(a, b), src, mask)));
+    r = min_z(a, b, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(bit_and(min(a, b), mask)));
+
+    r = max(a, b, mask, src);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(blend(max(a, b), src, mask)));
+    r = max_z(a, b, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(bit_and(max(a, b), mask)));
+}
+
+template<class V, class M>
+void test_masked_mul_lo(TestResultsSet& tc, TestReporter& tr,
+                        const V& a, const V& b, const M& mask, const V& src)
+{
+    using namespace simdpp;
+    V r;
+
+    r = mul_lo(a, b, mask, src);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(blend(mul_lo(a, b), src, mask)));
+    r = mul_lo_z(a, b, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(bit_and(mul_lo(a, b), mask)));
+}
+
+template<class V, class M>
+void test_masked_float(TestResultsSet& tc, TestReporter& tr,
+                       const V& a, const V& b, const M& mask, const V& src)
+{
+    using namespace simdpp;
+    V r;
+
+    test_masked_add_sub(tc, tr, a, b, mask, src);
+    test_masked_min_max(tc, tr, a, b, mask, src);
+
+    r = mul(a, b, mask, src);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(blend(mul(a, b), src, mask)));
+    r = mul_z(a, b, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(bit_and(mul(a, b), mask)));
+}
+
+#if (SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL) && !SIMDPP_USE_AVX512F
+template<class V, class M>
+void test_masked_fmadd(TestResultsSet& tc, TestReporter& tr,
+                       const V& a, const V& b, const M& mask, const V& src)
+{
+    using namespace simdpp;
+    V r;
+
+    r = fmadd(a, b, src, mask, src);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(blend(fmadd(a, b, src), src, mask)));
+    r = fmadd_z(a, b, src, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, r, V(bit_and(fmadd(a, b, src), mask)));
+}
+#endif
+
+template<unsigned B>
+void test_math_masked_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    uint8<B> u8a = make_uint(0x11, 0xfe, 0x80, 0x7f, 0x00, 0x5a, 0xc3, 0x01);
+    uint8<B> u8b = make_uint(0x22, 0x01, 0x7f, 0x80, 0xff, 0xa5, 0x3c, 0x10);
+    uint8<B> u8s = make_uint(0x33, 0x44, 0x55, 0x66);
+
+    uint16<B/2> u16a = make_uint(0x1111, 0xfffe, 0x8000, 0x7fff);
+    uint16<B/2> u16b = make_uint(0x2222, 0x0001, 0x7fff, 0x8000);
+    uint16<B/2> u16s = make_uint(0x3333, 0x4444, 0x5555, 0x6666);
+
+    uint32<B/4> u32a = make_uint(0x11111111, 0xfffffffe, 0x80000000, 0x7fffffff);
+    uint32<B/4> u32b = make_uint(0x22222222, 0x00000001, 0x7fffffff, 0x80000000);
+    uint32<B/4> u32s = make_uint(0x33333333, 0x44444444, 0x55555555, 0x66666666);
+
+    uint64<B/8> u64a = make_uint(0x1111111111111111, 0xfffffffffffffffe);
+    uint64<B/8> u64b = make_uint(0x2222222222222222, 0x8000000000000000);
+    uint64<B/8> u64s = make_uint(0x3333333333333333, 0x4444444444444444);
+
+    float32<B/4> f32a = make_float(1.0f, -2.5f, 67500000.0f, 0.0f);
+    float32<B/4> f32b = make_float(-3.0f, 2.5f, 4.0f, -0.5f);
+    float32<B/4> f32s = make_float(10.0f, 20.0f, 30.0f, 40.0f);
+
+    float64<B/8> f64a = make_float(1.0, -2.5);
+    float64<B/8> f64b = make_float(-3.0, 0.25);
+    float64<B/8> f64s = make_float(10.0, 20.0);
+
+    Masks<B,4> m;
+
+    for (unsigned i = 0; i < 4; ++i) {
+        test_masked_add_sub(tc, tr, u8a, u8b, m.u8[i], u8s);
+        test_masked_add_sub(tc, tr, int8<B>(u8a), int8<B>(u8b), m.u8[i], int8<B>(u8s));
+        test_masked_min_max(tc, tr, u8a, u8b, m.u8[i], u8s);
+        test_masked_min_max(tc, tr, int8<B>(u8a), int8<B>(u8b), m.u8[i], int8<B>(u8s));
+
+        test_masked_add_sub(tc, tr, u16a, u16b, m.u16[i], u16s);
+        test_masked_add_sub(tc, tr, int16<B/2>(u16a), int16<B/2>(u16b), m.u16[i], int16<B/2>(u16s));
+        test_masked_min_max(tc, tr, u16a, u16b, m.u16[i], u16s);
+        test_masked_min_max(tc, tr, int16<B/2>(u16a), int16<B/2>(u16b), m.u16[i], int16<B/2>(u16s));
+        test_masked_mul_lo(tc, tr, u16a, u16b, m.u16[i], u16s);
+        test_masked_mul_lo(tc, tr, int16<B/2>(u16a), int16<B/2>(u16b), m.u16[i], int16<B/2>(u16s));
+
+        test_masked_add_sub(tc, tr, u32a, u32b, m.u32[i], u32s);
+        test_masked_add_sub(tc, tr, int32<B/4>(u32a), int32<B/4>(u32b), m.u32[i], int32<B/4>(u32s));
+        test_masked_min_max(tc, tr, u32a, u32b, m.u32[i], u32s);
+        test_masked_min_max(tc, tr, int32<B/4>(u32a), int32<B/4>(u32b), m.u32[i], int32<B/4>(u32s));
+        test_masked_mul_lo(tc, tr, u32a, u32b, m.u32[i], u32s);
+        test_masked_mul_lo(tc, tr, int32<B/4>(u32a), int32<B/4>(u32b), m.u32[i], int32<B/4>(u32s));
+
+        test_masked_add_sub(tc, tr, u64a, u64b, m.u64[i], u64s);
+        test_masked_add_sub(tc, tr, int64<B/8>(u64a), int64<B/8>(u64b), m.u64[i], int64<B/8>(u64s));
+
+        test_masked_float(tc, tr, f32a, f32b, m.f32[i], f32s);
+        test_masked_float(tc, tr, f64a, f64b, m.f64[i], f64s);
+    }
+}
+
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+template<unsigned B>
+void test_math_masked_min_max64_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    uint64<B/8> u64a = make_uint(0x1111111111111111, 0xfffffffffffffffe);
+    uint64<B/8> u64b = make_uint(0x2222222222222222, 0x8000000000000000);
+    uint64<B/8> u64s = make_uint(0x3333333333333333, 0x4444444444444444);
+
+    Masks<B,4> m;
+
+    for (unsigned i = 0; i < 4; ++i) {
+        test_masked_min_max(tc, tr, u64a, u64b, m.u64[i], u64s);
+        test_masked_min_max(tc, tr, int64<B/8>(u64a), int64<B/8>(u64b), m.u64[i], int64<B/8>(u64s));
+    }
+}
+#endif
+
+#if (SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL) && !SIMDPP_USE_AVX512F
+template<unsigned B>
+void test_math_masked_fmadd_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    float32<B/4> f32a = make_float(1.0f, -2.5f, 67500000.0f, 0.0f);
+    float32<B/4> f32b = make_float(-3.0f, 2.5f, 4.0f, -0.5f);
+    float32<B/4> f32s = make_float(10.0f, 20.0f, 30.0f, 40.0f);
+
+    float64<B/8> f64a = make_float(1.0, -2.5);
+    float64<B/8> f64b = make_float(-3.0, 0.25);
+    float64<B/8> f64s = make_float(10.0, 20.0);
+
+    Masks<B,4> m;
+
+    for (unsigned i = 0; i < 4; ++i) {
+        test_masked_fmadd(tc, tr, f32a, f32b, m.f32[i], f32s);
+        test_masked_fmadd(tc, tr, f64a, f64b, m.f64[i], f64s);
+    }
+}
+#endif
+
+void test_math_masked(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("math_masked");
+
+    test_math_masked_n<16>(tc, tr);
+    test_math_masked_n<32>(tc, tr);
+    test_math_masked_n<64>(tc, tr);
+
+    // The results of the operations that are available only on some
+    // instruction sets form separate sequences at the end so that they are
+    // skipped when comparing with the other instruction sets.
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+    tc.reset_seq();
+    test_math_masked_min_max64_n<16>(tc, tr);
+    test_math_masked_min_max64_n<32>(tc, tr);
+    test_math_masked_min_max64_n<64>(tc, tr);
+#endif
+#if (SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL) && !SIMDPP_USE_AVX512F
+    tc.reset_seq();
+    test_math_masked_fmadd_n<16>(tc, tr);
+    test_math_masked_fmadd_n<32>(tc, tr);
+    test_math_masked_fmadd_n<64>(tc, tr);
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
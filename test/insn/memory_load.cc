@@ -9,6 +9,8 @@
 #include "../utils/test_results.h"
 #include "../common/vectors.h"
 #include <simdpp/simd.h>
+#include <cstring>
+#include <vector>
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
@@ -97,6 +99,119 @@ void test_load_helper(TestResultsSet& tc, TestReporter& tr,
     TEST_NOT_EQUAL(tr, zero, rv[3]);
 }
 
+template<class V>
+void test_load_masked(TestResultsSet& tc, TestReporter& tr,
+                      const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    TestData<V> mask_data;
+    mask_data.add(make_int(0, 0, 0, 0));
+    mask_data.add(make_int(1, 0, 0, 0));
+    mask_data.add(make_int(0, 1, 0, 0));
+    mask_data.add(make_int(0, 0, 1, 0));
+    mask_data.add(make_int(0, 0, 0, 1));
+    mask_data.add(make_int(1, 1, 1, 1));
+
+    // Place the source data so that the unaligned vector crosses a page
+    // boundary to exercise the element-wise code paths
+    std::vector<char, aligned_allocator<char, 4096>> page_data(8192);
+    E* cross = reinterpret_cast<E*>(page_data.data() + 4096) - V::length / 2;
+    std::memcpy(cross, sdata, V::length_bytes);
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < mask_data.size(); ++j) {
+        typename V::mask_vector_type mask;
+        mask = bit_not(cmp_eq(mask_data[j], 0));
+
+        V r = load_masked(sdata, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, bit_and(load<V>(sdata), mask), r);
+
+        r = load_masked_u(sdata + 1, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, bit_and(load_u<V>(sdata + 1), mask), r);
+
+        r = load_masked_u(cross, mask);
+        TEST_EQUAL(tr, bit_and(load<V>(sdata), mask), r);
+    }
+}
+
+template<class V>
+void test_load_first_last(TestResultsSet& tc, TestReporter& tr,
+                          const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    std::vector<char, aligned_allocator<char, 4096>> page_data(8192);
+    E* cross = reinterpret_cast<E*>(page_data.data() + 4096) - V::length / 2;
+    std::memcpy(cross, sdata, V::length_bytes);
+
+    tc.reset_seq();
+    for (unsigned n = 0; n <= V::length + 1; ++n) {
+        E first[V::length];
+        E last[V::length];
+        for (unsigned i = 0; i < V::length; ++i) {
+            first[i] = i < n ? sdata[i] : E(0);
+            last[i] = i + n >= V::length ? sdata[i] : E(0);
+        }
+
+        V r = load_first(sdata, n);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load_u<V>(first), r);
+        r = load_first<V>(cross, n);
+        TEST_EQUAL(tr, load_u<V>(first), r);
+
+        r = load_last(sdata, n);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load_u<V>(last), r);
+        r = load_last<V>(cross, n);
+        TEST_EQUAL(tr, load_u<V>(last), r);
+    }
+}
+
+template<class V, class I>
+void test_gather(TestResultsSet& tc, TestReporter& tr,
+                 const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+
+    // Half of the indices are negative relative to the base pointer
+    const E* base = sdata + V::length / 2;
+    IE indices[V::length];
+    E expected[V::length];
+    for (unsigned i = 0; i < V::length; ++i) {
+        unsigned pos = (i * 3 + 1) % V::length;
+        indices[i] = IE(pos) - IE(V::length / 2);
+        expected[i] = sdata[pos];
+    }
+    I idx = load_u(indices);
+
+    tc.reset_seq();
+    V r = V(gather(base, idx));
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, load_u<V>(expected), r);
+
+    TestData<V> mask_data;
+    mask_data.add(make_int(0, 0, 0, 0));
+    mask_data.add(make_int(1, 0, 0, 0));
+    mask_data.add(make_int(0, 1, 1, 0));
+    mask_data.add(make_int(1, 1, 1, 1));
+
+    for (unsigned j = 0; j < mask_data.size(); ++j) {
+        typename V::mask_vector_type mask;
+        mask = bit_not(cmp_eq(mask_data[j], 0));
+
+        r = V(gather_masked(base, idx, mask));
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, bit_and(load_u<V>(expected), mask), r);
+    }
+}
+
 template<unsigned B>
 void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 {
@@ -118,6 +233,31 @@ void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 
     test_load_helper<float32<B/4>, vnum>(tc, tr, v.pf32);
     test_load_helper<float64<B/8>, vnum>(tc, tr, v.pf64);
+
+    test_load_masked<uint8<B>>(tc, tr, v.pu8);
+    test_load_masked<uint16<B/2>>(tc, tr, v.pu16);
+    test_load_masked<uint32<B/4>>(tc, tr, v.pu32);
+    test_load_masked<uint64<B/8>>(tc, tr, v.pu64);
+    test_load_masked<int32<B/4>>(tc, tr, v.pi32);
+    test_load_masked<int64<B/8>>(tc, tr, v.pi64);
+    test_load_masked<float32<B/4>>(tc, tr, v.pf32);
+    test_load_masked<float64<B/8>>(tc, tr, v.pf64);
+
+    test_load_first_last<uint8<B>>(tc, tr, v.pu8);
+    test_load_first_last<uint16<B/2>>(tc, tr, v.pu16);
+    test_load_first_last<uint32<B/4>>(tc, tr, v.pu32);
+    test_load_first_last<uint64<B/8>>(tc, tr, v.pu64);
+    test_load_first_last<int8<B>>(tc, tr, v.pi8);
+    test_load_first_last<int32<B/4>>(tc, tr, v.pi32);
+    test_load_first_last<float32<B/4>>(tc, tr, v.pf32);
+    test_load_first_last<float64<B/8>>(tc, tr, v.pf64);
+
+    test_gather<uint32<B/4>, int32<B/4>>(tc, tr, v.pu32);
+    test_gather<int32<B/4>, uint32<B/4>>(tc, tr, v.pi32);
+    test_gather<float32<B/4>, int32<B/4>>(tc, tr, v.pf32);
+    test_gather<uint64<B/8>, int64<B/8>>(tc, tr, v.pu64);
+    test_gather<int64<B/8>, uint64<B/8>>(tc, tr, v.pi64);
+    test_gather<float64<B/8>, int64<B/8>>(tc, tr, v.pf64);
 }
 
 void test_memory_load(TestResults& res, TestReporter& tr)
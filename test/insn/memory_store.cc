@@ -24,7 +24,7 @@ void test_store_masked(TestResultsSet& tc, TestReporter& tr, const V* sv)
     // NOTE: MSVC 2013 does not support constant expressions within
     // SIMDPP_ALIGN, thus we're aligning to the alignment of the largest V
     // is going to be instantiated with
-    SIMDPP_ALIGN(64) E rdata[V::length];
+    SIMDPP_ALIGN(64) E rdata[V::length * 2];
 
     tc.reset_seq();
     TestData<V> mask_data;
@@ -45,6 +45,16 @@ void test_store_masked(TestResultsSet& tc, TestReporter& tr, const V* sv)
 
         V rv = load(rdata);
         TEST_EQUAL(tr, bit_and(sv[0], mask), rv);
+
+        std::memset(rdata, 0, V::length_bytes * 2);
+
+        store_masked_u(rdata + 1, sv[0], mask);
+        TEST_PUSH_STORED(tc, V, rdata + 1, 1);
+
+        rv = load_u(rdata + 1);
+        TEST_EQUAL(tr, bit_and(sv[0], mask), rv);
+        TEST_EQUAL(tr, E(0), rdata[0]);
+        TEST_EQUAL(tr, E(0), rdata[V::length + 1]);
     }
 
 }
@@ -160,6 +170,58 @@ void test_store_helper(TestResultsSet& tc, TestReporter& tr, const V* sv)
     TEST_NOT_EQUAL_MEMORY(tr, data_zero, rdata + 3 * V::length, V::length);
 }
 
+template<class V, class I>
+void test_scatter(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+
+    SIMDPP_ALIGN(64) E rdata[V::length * 2];
+    SIMDPP_ALIGN(64) E sdata[V::length];
+    store(sdata, sv[0]);
+
+    // Half of the indices are negative relative to the base pointer. Every
+    // other element is written to so that the untouched ones can be checked.
+    E* base = rdata + V::length;
+    IE indices[V::length];
+    int offsets[V::length];
+    for (unsigned i = 0; i < V::length; ++i) {
+        offsets[i] = int((i * 3 + 1) % V::length) * 2 - int(V::length);
+        indices[i] = IE(offsets[i]);
+    }
+    I idx = load_u(indices);
+
+    tc.reset_seq();
+    std::memset(rdata, 0, sizeof(rdata));
+    scatter(base, idx, sv[0]);
+    TEST_PUSH_STORED(tc, V, rdata, 2);
+    for (unsigned i = 0; i < V::length; ++i) {
+        TEST_EQUAL(tr, sdata[i], base[offsets[i]]);
+        TEST_EQUAL(tr, E(0), base[offsets[i] + 1]);
+    }
+
+    TestData<V> mask_data;
+    mask_data.add(make_int(0, 0, 0, 0));
+    mask_data.add(make_int(1, 0, 0, 0));
+    mask_data.add(make_int(0, 1, 1, 0));
+    mask_data.add(make_int(1, 1, 1, 1));
+
+    for (unsigned j = 0; j < mask_data.size(); ++j) {
+        typename V::mask_vector_type mask;
+        mask = bit_not(cmp_eq(mask_data[j], 0));
+        SIMDPP_ALIGN(64) E mdata[V::length];
+        store(mdata, bit_and(sv[0], mask));
+
+        std::memset(rdata, 0, sizeof(rdata));
+        scatter_masked(base, idx, sv[0], mask);
+        TEST_PUSH_STORED(tc, V, rdata, 2);
+        for (unsigned i = 0; i < V::length; ++i) {
+            TEST_EQUAL(tr, mdata[i], base[offsets[i]]);
+        }
+    }
+}
+
 template<unsigned B>
 void test_memory_store_n(TestResultsSet& tc, TestReporter& tr)
 {
@@ -188,6 +250,15 @@ void test_memory_store_n(TestResultsSet& tc, TestReporter& tr)
     test_store_masked<int64<B/8>>(tc, tr, v.i64);
     test_store_masked<float32<B/4>>(tc, tr, v.f32);
     test_store_masked<float64<B/8>>(tc, tr, v.f64);
+    test_store_masked<uint8<B>>(tc, tr, v.u8);
+    test_store_masked<uint16<B/2>>(tc, tr, v.u16);
+
+    test_scatter<uint32<B/4>, int32<B/4>>(tc, tr, v.u32);
+    test_scatter<int32<B/4>, uint32<B/4>>(tc, tr, v.i32);
+    test_scatter<float32<B/4>, int32<B/4>>(tc, tr, v.f32);
+    test_scatter<uint64<B/8>, int64<B/8>>(tc, tr, v.u64);
+    test_scatter<int64<B/8>, uint64<B/8>>(tc, tr, v.i64);
+    test_scatter<float64<B/8>, int64<B/8>>(tc, tr, v.f64);
 }
 
 void test_memory_store(TestResults& res, TestReporter& tr)
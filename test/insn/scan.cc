@@ -0,0 +1,192 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Builds test inputs from small integers so that the floating-point sums are
+// exact regardless of the order of additions
+template<class T, unsigned N>
+void make_scan_input(T* src, const int* p)
+{
+    for (unsigned i = 0; i < N; ++i) {
+        src[i] = T(p[0] + p[1] * int(i % 7) + p[2] * int(i % 3) + p[3] * int(i % 5));
+    }
+}
+
+static const int scan_patterns[][4] = {
+    { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 3, -7, 5, 0 }, { -1, 2, -3, 1 },
+    { 100, -101, 37, -2 }, { 0, 1, -1, 3 }
+};
+
+// Checks scan_add against a scalar implementation
+template<class V>
+void test_scan_add_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+
+    for (const auto& p : scan_patterns) {
+        SIMDPP_ALIGN(64) T src[N];
+        SIMDPP_ALIGN(64) T exp_add[N];
+        make_scan_input<T, N>(src, p);
+        exp_add[0] = src[0];
+        for (unsigned i = 1; i < N; ++i) {
+            exp_add[i] = T(exp_add[i-1] + src[i]);
+        }
+
+        V r = scan_add(V(load(src)));
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, r, V(load(exp_add)));
+    }
+}
+
+// Checks scan_max and scan_min against a scalar implementation
+template<class V>
+void test_scan_minmax_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+
+    for (const auto& p : scan_patterns) {
+        SIMDPP_ALIGN(64) T src[N];
+        SIMDPP_ALIGN(64) T exp_max[N];
+        SIMDPP_ALIGN(64) T exp_min[N];
+        make_scan_input<T, N>(src, p);
+        exp_max[0] = exp_min[0] = src[0];
+        for (unsigned i = 1; i < N; ++i) {
+            exp_max[i] = std::max(exp_max[i-1], src[i]);
+            exp_min[i] = std::min(exp_min[i-1], src[i]);
+        }
+
+        V a = load(src);
+        V r = scan_max(a);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, r, V(load(exp_max)));
+        r = scan_min(a);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, r, V(load(exp_min)));
+    }
+}
+
+template<class V>
+void test_scan_type(TestResultsSet& tc, TestReporter& tr)
+{
+    test_scan_add_type<V>(tc, tr);
+    test_scan_minmax_type<V>(tc, tr);
+}
+
+struct ScanInclusive {
+    static const bool exclusive = false;
+    template<class T> T operator()(T* dst, const T* src, unsigned n, T init) const
+    {
+        return simdpp::scan_add(dst, src, n, init);
+    }
+};
+
+struct ScanExclusive {
+    static const bool exclusive = true;
+    template<class T> T operator()(T* dst, const T* src, unsigned n, T init) const
+    {
+        return simdpp::scan_add_exclusive(dst, src, n, init);
+    }
+};
+
+// Checks the array variants for all lengths up to a few vectors, which covers
+// the scalar tail, and for in-place operation
+template<class T, class F>
+void test_scan_array_type(TestReporter& tr, F scan)
+{
+    const unsigned max_n = 200;
+    std::vector<T> src(max_n);
+    for (unsigned i = 0; i < max_n; ++i) {
+        src[i] = T((i * 37 + 11) % 29);
+    }
+
+    for (unsigned n = 0; n < max_n; n += (n < 70 ? 1 : 13)) {
+        std::vector<T> expected(n);
+        T sum = T(5);
+        for (unsigned i = 0; i < n; ++i) {
+            T s = T(sum + src[i]);
+            expected[i] = F::exclusive ? sum : s;
+            sum = s;
+        }
+
+        std::vector<T> dst(n + 1, T(99));
+        std::vector<T> inplace(src.begin(), src.begin() + n);
+        T total = scan(dst.data(), src.data(), n, T(5));
+        T total_inplace = scan(inplace.data(), inplace.data(), n, T(5));
+        TEST_EQUAL(tr, total, sum);
+        TEST_EQUAL(tr, total_inplace, sum);
+        TEST_EQUAL(tr, dst[n], T(99));
+        TEST_EQUAL(tr, std::equal(expected.begin(), expected.end(), dst.begin()), true);
+        TEST_EQUAL(tr, std::equal(expected.begin(), expected.end(), inplace.begin()), true);
+    }
+}
+
+template<unsigned B>
+void test_scan_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_scan_type<uint8<B>>(tc, tr);
+    test_scan_type<int8<B>>(tc, tr);
+    test_scan_type<uint16<B/2>>(tc, tr);
+    test_scan_type<int16<B/2>>(tc, tr);
+    test_scan_type<uint32<B/4>>(tc, tr);
+    test_scan_type<int32<B/4>>(tc, tr);
+    test_scan_add_type<uint64<B/8>>(tc, tr);
+    test_scan_add_type<int64<B/8>>(tc, tr);
+    test_scan_type<float32<B/4>>(tc, tr);
+    test_scan_type<float64<B/8>>(tc, tr);
+}
+
+template<unsigned B>
+void test_scan_minmax64_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_scan_minmax_type<uint64<B/8>>(tc, tr);
+    test_scan_minmax_type<int64<B/8>>(tc, tr);
+}
+
+void test_scan(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("scan");
+
+    test_scan_n<16>(tc, tr);
+    test_scan_n<32>(tc, tr);
+    test_scan_n<64>(tc, tr);
+
+    // 64-bit max and min are available only on some instruction sets. Their
+    // results form a separate sequence at the end so that it is skipped when
+    // comparing with the other instruction sets.
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+    tc.reset_seq();
+    test_scan_minmax64_n<16>(tc, tr);
+    test_scan_minmax64_n<32>(tc, tr);
+    test_scan_minmax64_n<64>(tc, tr);
+#endif
+
+    test_scan_array_type<uint8_t>(tr, ScanInclusive());
+    test_scan_array_type<int16_t>(tr, ScanInclusive());
+    test_scan_array_type<uint32_t>(tr, ScanInclusive());
+    test_scan_array_type<int64_t>(tr, ScanInclusive());
+    test_scan_array_type<float>(tr, ScanInclusive());
+    test_scan_array_type<double>(tr, ScanInclusive());
+    test_scan_array_type<int8_t>(tr, ScanExclusive());
+    test_scan_array_type<uint16_t>(tr, ScanExclusive());
+    test_scan_array_type<int32_t>(tr, ScanExclusive());
+    test_scan_array_type<uint64_t>(tr, ScanExclusive());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
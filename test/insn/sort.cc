@@ -0,0 +1,210 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// A simple LCG is sufficient to produce unsorted values. The values are
+// reduced modulo m so that duplicates appear.
+struct SortRandom {
+    uint64_t x = 0x2545f4914f6cdd1d;
+
+    template<class T> T next(unsigned m)
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        int v = int((x >> 33) % m);
+        return std::is_signed<T>::value ? T(v - int(m / 2)) : T(v);
+    }
+};
+
+template<class V>
+void test_sort_network_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+    SortRandom rnd;
+
+    for (unsigned i = 0; i < 20; ++i) {
+        SIMDPP_ALIGN(64) T a[N], b[N], c[N], d[N];
+        SIMDPP_ALIGN(64) T ab[N*2];
+        for (unsigned j = 0; j < N; ++j) {
+            a[j] = rnd.next<T>(i < 10 ? 7 : 1000);
+            b[j] = rnd.next<T>(i < 10 ? 7 : 1000);
+            c[j] = rnd.next<T>(1000);
+            d[j] = rnd.next<T>(1000);
+        }
+
+        V va = sort_bitonic(V(load(a)));
+        V vb = sort_bitonic(V(load(b)));
+        TEST_PUSH(tc, V, va);
+        std::copy(a, a + N, ab);
+        std::copy(b, b + N, ab + N);
+        std::sort(a, a + N);
+        std::sort(b, b + N);
+        TEST_EQUAL(tr, va, V(load(a)));
+        TEST_EQUAL(tr, vb, V(load(b)));
+
+        merge_bitonic(va, vb);
+        TEST_PUSH(tc, V, va);
+        TEST_PUSH(tc, V, vb);
+        std::sort(ab, ab + N*2);
+        TEST_EQUAL(tr, va, V(load(ab)));
+        TEST_EQUAL(tr, vb, V(load(ab + N)));
+
+        V v0 = load(a), v1 = load(b), v2 = load(c), v3 = load(d);
+        sort_columns(v0, v1, v2, v3);
+        for (unsigned j = 0; j < N; ++j) {
+            T col[4] = { a[j], b[j], c[j], d[j] };
+            std::sort(col, col + 4);
+            a[j] = col[0]; b[j] = col[1]; c[j] = col[2]; d[j] = col[3];
+        }
+        TEST_EQUAL(tr, v0, V(load(a)));
+        TEST_EQUAL(tr, v1, V(load(b)));
+        TEST_EQUAL(tr, v2, V(load(c)));
+        TEST_EQUAL(tr, v3, V(load(d)));
+    }
+}
+
+// Orders floating-point values the same way as simdpp::sort: -0.0 before 0.0
+template<class T>
+bool sort_test_less(T a, T b)
+{
+    if (a == b)
+        return std::signbit(a) && !std::signbit(b);
+    return a < b;
+}
+
+template<class T>
+void test_sort_array_type(TestReporter& tr)
+{
+    SortRandom rnd;
+    std::vector<unsigned> sizes;
+    for (unsigned n = 0; n < 140; ++n)
+        sizes.push_back(n);
+    sizes.push_back(1000);
+    sizes.push_back(4099);
+
+    for (unsigned n : sizes) {
+        std::vector<T> a(n);
+        for (unsigned i = 0; i < n; ++i)
+            a[i] = rnd.next<T>(n % 2 ? 50 : 100000);
+        if (std::is_floating_point<T>::value && n > 10) {
+            a[1] = T(-0.0);
+            a[3] = T(0.0);
+            a[5] = -std::numeric_limits<T>::infinity();
+            a[7] = std::numeric_limits<T>::infinity();
+        }
+        std::vector<T> expected = a;
+        std::sort(expected.begin(), expected.end(), sort_test_less<T>);
+        simdpp::sort(a.data(), a.data() + n);
+        TEST_EQUAL(tr, std::memcmp(a.data(), expected.data(), n * sizeof(T)), 0);
+    }
+}
+
+template<class T>
+void test_sort_nan(TestReporter& tr)
+{
+    T nan = std::numeric_limits<T>::quiet_NaN();
+    std::vector<T> a = { T(3), nan, T(-1), T(2), nan, T(0) };
+    simdpp::sort(a.data(), a.data() + a.size());
+    TEST_EQUAL(tr, a[0], T(-1));
+    TEST_EQUAL(tr, a[1], T(0));
+    TEST_EQUAL(tr, a[2], T(2));
+    TEST_EQUAL(tr, a[3], T(3));
+    TEST_EQUAL(tr, std::isnan(a[4]) && std::isnan(a[5]), true);
+}
+
+template<class T>
+void test_sort_pairs_type(TestReporter& tr)
+{
+    SortRandom rnd;
+    for (unsigned n : { 0u, 1u, 2u, 5u, 17u, 64u, 333u, 5000u }) {
+        std::vector<T> keys(n), orig(n);
+        std::vector<uint32_t> values(n);
+        for (unsigned i = 0; i < n; ++i) {
+            keys[i] = orig[i] = rnd.next<T>(n / 3 + 1);
+            values[i] = n - 1 - i;
+        }
+        simdpp::sort(keys.data(), keys.data() + n, values.data());
+
+        bool ok = true;
+        std::vector<bool> seen(n, false);
+        for (unsigned i = 0; i < n; ++i) {
+            uint32_t v = values[i];
+            ok = ok && v < n && !seen[v] && keys[i] == orig[n - 1 - v];
+            if (v < n)
+                seen[v] = true;
+            if (i > 0) {
+                ok = ok && (keys[i-1] < keys[i] ||
+                            (keys[i-1] == keys[i] && values[i-1] < v));
+            }
+        }
+        TEST_EQUAL(tr, ok, true);
+    }
+}
+
+template<unsigned B>
+void test_sort_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_sort_network_type<uint32<B/4>>(tc, tr);
+    test_sort_network_type<int32<B/4>>(tc, tr);
+    test_sort_network_type<float32<B/4>>(tc, tr);
+    test_sort_network_type<float64<B/8>>(tc, tr);
+}
+
+template<unsigned B>
+void test_sort64_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_sort_network_type<uint64<B/8>>(tc, tr);
+    test_sort_network_type<int64<B/8>>(tc, tr);
+}
+
+void test_sort(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("sort");
+
+    test_sort_n<16>(tc, tr);
+    test_sort_n<32>(tc, tr);
+    test_sort_n<64>(tc, tr);
+
+    // The sorting networks of 64-bit integers need 64-bit max and min which
+    // are available only on some instruction sets. Their results form a
+    // separate sequence at the end so that it is skipped when comparing with
+    // the other instruction sets.
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+    tc.reset_seq();
+    test_sort64_n<16>(tc, tr);
+    test_sort64_n<32>(tc, tr);
+    test_sort64_n<64>(tc, tr);
+#endif
+
+    test_sort_array_type<int32_t>(tr);
+    test_sort_array_type<uint32_t>(tr);
+    test_sort_array_type<float>(tr);
+    test_sort_array_type<int64_t>(tr);
+    test_sort_array_type<uint64_t>(tr);
+    test_sort_array_type<double>(tr);
+    test_sort_nan<float>(tr);
+    test_sort_nan<double>(tr);
+
+    test_sort_pairs_type<int32_t>(tr);
+    test_sort_pairs_type<uint32_t>(tr);
+    test_sort_pairs_type<float>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -62,10 +62,24 @@ void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& o
     test_shuffle_generic(res);
     test_shuffle(res);
     test_shuffle_bytes(res, tr);
+    test_compress(res, tr);
 
     test_convert(res);
     test_math_fp(res, opts);
+    test_math_func(res, tr);
     test_math_int(res);
+    test_math_div(res, tr);
+    test_scan(res, tr);
+    test_sort(res, tr);
+    test_byte_search(res, tr);
+    test_utf8(res, tr);
+    test_encoding(res, tr);
+    test_crc(res, tr);
+    test_hash(res, tr);
+    test_group_match(res, tr);
+    test_bitpack(res, tr);
+    test_varint(res, tr);
+    test_math_masked(res, tr);
     test_compare(res);
     test_math_shift(res);
     test_transpose(res);
@@ -19,12 +19,26 @@ namespace SIMDPP_ARCH_NAMESPACE {
 void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& opts);
 void test_bitwise(TestResults& res, TestReporter& tr);
 void test_blend(TestResults& res);
+void test_byte_search(TestResults& res, TestReporter& tr);
 void test_compare(TestResults& res);
+void test_compress(TestResults& res, TestReporter& tr);
 void test_convert(TestResults& res);
+void test_crc(TestResults& res, TestReporter& tr);
+void test_hash(TestResults& res, TestReporter& tr);
+void test_group_match(TestResults& res, TestReporter& tr);
+void test_bitpack(TestResults& res, TestReporter& tr);
+void test_varint(TestResults& res, TestReporter& tr);
+void test_encoding(TestResults& res, TestReporter& tr);
 void test_construct(TestResults& res);
 void test_for_each(TestResults& res, TestReporter& tr);
+void test_math_div(TestResults& res, TestReporter& tr);
 void test_math_fp(TestResults& res, const TestOptions& opts);
+void test_math_func(TestResults& res, TestReporter& tr);
 void test_math_int(TestResults& res);
+void test_math_masked(TestResults& res, TestReporter& tr);
+void test_scan(TestResults& res, TestReporter& tr);
+void test_sort(TestResults& res, TestReporter& tr);
+void test_utf8(TestResults& res, TestReporter& tr);
 void test_math_shift(TestResults& res);
 void test_memory_load(TestResults& res, TestReporter& tr);
 void test_memory_store(TestResults& res, TestReporter& tr);
@@ -0,0 +1,246 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+struct UtfRandom {
+    uint64_t x = 0x2545f4914f6cdd1d;
+
+    unsigned next(unsigned m)
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        return unsigned((x >> 33) % m);
+    }
+
+    // Returns a code point with an UTF-8 sequence of the given length
+    uint32_t next_cp(unsigned len)
+    {
+        switch (len) {
+        case 1: return next(0x80);
+        case 2: return 0x80 + next(0x800 - 0x80);
+        case 3: {
+            uint32_t cp = 0x800 + next(0x10000 - 0x800 - 0x800);
+            return cp >= 0xd800 ? cp + 0x800 : cp;
+        }
+        default: return 0x10000 + next(0x110000 - 0x10000);
+        }
+    }
+};
+
+// Decodes UTF-8 following the table 3-7 of the Unicode standard
+static bool ref_utf8_decode(const std::string& s, std::vector<uint32_t>& cps)
+{
+    cps.clear();
+    std::size_t i = 0;
+    while (i < s.size()) {
+        unsigned b0 = (unsigned char) s[i];
+        unsigned len, lo = 0x80, hi = 0xbf;
+        uint32_t cp;
+        if (b0 < 0x80) { len = 1; cp = b0; }
+        else if (b0 >= 0xc2 && b0 <= 0xdf) { len = 2; cp = b0 & 0x1f; }
+        else if (b0 == 0xe0) { len = 3; cp = b0 & 0x0f; lo = 0xa0; }
+        else if (b0 == 0xed) { len = 3; cp = b0 & 0x0f; hi = 0x9f; }
+        else if (b0 >= 0xe1 && b0 <= 0xef) { len = 3; cp = b0 & 0x0f; }
+        else if (b0 == 0xf0) { len = 4; cp = b0 & 0x07; lo = 0x90; }
+        else if (b0 == 0xf4) { len = 4; cp = b0 & 0x07; hi = 0x8f; }
+        else if (b0 >= 0xf1 && b0 <= 0xf3) { len = 4; cp = b0 & 0x07; }
+        else return false;
+        if (i + len > s.size())
+            return false;
+        for (unsigned k = 1; k < len; ++k) {
+            unsigned b = (unsigned char) s[i + k];
+            if (b < (k == 1 ? lo : 0x80) || b > (k == 1 ? hi : 0xbf))
+                return false;
+            cp = (cp << 6) | (b & 0x3f);
+        }
+        cps.push_back(cp);
+        i += len;
+    }
+    return true;
+}
+
+static void ref_utf8_encode(std::string& s, uint32_t cp)
+{
+    if (cp < 0x80) {
+        s += char(cp);
+    } else if (cp < 0x800) {
+        s += char(0xc0 | (cp >> 6));
+        s += char(0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+        s += char(0xe0 | (cp >> 12));
+        s += char(0x80 | ((cp >> 6) & 0x3f));
+        s += char(0x80 | (cp & 0x3f));
+    } else {
+        s += char(0xf0 | (cp >> 18));
+        s += char(0x80 | ((cp >> 12) & 0x3f));
+        s += char(0x80 | ((cp >> 6) & 0x3f));
+        s += char(0x80 | (cp & 0x3f));
+    }
+}
+
+static std::u16string ref_utf16(const std::vector<uint32_t>& cps)
+{
+    std::u16string r;
+    for (uint32_t cp : cps) {
+        if (cp < 0x10000) {
+            r += char16_t(cp);
+        } else {
+            r += char16_t(0xd800 + ((cp - 0x10000) >> 10));
+            r += char16_t(0xdc00 + ((cp - 0x10000) & 0x3ff));
+        }
+    }
+    return r;
+}
+
+/*  Generates code points with UTF-8 sequences of lengths from 1 to
+    @a max_len. The proportion of ASCII characters is varied so that all of
+    ASCII, mixed and non-ASCII chunks are produced.
+*/
+static std::vector<uint32_t> make_utf_input(UtfRandom& rnd, unsigned n,
+                                            unsigned max_len, unsigned ascii_pct)
+{
+    std::vector<uint32_t> cps;
+    for (unsigned i = 0; i < n; ++i) {
+        unsigned len = rnd.next(100) < ascii_pct ? 1 : 1 + rnd.next(max_len);
+        cps.push_back(rnd.next_cp(len));
+    }
+    return cps;
+}
+
+static void check_utf8_input(TestReporter& tr, const std::string& s)
+{
+    using namespace simdpp;
+    std::vector<uint32_t> cps;
+    bool valid = ref_utf8_decode(s, cps);
+    TEST_EQUAL(tr, utf8_validate(s.data(), s.size()), valid);
+
+    std::vector<char16_t> out16(s.size() + 1);
+    std::vector<char32_t> out32(s.size() + 1);
+    std::size_t n16 = utf8_to_utf16(s.data(), s.size(), out16.data());
+    std::size_t n32 = utf8_to_utf32(s.data(), s.size(), out32.data());
+    if (!valid) {
+        TEST_EQUAL(tr, n16, utf_invalid);
+        TEST_EQUAL(tr, n32, utf_invalid);
+        return;
+    }
+    std::u16string ref16 = ref_utf16(cps);
+    TEST_EQUAL(tr, std::u16string(out16.data(), n16 == utf_invalid ? 0 : n16) == ref16, true);
+    TEST_EQUAL(tr, std::vector<uint32_t>(out32.begin(), out32.begin() +
+                   (n32 == utf_invalid ? 0 : n32)) == cps, true);
+}
+
+void test_utf8_from_utf8(TestReporter& tr)
+{
+    UtfRandom rnd;
+    const char* invalid[] = {
+        "\x80", "\xbf", "\xc0\xaf", "\xc1\xbf", "\xc3", "\xc3\x41",
+        "\xe0\x80\xaf", "\xe0\x9f\xbf", "\xe2\x82", "\xe2\x28\xa1",
+        "\xed\xa0\x80", "\xed\xbf\xbf", "\xf0\x80\x80\xaf", "\xf0\x8f\xbf\xbf",
+        "\xf0\x90\x80", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xf8",
+        "\xff", "\xc3\xa9\xa9", "\xe2\x82\xac\x80"
+    };
+
+    for (unsigned n = 0; n < 150; n += (n < 40 ? 1 : 7)) {
+        for (unsigned max_len = 1; max_len <= 4; ++max_len) {
+            for (unsigned ascii_pct : { 0u, 50u, 95u }) {
+                std::vector<uint32_t> cps = make_utf_input(rnd, n, max_len, ascii_pct);
+                std::string s;
+                for (uint32_t cp : cps)
+                    ref_utf8_encode(s, cp);
+                check_utf8_input(tr, s);
+
+                // single invalid sequences at the beginning, in the middle
+                // and at the end
+                for (const char* inv : invalid) {
+                    std::size_t pos[3] = { 0, s.size() / 2, s.size() };
+                    for (std::size_t p : pos) {
+                        // move to a sequence boundary
+                        while (p < s.size() && (s[p] & 0xc0) == 0x80)
+                            ++p;
+                        std::string t = s;
+                        t.insert(p, inv);
+                        check_utf8_input(tr, t);
+                    }
+                }
+
+                // random byte replacements
+                for (unsigned k = 0; k < 4 && !s.empty(); ++k) {
+                    std::string t = s;
+                    t[rnd.next(unsigned(t.size()))] = char(rnd.next(256));
+                    check_utf8_input(tr, t);
+                }
+            }
+        }
+    }
+}
+
+void test_utf8_to_utf8(TestReporter& tr)
+{
+    using namespace simdpp;
+    UtfRandom rnd;
+    for (unsigned n = 0; n < 150; n += (n < 40 ? 1 : 7)) {
+        for (unsigned max_len = 1; max_len <= 4; ++max_len) {
+            for (unsigned ascii_pct : { 0u, 50u, 95u }) {
+                std::vector<uint32_t> cps = make_utf_input(rnd, n, max_len, ascii_pct);
+                std::string ref;
+                for (uint32_t cp : cps)
+                    ref_utf8_encode(ref, cp);
+                std::u16string s16 = ref_utf16(cps);
+                std::u32string s32(cps.begin(), cps.end());
+
+                std::vector<char> out(4 * n + 1);
+                std::size_t r16 = utf16_to_utf8(s16.data(), s16.size(), out.data());
+                TEST_EQUAL(tr, r16, ref.size());
+                TEST_EQUAL(tr, std::memcmp(out.data(), ref.data(), ref.size()), 0);
+                std::size_t r32 = utf32_to_utf8(s32.data(), s32.size(), out.data());
+                TEST_EQUAL(tr, r32, ref.size());
+                TEST_EQUAL(tr, std::memcmp(out.data(), ref.data(), ref.size()), 0);
+
+                if (n == 0)
+                    continue;
+                // unpaired surrogates and out of range code points
+                std::size_t p = rnd.next(unsigned(s16.size()));
+                for (char16_t u : { char16_t(0xd800), char16_t(0xdc00), char16_t(0xdfff) }) {
+                    std::u16string t = s16;
+                    // don't split an existing pair
+                    if (p > 0 && t[p - 1] >= 0xd800 && t[p - 1] < 0xdc00)
+                        --p;
+                    t.insert(t.begin() + p, u);
+                    r16 = utf16_to_utf8(t.data(), t.size(), out.data());
+                    TEST_EQUAL(tr, r16, utf_invalid);
+                }
+                std::u16string t16 = s16;
+                t16.push_back(char16_t(0xdbff));
+                r16 = utf16_to_utf8(t16.data(), t16.size(), out.data());
+                TEST_EQUAL(tr, r16, utf_invalid);
+
+                for (char32_t u : { char32_t(0xd800), char32_t(0xdfff), char32_t(0x110000) }) {
+                    std::u32string t = s32;
+                    t[rnd.next(unsigned(t.size()))] = u;
+                    r32 = utf32_to_utf8(t.data(), t.size(), out.data());
+                    TEST_EQUAL(tr, r32, utf_invalid);
+                }
+            }
+        }
+    }
+}
+
+void test_utf8(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    test_utf8_from_utf8(tr);
+    test_utf8_to_utf8(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,265 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+struct VarintRandom {
+    uint64_t x = 0x9e3779b97f4a7c15;
+
+    uint64_t next()
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        return x;
+    }
+
+    // Returns a value with a random number of significant bits, so that all
+    // encoded lengths are frequent
+    template<class T> T next_value()
+    {
+        unsigned bits = next() % (sizeof(T) * 8 + 1);
+        return bits == 0 ? T(0) : T(next() >> (64 - bits));
+    }
+};
+
+std::vector<uint8_t> ref_streamvbyte_encode(const std::vector<uint32_t>& in)
+{
+    std::size_t n = in.size();
+    std::vector<uint8_t> ctrl((n + 3) / 4, 0), data;
+    for (std::size_t i = 0; i < n; ++i) {
+        uint32_t x = in[i];
+        unsigned len = x > 0xffffff ? 4 : x > 0xffff ? 3 : x > 0xff ? 2 : 1;
+        for (unsigned b = 0; b < len; ++b)
+            data.push_back(uint8_t(x >> (8 * b)));
+        ctrl[i / 4] |= (len - 1) << (2 * (i % 4));
+    }
+    ctrl.insert(ctrl.end(), data.begin(), data.end());
+    return ctrl;
+}
+
+template<class T>
+std::vector<uint8_t> ref_varint_encode(const std::vector<T>& in)
+{
+    std::vector<uint8_t> r;
+    for (T x : in) {
+        do {
+            uint8_t b = x & 0x7f;
+            x >>= 7;
+            r.push_back(x != 0 ? b | 0x80 : b);
+        } while (x != 0);
+    }
+    return r;
+}
+
+template<class T>
+std::vector<T> ref_zigzag(const std::vector<T>& in)
+{
+    std::vector<T> r;
+    for (T x : in)
+        r.push_back(T(x << 1) ^ T(T(0) - (x >> (sizeof(T) * 8 - 1))));
+    return r;
+}
+
+template<class T>
+std::vector<T> ref_delta(const std::vector<T>& in, T prev)
+{
+    std::vector<T> r;
+    for (T x : in) {
+        r.push_back(T(x - prev));
+        prev = x;
+    }
+    return r;
+}
+
+template<class T>
+bool varint_equal(const std::vector<T>& a, const T* b, std::size_t n)
+{
+    return a.size() == n && std::equal(a.begin(), a.end(), b);
+}
+
+void test_streamvbyte_n(TestReporter& tr, VarintRandom& rnd, std::size_t n)
+{
+    using namespace simdpp;
+    std::vector<uint32_t> in(n), out(n + 1);
+    std::vector<uint8_t> enc(streamvbyte_max_size(n));
+    for (std::size_t i = 0; i < n; ++i)
+        in[i] = rnd.next_value<uint32_t>();
+
+    // plain
+    std::vector<uint8_t> ref = ref_streamvbyte_encode(in);
+    std::size_t size = streamvbyte_encode(in.data(), n, enc.data());
+    TEST_EQUAL(tr, varint_equal(ref, enc.data(), size), true);
+
+    out[n] = 0xdeadbeef;
+    TEST_EQUAL(tr, streamvbyte_decode(enc.data(), size, out.data(), n), size);
+    TEST_EQUAL(tr, varint_equal(in, out.data(), n), true);
+    TEST_EQUAL(tr, out[n], uint32_t(0xdeadbeef));
+    if (n > 0) {
+        TEST_EQUAL(tr, streamvbyte_decode(enc.data(), size - 1, out.data(), n),
+                   varint_invalid);
+    }
+
+    // zigzag
+    std::vector<int32_t> sin(n), sout(n);
+    for (std::size_t i = 0; i < n; ++i)
+        sin[i] = int32_t(rnd.next_value<uint32_t>() >> 1) * (rnd.next() % 2 ? 1 : -1);
+    if (n > 2) {
+        sin[0] = INT32_MIN;
+        sin[n-1] = INT32_MAX;
+    }
+    std::vector<uint32_t> zz(sin.begin(), sin.end());
+    ref = ref_streamvbyte_encode(ref_zigzag(zz));
+    size = streamvbyte_encode_zigzag(sin.data(), n, enc.data());
+    TEST_EQUAL(tr, varint_equal(ref, enc.data(), size), true);
+    TEST_EQUAL(tr, streamvbyte_decode_zigzag(enc.data(), size, sout.data(), n), size);
+    TEST_EQUAL(tr, varint_equal(sin, sout.data(), n), true);
+
+    // delta, the sequence wraps around
+    uint32_t prev = uint32_t(rnd.next());
+    uint32_t x = prev;
+    for (std::size_t i = 0; i < n; ++i) {
+        x += rnd.next_value<uint32_t>() >> (rnd.next() % 32);
+        in[i] = x;
+    }
+    ref = ref_streamvbyte_encode(ref_delta(in, prev));
+    size = streamvbyte_encode_delta(in.data(), n, enc.data(), prev);
+    TEST_EQUAL(tr, varint_equal(ref, enc.data(), size), true);
+    TEST_EQUAL(tr, streamvbyte_decode_delta(enc.data(), size, out.data(), n, prev), size);
+    TEST_EQUAL(tr, varint_equal(in, out.data(), n), true);
+}
+
+template<class T>
+void test_varint_n(TestReporter& tr, VarintRandom& rnd, std::size_t n)
+{
+    using namespace simdpp;
+    using S = typename std::make_signed<T>::type;
+    const std::size_t max_size = n * (sizeof(T) == 4 ? 5 : 10);
+
+    // the values are mostly short so that the vector paths are taken
+    std::vector<T> in(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        T x = rnd.next_value<T>();
+        in[i] = rnd.next() % 4 != 0 ? x >> (sizeof(T) * 8 - 16) : x;
+    }
+    std::vector<uint8_t> enc(max_size);
+    std::vector<T> out(max_size + 1);
+
+    std::vector<uint8_t> ref = ref_varint_encode(in);
+    std::size_t size = varint_encode(in.data(), n, enc.data());
+    TEST_EQUAL(tr, varint_equal(ref, enc.data(), size), true);
+
+    out[size] = T(0xdeadbeef);
+    TEST_EQUAL(tr, varint_decode(enc.data(), size, out.data()), n);
+    TEST_EQUAL(tr, varint_equal(in, out.data(), n), true);
+    TEST_EQUAL(tr, out[size], T(0xdeadbeef));
+    if (n > 0) {
+        // dropping the last byte leaves either a truncated varint or one less
+        // complete value
+        std::size_t expected = size > 1 && (enc[size - 2] & 0x80) ? varint_invalid : n - 1;
+        TEST_EQUAL(tr, varint_decode(enc.data(), size - 1, out.data()), expected);
+    }
+
+    // zigzag
+    std::vector<S> sin(n), sout(max_size);
+    for (std::size_t i = 0; i < n; ++i)
+        sin[i] = S(in[i] >> 1) * (rnd.next() % 2 ? 1 : -1);
+    if (n > 2) {
+        sin[0] = std::numeric_limits<S>::min();
+        sin[n-1] = std::numeric_limits<S>::max();
+    }
+    ref = ref_varint_encode(ref_zigzag(std::vector<T>(sin.begin(), sin.end())));
+    size = varint_encode_zigzag(sin.data(), n, enc.data());
+    TEST_EQUAL(tr, varint_equal(ref, enc.data(), size), true);
+    TEST_EQUAL(tr, varint_decode_zigzag(enc.data(), size, sout.data()), n);
+    TEST_EQUAL(tr, varint_equal(sin, sout.data(), n), true);
+
+    // delta, the sequence wraps around
+    T prev = T(rnd.next());
+    T x = prev;
+    for (std::size_t i = 0; i < n; ++i) {
+        x += in[i];
+        in[i] = x;
+    }
+    ref = ref_varint_encode(ref_delta(in, prev));
+    size = varint_encode_delta(in.data(), n, enc.data(), prev);
+    TEST_EQUAL(tr, varint_equal(ref, enc.data(), size), true);
+    TEST_EQUAL(tr, varint_decode_delta(enc.data(), size, out.data(), prev), n);
+    TEST_EQUAL(tr, varint_equal(in, out.data(), n), true);
+}
+
+// Checks that invalid varints are detected both in the middle of input that
+// is decoded using vector instructions and at the end of input. Truncated
+// varints are invalid only at the end.
+template<class T>
+void test_varint_invalid(TestReporter& tr, const std::vector<uint8_t>& bad,
+                         bool truncated)
+{
+    using namespace simdpp;
+    for (unsigned prefix : { 0, 1, 7, 40 }) {
+        std::vector<uint8_t> in(prefix, 0x05);
+        in.insert(in.end(), bad.begin(), bad.end());
+        std::vector<T> out(in.size());
+        TEST_EQUAL(tr, varint_decode(in.data(), in.size(), out.data()), varint_invalid);
+        if (truncated)
+            continue;
+
+        in.insert(in.end(), 40, 0x01);
+        out.resize(in.size());
+        TEST_EQUAL(tr, varint_decode(in.data(), in.size(), out.data()), varint_invalid);
+    }
+}
+
+void test_varint(TestResults& res, TestReporter& tr)
+{
+    (void) res;
+    VarintRandom rnd;
+    for (std::size_t n = 0; n < 80; ++n) {
+        test_streamvbyte_n(tr, rnd, n);
+        test_varint_n<uint32_t>(tr, rnd, n);
+        test_varint_n<uint64_t>(tr, rnd, n);
+    }
+    test_streamvbyte_n(tr, rnd, 1000);
+    test_varint_n<uint32_t>(tr, rnd, 1000);
+    test_varint_n<uint64_t>(tr, rnd, 1000);
+
+    // the longest varints
+    std::vector<uint8_t> enc(10);
+    uint32_t x32;
+    uint64_t x64;
+    uint32_t max32 = 0xffffffff;
+    uint64_t max64 = 0xffffffffffffffff;
+    TEST_EQUAL(tr, simdpp::varint_encode(&max32, 1, enc.data()), std::size_t(5));
+    TEST_EQUAL(tr, simdpp::varint_decode(enc.data(), 5, &x32), std::size_t(1));
+    TEST_EQUAL(tr, x32, max32);
+    TEST_EQUAL(tr, simdpp::varint_encode(&max64, 1, enc.data()), std::size_t(10));
+    TEST_EQUAL(tr, simdpp::varint_decode(enc.data(), 10, &x64), std::size_t(1));
+    TEST_EQUAL(tr, x64, max64);
+
+    // truncated
+    test_varint_invalid<uint32_t>(tr, { 0x80 }, true);
+    test_varint_invalid<uint64_t>(tr, { 0xff, 0xff }, true);
+    // too long
+    test_varint_invalid<uint32_t>(tr, { 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 }, false);
+    test_varint_invalid<uint64_t>(tr, { 0x80, 0x80, 0x80, 0x80, 0x80,
+                                        0x80, 0x80, 0x80, 0x80, 0x80, 0x00 }, false);
+    // too large
+    test_varint_invalid<uint32_t>(tr, { 0xff, 0xff, 0xff, 0xff, 0x10 }, false);
+    test_varint_invalid<uint64_t>(tr, { 0xff, 0xff, 0xff, 0xff, 0xff,
+                                        0xff, 0xff, 0xff, 0xff, 0x02 }, false);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -7,9 +7,14 @@
 
 #include "dispatcher/dispatcher.h"
 #include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 #include <cstdlib>
+#include <cstring>
 #include "utils/test_helpers.h"
 
 // Check whether all available getters of supported architecture compiles
@@ -18,6 +23,7 @@
 #include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
 #include <simdpp/dispatch/get_arch_raw_cpuid.h>
 #include <simdpp/dispatch/get_arch_string_list.h>
+#include <simdpp/dispatch/telemetry.h>
 
 static simdpp::Arch g_supported_arch;
 
@@ -91,6 +97,173 @@ void test_dispatcher_template2_pair_for_type(TestReporter& tr)
     TEST_EQUAL(tr, (U)(sizeof(U)), pair.second);
 }
 
+void test_dispatcher_concurrent_first_call(TestReporter& tr)
+{
+    const unsigned num_threads = 8;
+    std::atomic<bool> go(false);
+    std::vector<int> results(num_threads);
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i]() {
+            while (!go.load()) {}
+            results[i] = test_dispatcher_concurrent(i);
+        });
+    }
+    go.store(true);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    for (unsigned i = 0; i < num_threads; ++i) {
+        TEST_EQUAL(tr, (int)(i * 2), results[i]);
+    }
+}
+
+void test_dispatcher_ifunc(TestReporter& tr)
+{
+    // The same architecture information is used for selection in both cases
+    simdpp::Arch ifunc_arch = test_dispatcher_ifunc_get_arch();
+    simdpp::Arch ptr_arch = test_dispatcher_ifunc_template_get_arch<int>();
+    TEST_EQUAL(tr, static_cast<unsigned>(ptr_arch),
+               static_cast<unsigned>(ifunc_arch));
+
+    TEST_EQUAL(tr, 1+2, test_dispatcher_ifunc_ret2(1, 2));
+
+    g_test_dispatcher_val = 0;
+    test_dispatcher_ifunc_void1(42);
+    TEST_EQUAL(tr, 42, g_test_dispatcher_val);
+}
+
+void test_detected_arch(TestReporter& tr)
+{
+    // The result is cached, thus it must be the same across calls and threads
+    simdpp::Arch arch = simdpp::detected_arch();
+    simdpp::Arch thread_arch = simdpp::Arch::NONE_NULL;
+    std::thread t([&]() { thread_arch = simdpp::detected_arch(); });
+    t.join();
+    TEST_EQUAL(tr, static_cast<unsigned>(arch),
+               static_cast<unsigned>(simdpp::detected_arch()));
+    TEST_EQUAL(tr, static_cast<unsigned>(arch),
+               static_cast<unsigned>(thread_arch));
+
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    TEST_EQUAL(tr, static_cast<unsigned>(simdpp::get_arch_raw_cpuid()),
+               static_cast<unsigned>(arch));
+#endif
+}
+
+void test_dispatcher_registry(TestReporter& tr)
+{
+    // Must be called before any of the dispatchers are used
+    std::vector<simdpp::DispatcherInfo> infos = simdpp::list_dispatchers();
+    auto find = [&](const std::string& name) {
+        for (const auto& info : infos) {
+            // the amount of whitespace depends on the preprocessor
+            std::string info_name = info.name;
+            info_name.erase(std::remove(info_name.begin(), info_name.end(), ' '),
+                            info_name.end());
+            if (info_name == name)
+                return &info;
+        }
+        return static_cast<const simdpp::DispatcherInfo*>(nullptr);
+    };
+
+    const simdpp::DispatcherInfo* info = find("test_dispatcher_get_arch()");
+    TEST_EQUAL(tr, true, info != nullptr);
+    if (info != nullptr) {
+        TEST_EQUAL(tr, true, info->arch_name == nullptr);
+    }
+    info = find("test_dispatcher_ret_template_pair<T>(conststd::pair<T,T>&)");
+    TEST_EQUAL(tr, true, info != nullptr);
+
+    simdpp::resolve_all_dispatchers();
+    infos = simdpp::list_dispatchers();
+    for (const auto& info : infos) {
+        if (info.arch_name == nullptr) {
+            tr.out() << "Dispatcher not resolved: " << info.name << "\n";
+            tr.add_result(false);
+        }
+    }
+}
+
+void test_arch_override(TestReporter& tr)
+{
+    using simdpp::Arch;
+    Arch detected = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3;
+
+    simdpp::set_arch_limit(Arch::X86_SSE2 | Arch::X86_SSE3);
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::X86_SSE2 | Arch::X86_SSE3),
+               static_cast<unsigned>(simdpp::detail::apply_arch_override(detected)));
+
+    // the limit is applied on top of the pinned architecture
+    simdpp::set_arch_override(Arch::X86_SSE2 | Arch::X86_AVX);
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::X86_SSE2),
+               static_cast<unsigned>(simdpp::detail::apply_arch_override(detected)));
+
+    simdpp::reset_arch_override();
+    TEST_EQUAL(tr, static_cast<unsigned>(detected),
+               static_cast<unsigned>(simdpp::detail::apply_arch_override(detected)));
+
+#if SIMDPP_X86
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::X86_SSE2 | Arch::X86_SSE3 |
+                                         Arch::X86_POPCNT_INSN),
+               static_cast<unsigned>(simdpp::detail::parse_arch_list("sse3, popcnt")));
+
+    // AVX-512 extensions imply the base instruction sets
+    Arch avx512bw = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+            Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX |
+            Arch::X86_AVX2 | Arch::X86_AVX512F | Arch::X86_AVX512BW;
+    TEST_EQUAL(tr, static_cast<unsigned>(avx512bw | Arch::X86_AVX512VBMI |
+                                         Arch::X86_GFNI),
+               static_cast<unsigned>(simdpp::detail::parse_arch_list("avx512vbmi,gfni")));
+
+    // Scalar bit manipulation extensions do not imply any SIMD instruction set
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::X86_SSE2 | Arch::X86_PCLMULQDQ |
+                                         Arch::X86_BMI1 | Arch::X86_BMI2 |
+                                         Arch::X86_LZCNT),
+               static_cast<unsigned>(simdpp::detail::parse_arch_list("pclmul bmi1 bmi2 lzcnt")));
+#endif
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::NONE_NULL),
+               static_cast<unsigned>(simdpp::detail::parse_arch_list("")));
+}
+
+void test_dispatcher_telemetry(TestReporter& tr)
+{
+    const unsigned num_threads = 4;
+    const int num_calls = 1000;
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < num_threads; ++i) {
+        threads.emplace_back([]() {
+            for (int j = 0; j < num_calls; ++j)
+                test_dispatcher_telemetry_ret1(j);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    TEST_EQUAL(tr, 2, test_dispatcher_telemetry_ret1(1));
+
+    const char* name = nullptr;
+    for (const auto& info : simdpp::list_dispatchers()) {
+        if (std::strncmp(info.name, "test_dispatcher_telemetry_ret1", 30) != 0)
+            continue;
+        name = info.name;
+        TEST_EQUAL(tr, (std::uint64_t) num_threads * num_calls + 1, info.calls);
+        TEST_EQUAL(tr, g_supported_arch == simdpp::Arch::NONE_NULL,
+                   simdpp::is_fallback_dispatch(info));
+    }
+    TEST_EQUAL(tr, true, name != nullptr);
+
+    std::ostringstream text;
+    simdpp::dump_dispatch_telemetry(text);
+    TEST_EQUAL(tr, true, text.str().find("4001") != std::string::npos);
+
+    std::ostringstream json;
+    simdpp::dump_dispatch_telemetry_json(json);
+    TEST_EQUAL(tr, true, json.str().find(",\"calls\":4001,") != std::string::npos);
+}
+
 int main(int argc, char** argv)
 {
     using simdpp::Arch;
@@ -113,27 +286,30 @@ int main(int argc, char** argv)
     } else if (arch_name == "X86_SSE4_1") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                            Arch::X86_SSE4_1;
+    } else if (arch_name == "X86_SSE4_2") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                           Arch::X86_SSE4_1 | Arch::X86_SSE4_2;
     } else if (arch_name == "X86_AVX") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX;
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX;
     } else if (arch_name == "X86_AVX2") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2;
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX | Arch::X86_AVX2;
     } else if (arch_name == "X86_AVX512F") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F;
     } else if (arch_name == "X86_AVX512BW") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F | Arch::X86_AVX512BW;
     } else if (arch_name == "X86_AVX512DQ") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F | Arch::X86_AVX512DQ;
     } else if (arch_name == "X86_AVX512VL") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F | Arch::X86_AVX512VL;
     } else if (arch_name == "ARM_NEON") {
         g_supported_arch = Arch::ARM_NEON;
@@ -146,6 +322,8 @@ int main(int argc, char** argv)
 
     TestReporter tr(std::cerr);
 
+    test_dispatcher_registry(tr);
+
     Arch selected = test_dispatcher_get_arch();
     if (selected != g_supported_arch) {
         tr.out() << "Wrong architecture selected: \n"
@@ -214,6 +392,12 @@ int main(int argc, char** argv)
     void* voidptr2 = test_dispatcher_ret_voidptr(voidptr);
     TEST_EQUAL(tr, voidptr, voidptr2);
 
+    test_dispatcher_concurrent_first_call(tr);
+    test_dispatcher_ifunc(tr);
+    test_detected_arch(tr);
+    test_arch_override(tr);
+    test_dispatcher_telemetry(tr);
+
     g_test_dispatcher_val = 0;
     test_dispatcher_void_pair(std::pair<int, int>(1, 2));
     TEST_EQUAL(tr, 1+2, g_test_dispatcher_val);
@@ -46,11 +46,21 @@ single_arch_template = '''
     #else
     #define SIMDPP_DISPATCH_$num$_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_$num$_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_$num$_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
     #define SIMDPP_DISPATCH_$num$_NS_ID_POPCNT_INSN
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_$num$_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_PCLMULQDQ
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_AVX
     #define SIMDPP_DISPATCH_$num$_NS_ID_AVX SIMDPP_INSN_ID_AVX
     #else
@@ -61,6 +71,21 @@ single_arch_template = '''
     #else
     #define SIMDPP_DISPATCH_$num$_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_LZCNT
+    #define SIMDPP_DISPATCH_$num$_NS_ID_LZCNT SIMDPP_INSN_ID_LZCNT
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_LZCNT
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_$num$_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -96,6 +121,46 @@ single_arch_template = '''
     #else
     #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_$num$_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_VAES
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_$num$_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -127,19 +192,32 @@ single_arch_template = '''
     #define SIMDPP_DISPATCH_$num$_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_$num$_NAMESPACE SIMDPP_PP_PASTE22(arch,         $n$
+    #define SIMDPP_DISPATCH_$num$_NAMESPACE SIMDPP_PP_PASTE35(arch,         $n$
         SIMDPP_DISPATCH_$num$_NS_ID_NULL,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE2,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE3,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSSE3,                                  $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE4_1,                                 $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_SSE4_2,                                 $n$
         SIMDPP_DISPATCH_$num$_NS_ID_POPCNT_INSN,                            $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_PCLMULQDQ,                              $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX,                                    $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX2,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_BMI1,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_BMI2,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_LZCNT,                                  $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512F,                                $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512BW,                               $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512DQ,                               $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512VL,                               $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI2,                            $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512BITALG,                           $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ,                        $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512IFMA,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_GFNI,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_VAES,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_FMA3,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_FMA4,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_XOP,                                    $n$